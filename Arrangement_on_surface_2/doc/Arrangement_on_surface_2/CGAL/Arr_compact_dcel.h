@@ -0,0 +1,41 @@
+namespace CGAL {
+
+/*! \ingroup PkgArrangementOnSurface2DCEL
+ *
+ * A compact \dcel class that can be used by the `Arrangement_2`,
+ * `Arr_bounded_planar_topology_traits_2`, `Arr_unb_planar_topology_traits_2`
+ * class templates instead of the default \dcel. It is parameterized by a
+ * geometry traits type and optionally by vertex, halfedge, or face base
+ * types, in the same way as `Arr_dcel`.
+ *
+ * The records are stored in blocks of contiguous memory and refer to each
+ * other by 32-bit indices. The two halfedges of an edge are stored in
+ * consecutive records, and the outer CCBs, inner CCBs, and isolated vertices
+ * of a face are kept in lists threaded through their records. The points and
+ * the curves remain owned by the arrangement, and each vertex and halfedge
+ * keeps a pointer to its geometric object. The number of records of every
+ * type is limited to \f$2^{31}-1\f$.
+ *
+ * The base types must be `Arr_compact_vertex_base`,
+ * `Arr_compact_halfedge_base`, and `Arr_compact_face_base`, or types derived
+ * from them, e.g., `Arr_extended_face<Arr_compact_face_base, FaceData>`.
+ *
+ * \cgalModels{ArrangementDcelWithRebind}
+ *
+ * \tparam Traits a geometry traits type, which is a model of the
+ *                `ArrangementBasicTraits_2` concept.
+ * \tparam V the vertex base type.
+ * \tparam H the halfedge base type.
+ * \tparam F the face base type.
+ *
+ * \sa `Arr_dcel<Traits, V, H, F>`
+ */
+template <typename Traits,
+          typename V = Arr_compact_vertex_base<typename Traits::Point_2>,
+          typename H =
+            Arr_compact_halfedge_base<typename Traits::X_monotone_curve_2>,
+          typename F = Arr_compact_face_base>
+class Arr_compact_dcel {
+};
+
+} /* end namespace CGAL */
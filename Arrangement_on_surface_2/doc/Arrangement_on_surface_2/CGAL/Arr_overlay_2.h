@@ -23,9 +23,17 @@ construct the overlaid \dcel that represents the resulting arrangement.
   concept, which is able to construct records of the `ResDcel` class on
   the basis of the `Dcel1` and `Dcel2` records that induce them.
 
+\tparam ConcurrencyTag enables sequential versus parallel computation.
+  Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+  With `Parallel_tag`, the plane is partitioned into vertical slabs that
+  are swept concurrently, each with its own copy of the geometry traits.
+  The parallel computation requires all the boundary sides of the geometry
+  traits to be oblivious; otherwise, the sequential computation is used.
+
 \sa `OverlayTraits`
 */
-template <class GeomTraitsA, class GeomTraitsB,
+template <class ConcurrencyTag = Sequential_tag,
+          class GeomTraitsA, class GeomTraitsB,
           class GeomTraitsRes, class TopTraitsA,
           class TopTraitsB, class TopTraitsRes,
           class OverlayTraits>
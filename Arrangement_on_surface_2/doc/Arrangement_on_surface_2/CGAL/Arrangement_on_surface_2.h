@@ -1190,6 +1190,44 @@ void insert_non_intersecting_curves
 (Arrangement_on_surface_2<GeometryTraits, TopologyTraits>& arr,
  InputIterator first, InputIterator last);
 
+/*! \ingroup PkgArrangementOnSurface2Funcs
+ *
+ * Constructs the arrangement induced by a set of noded \f$ x\f$-monotone
+ * curves, given as pairs of indices into a range of points. The curve that
+ * corresponds to the pair `(i, j)` is the \f$ x\f$-monotone curve that
+ * connects the `i`-th and `j`-th points. Points that are not the endpoint of
+ * any curve become isolated vertices. Unlike
+ * `insert_non_intersecting_curves()`, the function does not sweep the
+ * input; it builds the DCEL directly, sorting the curves around each vertex
+ * and walking along the face boundaries, which is considerably faster for
+ * inputs that are already noded, such as planar subdivisions read from a GIS
+ * database. Exactly one vertex is created for every point, and one edge for
+ * every pair of indices. The observers attached to the arrangement are
+ * notified of the construction as a global change only.
+ *
+ * \pre `arr` is an empty arrangement.
+ * \pre The points are pairwise distinct. The curves are pairwise disjoint in
+ * their interiors, and their interiors do not contain any of the points.
+ *
+ * \cgalHeading{Requirements}
+ *
+ * <UL>
+ * <LI>The instantiated `Traits` class must model the
+ * `ArrangementBasicTraits_2` and `ArrangementConstructXMonotoneCurveTraits_2`
+ * concepts, and all its boundary sides must be oblivious; that is, the
+ * arrangement is planar and its curves are bounded.
+ * <LI>`PointRange` must be a range whose value type is `Traits::Point_2`.
+ * <LI>`EdgeRange` must be a range whose value type has data members `first`
+ * and `second` convertible to `std::size_t`, such as
+ * `std::pair<std::size_t, std::size_t>`.
+ * </UL>
+ */
+template <typename GeometryTraits, typename TopologyTraits,
+          typename PointRange, typename EdgeRange>
+void insert_noded_curves
+(Arrangement_on_surface_2<GeometryTraits, TopologyTraits>& arr,
+ const PointRange& points, const EdgeRange& edges);
+
 /*! \ingroup PkgArrangementOnSurface2Funcs
  *
  * Inserts a given point into a given arrangement.  It uses a given
@@ -0,0 +1,1392 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_COMPACT_DCEL_BASE_H
+#define CGAL_ARR_COMPACT_DCEL_BASE_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+#include <CGAL/disable_warnings.h>
+
+/*! \file
+ * The definition of the base compact DCEL class for planar arrangements and
+ * its peripheral records. The records are stored in contiguous blocks and
+ * refer to each other with 32-bit indices; twin halfedges are stored next to
+ * each other, so the opposite halfedge is not stored at all, and the faces
+ * keep their CCBs and isolated vertices in lists that are threaded through
+ * the CCB and isolated-vertex records themselves.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <CGAL/basic.h>
+#include <CGAL/Arr_enums.h>
+#include <CGAL/iterator.h>
+#include <CGAL/Arrangement_2/Arr_compact_container.h>
+#include <CGAL/assertions.h>
+
+namespace CGAL {
+
+/*! \class
+ * Base vertex class of the compact DCEL.
+ */
+template <typename Point_> class Arr_compact_vertex_base {
+public:
+  typedef Point_       Point;
+
+  /*! \struct
+   * An auxiliary structure for rebinding the vertex with a new point class.
+   */
+  template<typename PNT>
+  struct rebind { typedef Arr_compact_vertex_base<PNT> other; };
+
+protected:
+  Point* p_pt;            // The point associated with the vertex.
+  std::uint32_t i_inc;    // An incident halfedge pointing at the vertex,
+                          // or the isolated vertex information (in case it
+                          // is isolated). The MSB indicates whether the
+                          // vertex is isolated.
+  char pss[2];            // The x and y parameter spaces.
+
+public:
+  /*! Default constructor. */
+  Arr_compact_vertex_base() :
+    p_pt(nullptr),
+    i_inc(internal::Arr_compact_index::null)
+  { pss[0] = pss[1] = static_cast<char>(CGAL::ARR_INTERIOR); }
+
+  // Access/modification for index squatting
+  void* inc() const
+  { return reinterpret_cast<void*>(static_cast<std::size_t>(i_inc)); }
+
+  void set_inc(void* inc) const
+  {
+    const_cast<Arr_compact_vertex_base&>(*this).i_inc =
+      static_cast<std::uint32_t>(reinterpret_cast<std::size_t>(inc));
+  }
+
+  /*! Check if the point pointer is nullptr. */
+  bool has_null_point() const { return (p_pt == nullptr); }
+
+  /*! Obtain the point (const version). */
+  const Point& point() const
+  {
+    CGAL_assertion(p_pt != nullptr);
+    return (*p_pt);
+  }
+
+  /*! Obtain the point (non-const version). */
+  Point& point()
+  {
+    CGAL_assertion(p_pt != nullptr);
+    return (*p_pt);
+  }
+
+  /*! Set the point (may be a nullptr point). */
+  void set_point(Point* p) { p_pt = p; }
+
+  /*! Obtain the boundary type in x. */
+  Arr_parameter_space parameter_space_in_x() const
+  { return (Arr_parameter_space(pss[0])); }
+
+  /*! Obtain the boundary type in y. */
+  Arr_parameter_space parameter_space_in_y() const
+  { return (Arr_parameter_space(pss[1])); }
+
+  /*! Set the boundary conditions of the vertex. */
+  void set_boundary(Arr_parameter_space ps_x, Arr_parameter_space ps_y)
+  {
+    pss[0] = static_cast<char>(ps_x);
+    pss[1] = static_cast<char>(ps_y);
+  }
+
+  /*! Assign from another vertex. */
+  void assign(const Arr_compact_vertex_base<Point>& v)
+  {
+    p_pt = v.p_pt;
+    pss[0] = v.pss[0];
+    pss[1] = v.pss[1];
+  }
+};
+
+/*! \class
+ * Base halfedge class of the compact DCEL.
+ */
+template <typename X_monotone_curve_> class Arr_compact_halfedge_base {
+public:
+  typedef X_monotone_curve_  X_monotone_curve;
+
+  /*! \struct
+   * An auxiliary structure for rebinding the halfedge with a new curve class.
+   */
+  template<typename XCV>
+  struct rebind { typedef Arr_compact_halfedge_base<XCV> other; };
+
+protected:
+  X_monotone_curve* p_cv; // The associated x-monotone curve.
+
+public:
+  /*! Default constructor */
+  Arr_compact_halfedge_base() : p_cv(nullptr) {}
+
+  /*! Check if the curve pointer is nullptr. */
+  bool has_null_curve() const { return (p_cv == nullptr); }
+
+  /*! Obtain the x-monotone curve (const version). */
+  const X_monotone_curve& curve() const
+  {
+    CGAL_precondition(p_cv != nullptr);
+    return (*p_cv);
+  }
+
+  /*! Obtain the x-monotone curve (non-const version). */
+  X_monotone_curve& curve()
+  {
+    CGAL_precondition(p_cv != nullptr);
+    return (*p_cv);
+  }
+
+  /*! Set the x-monotone curve of this halfedge only; the DCEL halfedge
+   * sets the curve of its twin as well.
+   */
+  void set_curve(X_monotone_curve* c) { p_cv = c; }
+
+  /*! Assign from another halfedge. */
+  void assign(const Arr_compact_halfedge_base<X_monotone_curve>& he)
+  { p_cv = he.p_cv; }
+};
+
+/*!
+ * Base face class of the compact DCEL.
+ */
+class Arr_compact_face_base {
+protected:
+  enum {
+    IS_UNBOUNDED = 1,
+    IS_FICTITIOUS = 2
+  };
+
+  std::uint32_t flags;  // Face flags.
+
+public:
+  /*! Default constructor. */
+  Arr_compact_face_base() : flags(0) {}
+
+  /*! Check if the face is unbounded. */
+  bool is_unbounded() const { return ((flags & IS_UNBOUNDED) != 0); }
+
+  /*! Set the face as bounded or unbounded. */
+  void set_unbounded(bool unbounded)
+  { flags = (unbounded) ? (flags | IS_UNBOUNDED) : (flags & ~IS_UNBOUNDED); }
+
+  /*! Check if the face is fictitious. */
+  bool is_fictitious() const { return ((flags & IS_FICTITIOUS) != 0); }
+
+  /*! Set the face as fictitious or valid. */
+  void set_fictitious(bool fictitious)
+  { flags = (fictitious) ? (flags | IS_FICTITIOUS) : (flags & ~IS_FICTITIOUS); }
+
+  /*! Assign from another face. */
+  void assign(const Arr_compact_face_base& f) { flags = f.flags; }
+};
+
+// Forward declarations:
+template <class V, class H, class F> class Arr_compact_dcel_base;
+template <class V, class H, class F> class Arr_compact_vertex;
+template <class V, class H, class F> class Arr_compact_halfedge;
+template <class V, class H, class F> class Arr_compact_face;
+template <class V, class H, class F> class Arr_compact_outer_ccb;
+template <class V, class H, class F> class Arr_compact_inner_ccb;
+template <class V, class H, class F> class Arr_compact_isolated_vertex;
+
+/*! \class
+ * The compact arrangement DCEL vertex class.
+ */
+template <class V, class H, class F>
+class Arr_compact_vertex : public V {
+public:
+  typedef V                                     Base;
+  typedef Arr_compact_vertex<V,H,F>             Vertex;
+  typedef Arr_compact_halfedge<V,H,F>           Halfedge;
+  typedef Arr_compact_isolated_vertex<V,H,F>    Isolated_vertex;
+
+private:
+  typedef Arr_compact_dcel_base<V,H,F>          Dcel;
+  typedef internal::Arr_compact_index           Idx;
+
+  friend Dcel;
+
+public:
+  /*! Default constructor. */
+  Arr_compact_vertex() {}
+
+  /*! Check if the vertex is isolated. */
+  bool is_isolated() const { return ((this->i_inc & Idx::flag) != 0); }
+
+  /*! Obtain an incident halfedge (const version). */
+  const Halfedge* halfedge() const
+  {
+    CGAL_precondition(! is_isolated());
+    return (Dcel::owner(this)->halfedge_at(this->i_inc));
+  }
+
+  /*! Obtain an incident halfedge (non-const version). */
+  Halfedge* halfedge()
+  {
+    CGAL_precondition(! is_isolated());
+    return (Dcel::owner(this)->halfedge_at(this->i_inc));
+  }
+
+  /*! Set an incident halfedge (for non-isolated vertices). */
+  void set_halfedge(Halfedge* he) { this->i_inc = Dcel::index_of(he); }
+
+  /*! Obtain the isolated vertex information (const version). */
+  const Isolated_vertex* isolated_vertex() const
+  {
+    CGAL_precondition(is_isolated());
+    return (Dcel::owner(this)->isolated_vertex_at(this->i_inc & Idx::mask));
+  }
+
+  /*! Obtain the isolated vertex information (non-const version). */
+  Isolated_vertex* isolated_vertex()
+  {
+    CGAL_precondition(is_isolated());
+    return (Dcel::owner(this)->isolated_vertex_at(this->i_inc & Idx::mask));
+  }
+
+  /*! Set the isolated vertex information. */
+  void set_isolated_vertex(Isolated_vertex* iv)
+  { this->i_inc = Dcel::index_of(iv) | Idx::flag; }
+
+private:
+  void copy_links(const Vertex& v) { this->i_inc = v.i_inc; }
+};
+
+/*! \class
+ * The compact arrangement DCEL halfedge class. Twin halfedges are stored in
+ * consecutive records.
+ */
+template <class V, class H, class F>
+class Arr_compact_halfedge : public H {
+public:
+  typedef H                                     Base;
+  typedef Arr_compact_vertex<V,H,F>             Vertex;
+  typedef Arr_compact_halfedge<V,H,F>           Halfedge;
+  typedef Arr_compact_face<V,H,F>               Face;
+  typedef Arr_compact_outer_ccb<V,H,F>          Outer_ccb;
+  typedef Arr_compact_inner_ccb<V,H,F>          Inner_ccb;
+  typedef typename H::X_monotone_curve          X_monotone_curve;
+
+private:
+  typedef Arr_compact_dcel_base<V,H,F>          Dcel;
+  typedef internal::Arr_compact_index           Idx;
+
+  friend Dcel;
+
+  std::uint32_t i_prev; // The previous halfedge in the component boundary.
+                        // The MSB indicates whether this is the second
+                        // halfedge of its pair.
+  std::uint32_t i_next; // The next halfedge in the component boundary.
+  std::uint32_t i_v;    // The incident vertex (the target of the halfedge).
+                        // The MSB stores the direction of the halfedge.
+  std::uint32_t i_comp; // The component this halfedge belongs to: the
+                        // outer CCB or the inner CCB. The MSB indicates
+                        // whether the halfedge lies on an inner CCB.
+
+public:
+  /*! Default constructor. */
+  Arr_compact_halfedge() :
+    i_prev(Idx::null),
+    i_next(Idx::null),
+    i_v(Idx::null),
+    i_comp(Idx::null)
+  {}
+
+  /*! Obtain the opposite halfedge (const version). */
+  const Halfedge* opposite() const
+  { return ((i_prev & Idx::flag) != 0) ? this - 1 : this + 1; }
+
+  /*! Obtain the opposite halfedge (non-const version). */
+  Halfedge* opposite()
+  { return ((i_prev & Idx::flag) != 0) ? this - 1 : this + 1; }
+
+  /*! Sets the opposite halfedge. Twins are paired upon creation. */
+  void set_opposite(Halfedge* he)
+  {
+    CGAL_precondition(he == opposite());
+    CGAL_USE(he);
+  }
+
+  /*! Set the x-monotone curve of the halfedge and of its twin. */
+  void set_curve(X_monotone_curve* c)
+  {
+    H::set_curve(c);
+    static_cast<H*>(opposite())->set_curve(c);
+  }
+
+  /*! Obtain the direction of the halfedge. */
+  Arr_halfedge_direction direction() const
+  {
+    if ((i_v & Idx::flag) != 0) return (ARR_LEFT_TO_RIGHT);
+    else return (ARR_RIGHT_TO_LEFT);
+  }
+
+  /*! Set the direction of the edge (and of its opposite halfedge). */
+  void set_direction(Arr_halfedge_direction dir)
+  {
+    Halfedge* opp = opposite();
+    if (dir == ARR_LEFT_TO_RIGHT) {
+      i_v |= Idx::flag;
+      opp->i_v &= Idx::mask;
+    }
+    else {
+      i_v &= Idx::mask;
+      opp->i_v |= Idx::flag;
+    }
+  }
+
+  /*! Obtain the previous halfedge along the chain (const version). */
+  const Halfedge* prev() const
+  { return (Dcel::owner(this)->halfedge_at(i_prev & Idx::mask)); }
+
+  /*! Obtain the previous halfedge along the chain (non-const version). */
+  Halfedge* prev()
+  { return (Dcel::owner(this)->halfedge_at(i_prev & Idx::mask)); }
+
+  /*! Set the previous halfedge along the chain. */
+  void set_prev(Halfedge* he)
+  {
+    i_prev = (i_prev & Idx::flag) | Dcel::index_of(he);
+    he->i_next = Dcel::index_of(this);
+  }
+
+  /*! Obtain the next halfedge along the chain (const version). */
+  const Halfedge* next() const
+  { return (Dcel::owner(this)->halfedge_at(i_next)); }
+
+  /*! Obtain the next halfedge along the chain (non-const version). */
+  Halfedge* next() { return (Dcel::owner(this)->halfedge_at(i_next)); }
+
+  /*! Set the next halfedge along the chain. */
+  void set_next(Halfedge* he)
+  {
+    i_next = Dcel::index_of(he);
+    he->i_prev = (he->i_prev & Idx::flag) | Dcel::index_of(this);
+  }
+
+  /*! Obtain the target vertex (const version). */
+  const Vertex* vertex() const
+  { return (Dcel::owner(this)->vertex_at(i_v & Idx::mask)); }
+
+  /*! Obtain the target vertex (non-const version). */
+  Vertex* vertex() { return (Dcel::owner(this)->vertex_at(i_v & Idx::mask)); }
+
+  /*! Set the target vertex. */
+  void set_vertex(Vertex* v)
+  {
+    // Set the vertex index, preserving the direction bit.
+    i_v = (i_v & Idx::flag) | Dcel::index_of(v);
+  }
+
+  /*! Check whether the halfedge lies on the boundary of an outer CCB. */
+  bool is_on_outer_ccb() const { return ((i_comp & Idx::flag) == 0); }
+
+  /*! Obtain an incident outer CCB (const version).
+   * \pre The edge does not lie on an inner CCB.
+   */
+  const Outer_ccb* outer_ccb() const
+  {
+    CGAL_precondition(! is_on_inner_ccb());
+    return (Dcel::owner(this)->outer_ccb_at(i_comp));
+  }
+
+  /*! Obtain an incident outer CCB (non-const version).
+   * \pre The edge does not lie on an inner CCB.
+   */
+  Outer_ccb* outer_ccb()
+  {
+    CGAL_precondition(! is_on_inner_ccb());
+    return (Dcel::owner(this)->outer_ccb_at(i_comp));
+  }
+
+  /*! Set the incident outer CCB. */
+  void set_outer_ccb(Outer_ccb* oc) { i_comp = Dcel::index_of(oc); }
+
+  /*! Check whether the halfedge lies on the boundary of an inner CCB. */
+  bool is_on_inner_ccb() const { return ((i_comp & Idx::flag) != 0); }
+
+  /*! Obtain an incident inner CCB (const version).
+   * \pre The edge lies on an inner CCB.
+   */
+  const Inner_ccb* inner_ccb() const
+  { return (const_cast<Halfedge*>(this)->inner_ccb()); }
+
+  /*! Obtain an incident inner CCB (non-const version).
+   * \pre The edge lies on an inner CCB.
+   */
+  Inner_ccb* inner_ccb()
+  {
+    CGAL_precondition(is_on_inner_ccb());
+
+    Inner_ccb* out = inner_ccb_no_redirect();
+    if (out->is_valid())
+      return out;
+
+    // else reduce path and get valid iccb
+    Inner_ccb* valid = out->next();
+    while (!valid->is_valid())
+      valid = valid->next();
+    out->set_next(valid);
+    set_inner_ccb(valid);
+    return valid;
+  }
+
+  Inner_ccb* inner_ccb_no_redirect()
+  {
+    CGAL_precondition(is_on_inner_ccb());
+    return (Dcel::owner(this)->inner_ccb_at(i_comp & Idx::mask));
+  }
+
+  /*! Set the incident inner CCB. */
+  void set_inner_ccb(const Inner_ccb* ic)
+  { i_comp = Dcel::index_of(ic) | Idx::flag; }
+
+private:
+  void copy_links(const Halfedge& he)
+  {
+    i_prev = he.i_prev;
+    i_next = he.i_next;
+    i_v = he.i_v;
+    i_comp = he.i_comp;
+  }
+};
+
+namespace internal {
+
+/*! The head of a list of CCB or isolated-vertex records of a face, which
+ * is threaded through the records.
+ */
+struct Arr_compact_face_list {
+  std::uint32_t first;
+  std::uint32_t last;
+  std::uint32_t size;
+
+  Arr_compact_face_list() :
+    first(Arr_compact_index::null),
+    last(Arr_compact_index::null),
+    size(0)
+  {}
+};
+
+/*! \class
+ * An iterator over a list of records of a face. Dereferencing the iterator
+ * yields the halfedge of a CCB record (by value), or the vertex of an
+ * isolated-vertex record (by reference), as the iterators of the
+ * default DCEL do.
+ */
+template <typename Dcel, typename Record, typename Value, typename Reference>
+class Arr_compact_face_iterator {
+public:
+  typedef Arr_compact_face_iterator<Dcel, Record, Value, Reference>  Self;
+  typedef std::bidirectional_iterator_tag             iterator_category;
+  typedef Value                                       value_type;
+  typedef std::ptrdiff_t                              difference_type;
+  typedef typename std::remove_reference<Reference>::type*  pointer;
+  typedef Reference                                   reference;
+  typedef Record                                      Record_type;
+
+private:
+  const Dcel* m_dcel;                   // The DCEL.
+  const Arr_compact_face_list* m_list;  // The list (may be nullptr).
+  Record* m_rec;                        // The current record.
+
+  template <typename D, typename R, typename V, typename Rf>
+  friend class Arr_compact_face_iterator;
+
+public:
+  /*! Constructors. */
+  Arr_compact_face_iterator() :
+    m_dcel(nullptr),
+    m_list(nullptr),
+    m_rec(nullptr)
+  {}
+
+  Arr_compact_face_iterator(const Dcel* d, const Arr_compact_face_list* l,
+                            Record* r) :
+    m_dcel(d),
+    m_list(l),
+    m_rec(r)
+  {}
+
+  template <typename R, typename V, typename Rf,
+            typename = std::enable_if_t<std::is_convertible<R*, Record*>::value>>
+  Arr_compact_face_iterator(const Arr_compact_face_iterator<Dcel, R, V, Rf>& it) :
+    m_dcel(it.m_dcel),
+    m_list(it.m_list),
+    m_rec(it.m_rec)
+  {}
+
+  /*! Obtain the current record. */
+  Record* record() const { return m_rec; }
+
+  /*! Access operations. */
+  reference operator*() const { return m_rec->value(); }
+  pointer operator->() const { return &(m_rec->value()); }
+
+  /*! Equality operators. */
+  bool operator==(const Self& it) const { return (m_rec == it.m_rec); }
+  bool operator!=(const Self& it) const { return (m_rec != it.m_rec); }
+
+  /*! Increment operators. */
+  Self& operator++()
+  {
+    m_rec = m_dcel->template record_at<Record>(m_rec->i_next);
+    return *this;
+  }
+
+  Self operator++(int)
+  {
+    Self tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  /*! Decrement operators. */
+  Self& operator--()
+  {
+    if (m_rec == nullptr) {
+      CGAL_precondition(m_list != nullptr);
+      m_rec = m_dcel->template record_at<Record>(m_list->last);
+    }
+    else m_rec = m_dcel->template record_at<Record>(m_rec->i_prev);
+    return *this;
+  }
+
+  Self operator--(int)
+  {
+    Self tmp = *this;
+    --(*this);
+    return tmp;
+  }
+};
+
+} // namespace internal
+
+/*! \class
+ * The compact arrangement DCEL face class.
+ */
+template <class V, class H, class F>
+class Arr_compact_face : public F {
+public:
+  typedef F                                     Base;
+  typedef Arr_compact_vertex<V,H,F>             Vertex;
+  typedef Arr_compact_halfedge<V,H,F>           Halfedge;
+  typedef Arr_compact_face<V,H,F>               Face;
+  typedef Arr_compact_outer_ccb<V,H,F>          Outer_ccb;
+  typedef Arr_compact_inner_ccb<V,H,F>          Inner_ccb;
+  typedef Arr_compact_isolated_vertex<V,H,F>    Isolated_vertex;
+
+  typedef Inner_ccb                             Hole;
+
+private:
+  typedef Arr_compact_dcel_base<V,H,F>          Dcel;
+  typedef internal::Arr_compact_face_list       List;
+
+  friend Dcel;
+
+  List m_outer;         // The outer CCBs of the face.
+  List m_inner;         // The inner CCBs of the face.
+  List m_iso;           // The isolated vertices inside the face.
+
+public:
+  // Definition of the iterators:
+  typedef internal::Arr_compact_face_iterator<Dcel, Outer_ccb,
+                                              Halfedge*, Halfedge*>
+                                                    Outer_ccb_iterator;
+  typedef internal::Arr_compact_face_iterator<Dcel, const Outer_ccb,
+                                              const Halfedge*, const Halfedge*>
+                                                    Outer_ccb_const_iterator;
+  typedef internal::Arr_compact_face_iterator<Dcel, Inner_ccb,
+                                              Halfedge*, Halfedge*>
+                                                    Inner_ccb_iterator;
+  typedef internal::Arr_compact_face_iterator<Dcel, const Inner_ccb,
+                                              const Halfedge*, const Halfedge*>
+                                                    Inner_ccb_const_iterator;
+  typedef internal::Arr_compact_face_iterator<Dcel, Isolated_vertex,
+                                              Vertex, Vertex&>
+                                                    Isolated_vertex_iterator;
+  typedef internal::Arr_compact_face_iterator<Dcel, const Isolated_vertex,
+                                              Vertex, const Vertex&>
+                                                Isolated_vertex_const_iterator;
+
+  typedef Inner_ccb_iterator                        Hole_iterator;
+  typedef Inner_ccb_const_iterator                  Hole_const_iterator;
+
+  /*! Default constructor. */
+  Arr_compact_face() {}
+
+  /*! Obtain the number of outer CCBs the face has. */
+  std::size_t number_of_outer_ccbs() const { return (m_outer.size); }
+
+  /*! Obtain an iterator for the first outer CCB of the face. */
+  Outer_ccb_iterator outer_ccbs_begin()
+  { return _begin<Outer_ccb_iterator>(m_outer); }
+
+  /*! Obtain a past-the-end iterator for the outer CCBs inside the face. */
+  Outer_ccb_iterator outer_ccbs_end()
+  { return _end<Outer_ccb_iterator>(m_outer); }
+
+  /*! Obtain an const iterator for the first outer CCB inside the face. */
+  Outer_ccb_const_iterator outer_ccbs_begin() const
+  { return _begin<Outer_ccb_const_iterator>(m_outer); }
+
+  /*! Obtain a const past-the-end iterator for the outer CCBs inside the face. */
+  Outer_ccb_const_iterator outer_ccbs_end() const
+  { return _end<Outer_ccb_const_iterator>(m_outer); }
+
+  /*! Add an outer CCB to the face. */
+  void add_outer_ccb(Outer_ccb* oc, Halfedge* h)
+  {
+    oc->set_halfedge(h);
+    _push_back(m_outer, oc);
+  }
+
+  /*! Erase an outer CCB of the face. */
+  void erase_outer_ccb(Outer_ccb* oc) { _erase(m_outer, oc); }
+
+  /*! Obtain the number of inner CCBs the face has. */
+  std::size_t number_of_inner_ccbs() const { return (m_inner.size); }
+
+  /*! Obtain an iterator for the first inner CCB of the face. */
+  Inner_ccb_iterator inner_ccbs_begin()
+  { return _begin<Inner_ccb_iterator>(m_inner); }
+
+  /*! Obtain a past-the-end iterator for the inner CCBs inside the face. */
+  Inner_ccb_iterator inner_ccbs_end()
+  { return _end<Inner_ccb_iterator>(m_inner); }
+
+  /*! Obtain an const iterator for the first inner CCB inside the face. */
+  Inner_ccb_const_iterator inner_ccbs_begin() const
+  { return _begin<Inner_ccb_const_iterator>(m_inner); }
+
+  /*! Obtain a const past-the-end iterator for the inner CCBs inside the face. */
+  Inner_ccb_const_iterator inner_ccbs_end() const
+  { return _end<Inner_ccb_const_iterator>(m_inner); }
+
+  /*! Add an inner CCB to the face. */
+  void add_inner_ccb(Inner_ccb* ic, Halfedge* h)
+  {
+    ic->set_halfedge(h);
+    _push_back(m_inner, ic);
+  }
+
+  /*! Erase an inner CCB of the face. */
+  void erase_inner_ccb(Inner_ccb* ic) { _erase(m_inner, ic); }
+
+  /*! Move all inner CCBs (holes) from the face to another. */
+  Inner_ccb_iterator splice_inner_ccbs(Arr_compact_face& other)
+  {
+    Inner_ccb* first = _splice(m_inner, other.m_inner, (Inner_ccb*)nullptr);
+    return Inner_ccb_iterator(Dcel::owner(this), &m_inner, first);
+  }
+
+  // Backward compatibility:
+  std::size_t number_of_holes() const { return number_of_inner_ccbs(); }
+  Hole_iterator holes_begin() { return inner_ccbs_begin(); }
+  Hole_iterator holes_end() { return inner_ccbs_end(); }
+  Hole_const_iterator holes_begin() const { return inner_ccbs_begin(); }
+  Hole_const_iterator holes_end() const { return inner_ccbs_end(); }
+
+  /*! Obtain the number of isloated vertices inside the face. */
+  std::size_t number_of_isolated_vertices() const { return (m_iso.size); }
+
+  /*! Obtain an iterator for the first isloated vertex inside the face. */
+  Isolated_vertex_iterator isolated_vertices_begin()
+  { return _begin<Isolated_vertex_iterator>(m_iso); }
+
+  /*! Obtain a past-the-end iterator for the isloated vertices inside the face. */
+  Isolated_vertex_iterator isolated_vertices_end()
+  { return _end<Isolated_vertex_iterator>(m_iso); }
+
+  /*! Obtain an const iterator for the first isloated vertex inside the face. */
+  Isolated_vertex_const_iterator isolated_vertices_begin() const
+  { return _begin<Isolated_vertex_const_iterator>(m_iso); }
+
+  /*! Obtain a const past-the-end iterator for the isloated vertices inside the
+   * face. */
+  Isolated_vertex_const_iterator isolated_vertices_end() const
+  { return _end<Isolated_vertex_const_iterator>(m_iso); }
+
+  /*! Add an isloated vertex inside the face. */
+  void add_isolated_vertex(Isolated_vertex* iv, Vertex* v)
+  {
+    iv->i_v = Dcel::index_of(v);
+    _push_back(m_iso, iv);
+  }
+
+  /*! Erase an isloated vertex from the face. */
+  void erase_isolated_vertex(Isolated_vertex* iv) { _erase(m_iso, iv); }
+
+  /*! Move all isolated vertices from the face to another. */
+  Isolated_vertex_iterator splice_isolated_vertices(Arr_compact_face& other)
+  {
+    Isolated_vertex* first =
+      _splice(m_iso, other.m_iso, (Isolated_vertex*)nullptr);
+    return Isolated_vertex_iterator(Dcel::owner(this), &m_iso, first);
+  }
+
+private:
+  template <typename Iterator>
+  Iterator _begin(const List& l) const
+  {
+    const Dcel* dcel = Dcel::owner(this);
+    return Iterator(dcel, &l, dcel->template record_at<
+                    typename Iterator::Record_type>(l.first));
+  }
+
+  template <typename Iterator>
+  Iterator _end(const List& l) const
+  { return Iterator(Dcel::owner(this), &l, nullptr); }
+
+  template <typename Record>
+  void _push_back(List& l, Record* r)
+  {
+    Dcel* dcel = Dcel::owner(this);
+    const std::uint32_t i = Dcel::index_of(r);
+    r->i_prev = l.last;
+    r->i_next = internal::Arr_compact_index::null;
+    if (l.last != internal::Arr_compact_index::null)
+      dcel->template record_at<Record>(l.last)->i_next = i;
+    else l.first = i;
+    l.last = i;
+    ++l.size;
+  }
+
+  template <typename Record>
+  void _erase(List& l, Record* r)
+  {
+    Dcel* dcel = Dcel::owner(this);
+    if (r->i_prev != internal::Arr_compact_index::null)
+      dcel->template record_at<Record>(r->i_prev)->i_next = r->i_next;
+    else l.first = r->i_next;
+    if (r->i_next != internal::Arr_compact_index::null)
+      dcel->template record_at<Record>(r->i_next)->i_prev = r->i_prev;
+    else l.last = r->i_prev;
+    CGAL_assertion(l.size > 0);
+    --l.size;
+  }
+
+  template <typename Record>
+  Record* _splice(List& l, List& other, Record*)
+  {
+    Dcel* dcel = Dcel::owner(this);
+    if (other.size == 0) return nullptr;
+
+    Record* first = dcel->template record_at<Record>(other.first);
+    for (Record* r = first; r != nullptr;
+         r = dcel->template record_at<Record>(r->i_next))
+      r->set_face(this);
+
+    if (l.last != internal::Arr_compact_index::null) {
+      dcel->template record_at<Record>(l.last)->i_next = other.first;
+      first->i_prev = l.last;
+    }
+    else l.first = other.first;
+    l.last = other.last;
+    l.size += other.size;
+    other = List();
+    return first;
+  }
+
+  void copy_links(const Face& f)
+  {
+    m_outer = f.m_outer;
+    m_inner = f.m_inner;
+    m_iso = f.m_iso;
+  }
+};
+
+/*! \class
+ * Representation of an outer CCB of the compact DCEL.
+ */
+template <class V, class H, class F>
+class Arr_compact_outer_ccb {
+public:
+  typedef Arr_compact_outer_ccb<V,H,F>          Self;
+  typedef Arr_compact_halfedge<V,H,F>           Halfedge;
+  typedef Arr_compact_face<V,H,F>               Face;
+  typedef typename Face::Outer_ccb_iterator     Outer_ccb_iterator;
+
+private:
+  typedef Arr_compact_dcel_base<V,H,F>          Dcel;
+
+  friend Dcel;
+  friend Face;
+  template <typename D, typename R, typename Vl, typename Rf>
+  friend class internal::Arr_compact_face_iterator;
+
+  std::uint32_t i_f;        // The face the contains the CCB in its interior.
+  std::uint32_t i_he;       // A halfedge along the CCB.
+  std::uint32_t i_prev;     // The previous outer CCB of the face.
+  std::uint32_t i_next;     // The next outer CCB of the face.
+
+  Halfedge* value() const { return const_cast<Self*>(this)->halfedge(); }
+
+public:
+  /*! Default constructor. */
+  Arr_compact_outer_ccb() :
+    i_f(internal::Arr_compact_index::null),
+    i_he(internal::Arr_compact_index::null),
+    i_prev(internal::Arr_compact_index::null),
+    i_next(internal::Arr_compact_index::null)
+  {}
+
+  /*! Obtain a halfedge along the component (const version). */
+  const Halfedge* halfedge() const
+  { return (Dcel::owner(this)->halfedge_at(i_he)); }
+
+  /*! Obtain a halfedge along the component (non-const version). */
+  Halfedge* halfedge() { return (Dcel::owner(this)->halfedge_at(i_he)); }
+
+  /*! Set a representative halfedge for the component. */
+  void set_halfedge(Halfedge* he) { i_he = Dcel::index_of(he); }
+
+  /*! Obtain the incident face (const version). */
+  const Face* face() const { return (Dcel::owner(this)->face_at(i_f)); }
+
+  /*! Obtain the incident face (non-const version). */
+  Face* face() { return (Dcel::owner(this)->face_at(i_f)); }
+
+  /*! Set the incident face. */
+  void set_face(Face* f) { i_f = Dcel::index_of(f); }
+
+  /*! Obtain the iterator. */
+  Outer_ccb_iterator iterator() const
+  { return Outer_ccb_iterator(Dcel::owner(this), nullptr, const_cast<Self*>(this)); }
+
+  /*! Set the outer CCB iterator. The record is its own iterator. */
+  void set_iterator(Outer_ccb_iterator it)
+  {
+    CGAL_precondition(it.record() == this);
+    CGAL_USE(it);
+  }
+};
+
+/*! \class
+ * Representation of an inner CCB of the compact DCEL.
+ */
+template <class V, class H, class F>
+class Arr_compact_inner_ccb {
+public:
+  typedef Arr_compact_inner_ccb<V,H,F>          Self;
+  typedef Arr_compact_halfedge<V,H,F>           Halfedge;
+  typedef Arr_compact_face<V,H,F>               Face;
+  typedef typename Face::Inner_ccb_iterator     Inner_ccb_iterator;
+
+private:
+  typedef Arr_compact_dcel_base<V,H,F>          Dcel;
+  typedef internal::Arr_compact_index           Idx;
+
+  friend Dcel;
+  friend Face;
+  template <typename D, typename R, typename Vl, typename Rf>
+  friend class internal::Arr_compact_face_iterator;
+
+  std::uint32_t i_f_or_icc; // The face the contains the CCB in its interior,
+                            // or the next inner CCB in chain to a valid one.
+                            // The MSB indicates that the CCB is invalid.
+  std::uint32_t i_he;       // A halfedge along the CCB.
+  std::uint32_t i_prev;     // The previous inner CCB of the face.
+  std::uint32_t i_next;     // The next inner CCB of the face.
+
+  Halfedge* value() const { return const_cast<Self*>(this)->halfedge(); }
+
+public:
+  /*! Default constructor. */
+  Arr_compact_inner_ccb() :
+    i_f_or_icc(Idx::null),
+    i_he(Idx::null),
+    i_prev(Idx::null),
+    i_next(Idx::null)
+  {}
+
+  /*! Obtain a halfedge along the component (const version). */
+  const Halfedge* halfedge() const
+  {
+    CGAL_assertion(is_valid());
+    return (Dcel::owner(this)->halfedge_at(i_he));
+  }
+
+  /*! Obtain a halfedge along the component (non-const version). */
+  Halfedge* halfedge()
+  {
+    CGAL_assertion(is_valid());
+    return (Dcel::owner(this)->halfedge_at(i_he));
+  }
+
+  /*! Set a representative halfedge for the component. */
+  void set_halfedge(Halfedge* he)
+  {
+    CGAL_assertion(is_valid());
+    i_he = Dcel::index_of(he);
+  }
+
+  /*! Obtain the incident face (const version). */
+  const Face* face() const
+  {
+    CGAL_assertion(is_valid());
+    return (Dcel::owner(this)->face_at(i_f_or_icc));
+  }
+
+  /*! Obtain the incident face (non-const version). */
+  Face* face()
+  {
+    CGAL_assertion(is_valid());
+    return (Dcel::owner(this)->face_at(i_f_or_icc));
+  }
+
+  /*! Set the incident face. */
+  void set_face(Face* f)
+  {
+    CGAL_assertion(is_valid());
+    i_f_or_icc = Dcel::index_of(f);
+  }
+
+  /*! Obtain the iterator. */
+  Inner_ccb_iterator iterator() const
+  { return Inner_ccb_iterator(Dcel::owner(this), nullptr, const_cast<Self*>(this)); }
+
+  /*! Set the inner CCB iterator. The record is its own iterator. */
+  void set_iterator(Inner_ccb_iterator it)
+  {
+    CGAL_precondition(it.record() == this);
+    CGAL_USE(it);
+  }
+
+  /*! Check validity */
+  bool is_valid() const { return ((i_f_or_icc & Idx::flag) == 0); }
+
+  /*! Obtain the next CCB to primary chain. */
+  Self* next() const
+  {
+    CGAL_assertion(! is_valid());
+    return (Dcel::owner(this)->inner_ccb_at(i_f_or_icc & Idx::mask));
+  }
+
+  /*! Set the next CCB to primary chain. */
+  void set_next(Self* next)
+  { i_f_or_icc = Dcel::index_of(next) | Idx::flag; }
+};
+
+/*! \class
+ * Representation of an isolated vertex of the compact DCEL.
+ */
+template <class V, class H, class F>
+class Arr_compact_isolated_vertex {
+public:
+  typedef Arr_compact_isolated_vertex<V,H,F>    Self;
+  typedef Arr_compact_vertex<V,H,F>             Vertex;
+  typedef Arr_compact_face<V,H,F>               Face;
+  typedef typename Face::Isolated_vertex_iterator
+                                                Isolated_vertex_iterator;
+
+private:
+  typedef Arr_compact_dcel_base<V,H,F>          Dcel;
+
+  friend Dcel;
+  friend Face;
+  template <typename D, typename R, typename Vl, typename Rf>
+  friend class internal::Arr_compact_face_iterator;
+
+  std::uint32_t i_f;        // The containing face.
+  std::uint32_t i_v;        // The isolated vertex.
+  std::uint32_t i_prev;     // The previous isolated vertex of the face.
+  std::uint32_t i_next;     // The next isolated vertex of the face.
+
+  Vertex& value() const { return *(Dcel::owner(this)->vertex_at(i_v)); }
+
+public:
+  /*! Default constructor. */
+  Arr_compact_isolated_vertex() :
+    i_f(internal::Arr_compact_index::null),
+    i_v(internal::Arr_compact_index::null),
+    i_prev(internal::Arr_compact_index::null),
+    i_next(internal::Arr_compact_index::null)
+  {}
+
+  /*! Obtain the containing face (const version). */
+  const Face* face() const { return (Dcel::owner(this)->face_at(i_f)); }
+
+  /*! Obtain the containing face (non-const version). */
+  Face* face() { return (Dcel::owner(this)->face_at(i_f)); }
+
+  /*! Set the incident face, the one that contains the isolated vertex. */
+  void set_face(Face* f) { i_f = Dcel::index_of(f); }
+
+  /*! Obtain the isolated vertex iterator. */
+  Isolated_vertex_iterator iterator() const
+  { return Isolated_vertex_iterator(Dcel::owner(this), nullptr,
+                                    const_cast<Self*>(this)); }
+
+  /*! Set the isolated vertex iterator. The record is its own iterator. */
+  void set_iterator(Isolated_vertex_iterator it)
+  {
+    CGAL_precondition(it.record() == this);
+    CGAL_USE(it);
+  }
+};
+
+/*! \class
+ * The compact arrangement DCEL class. It provides the same interface as
+ * `Arr_dcel_base`, but stores its records in blocks of contiguous memory
+ * and links them with 32-bit indices.
+ */
+template <class V, class H, class F>
+class Arr_compact_dcel_base {
+public:
+  // Define the vertex, halfedge and face types.
+  typedef Arr_compact_dcel_base<V,H,F>          Self;
+  typedef Arr_compact_vertex<V,H,F>             Vertex;
+  typedef Arr_compact_halfedge<V,H,F>           Halfedge;
+  typedef Arr_compact_face<V,H,F>               Face;
+  typedef Arr_compact_outer_ccb<V,H,F>          Outer_ccb;
+  typedef Arr_compact_inner_ccb<V,H,F>          Inner_ccb;
+  typedef Arr_compact_isolated_vertex<V,H,F>    Isolated_vertex;
+
+  typedef Inner_ccb                             Hole;
+
+protected:
+  // The records are stored in compact containers; the twin halfedges are
+  // created in pairs.
+  typedef internal::Arr_compact_container<Vertex, Self>          Vertex_list;
+  typedef internal::Arr_compact_container<Halfedge, Self, 2>     Halfedge_list;
+  typedef internal::Arr_compact_container<Face, Self>            Face_list;
+  typedef internal::Arr_compact_container<Outer_ccb, Self>       Outer_ccb_list;
+  typedef internal::Arr_compact_container<Inner_ccb, Self>       Inner_ccb_list;
+  typedef internal::Arr_compact_container<Isolated_vertex, Self> Iso_vert_list;
+
+  typedef internal::Arr_compact_index           Idx;
+
+  template <class, class, class> friend class Arr_compact_vertex;
+  template <class, class, class> friend class Arr_compact_halfedge;
+  template <class, class, class> friend class Arr_compact_face;
+  template <class, class, class> friend class Arr_compact_outer_ccb;
+  template <class, class, class> friend class Arr_compact_inner_ccb;
+  template <class, class, class> friend class Arr_compact_isolated_vertex;
+  template <typename D, typename R, typename Vl, typename Rf>
+  friend class internal::Arr_compact_face_iterator;
+
+public:
+  typedef std::size_t                                    Size;
+  typedef std::size_t                                    size_type;
+  typedef std::ptrdiff_t                                 difference_type;
+  typedef std::ptrdiff_t                                 Difference;
+  typedef std::bidirectional_iterator_tag                iterator_category;
+
+protected:
+  Vertex_list         vertices;             // The vertices container.
+  Halfedge_list       halfedges;            // The halfedges container.
+  Face_list           faces;                // The faces container.
+  Outer_ccb_list      out_ccbs;             // The outer CCBs.
+  Inner_ccb_list      in_ccbs;              // The inner CCBs.
+  Iso_vert_list       iso_verts;            // The isolated vertices.
+
+public:
+  // Definitions of iterators.
+  typedef internal::Arr_compact_iterator<Vertex_list, Vertex>
+                                                      Vertex_iterator;
+  typedef internal::Arr_compact_iterator<Halfedge_list, Halfedge>
+                                                      Halfedge_iterator;
+  typedef internal::Arr_compact_iterator<Face_list, Face>
+                                                      Face_iterator;
+  typedef CGAL::N_step_adaptor_derived<Halfedge_iterator, 2>
+                                                      Edge_iterator;
+  typedef internal::Arr_compact_iterator<Inner_ccb_list, Inner_ccb>
+                                                      Inner_ccb_iterator;
+
+  // Definitions of const iterators.
+  typedef internal::Arr_compact_iterator<Vertex_list, const Vertex>
+                                                      Vertex_const_iterator;
+  typedef internal::Arr_compact_iterator<Halfedge_list, const Halfedge>
+                                                      Halfedge_const_iterator;
+  typedef internal::Arr_compact_iterator<Face_list, const Face>
+                                                      Face_const_iterator;
+  typedef CGAL::N_step_adaptor_derived<Halfedge_const_iterator, 2>
+                                                      Edge_const_iterator;
+
+private:
+  // Copy constructor - not supported.
+  Arr_compact_dcel_base(const Self&);
+
+  // Assignment operator - not supported.
+  Self& operator=(const Self&);
+
+public:
+  /// \name Construction and destruction.
+  //@{
+  /*! Default constructor. */
+  Arr_compact_dcel_base() :
+    vertices(this),
+    halfedges(this),
+    faces(this),
+    out_ccbs(this),
+    in_ccbs(this),
+    iso_verts(this)
+  {}
+
+  /*! Destructor. */
+  ~Arr_compact_dcel_base() { delete_all(); }
+  //@}
+
+  /// \name The DCEL size.
+  //@{
+  /*! Obtain the number of DCEL vertices. */
+  Size size_of_vertices() const { return (vertices.size()); }
+
+  /*! Obtain the number of DCEL halfedges (twice the number of edges). */
+  Size size_of_halfedges() const { return (halfedges.size()); }
+
+  /*! Obtain the number of DCEL faces. */
+  Size size_of_faces() const { return (faces.size()); }
+
+  /*! Obtain the number of outer CCBs. */
+  Size size_of_outer_ccbs() const { return (out_ccbs.size()); }
+
+  /*! Obtain the number of inner CCBs. */
+  Size size_of_inner_ccbs() const { return (in_ccbs.size()); }
+
+  /*! Obtain the number of isolated vertices. */
+  Size size_of_isolated_vertices() const { return (iso_verts.size()); }
+  //@}
+
+  /// \name Obtaining iterators.
+  //@{
+  Vertex_iterator   vertices_begin()
+  { return Vertex_iterator(vertices.next_live(0), &vertices); }
+  Vertex_iterator   vertices_end()
+  { return Vertex_iterator(nullptr, &vertices); }
+  Iterator_range<Prevent_deref<Vertex_iterator> >
+  vertex_handles()
+  {
+    return make_prevent_deref_range(vertices_begin(), vertices_end());
+  }
+  Halfedge_iterator halfedges_begin()
+  { return Halfedge_iterator(halfedges.next_live(0), &halfedges); }
+  Halfedge_iterator halfedges_end()
+  { return Halfedge_iterator(nullptr, &halfedges); }
+  Iterator_range<Prevent_deref<Halfedge_iterator> >
+  halfedge_handles()
+  {
+    return make_prevent_deref_range(halfedges_begin(), halfedges_end());
+  }
+  Face_iterator     faces_begin()
+  { return Face_iterator(faces.next_live(0), &faces); }
+  Face_iterator     faces_end()
+  { return Face_iterator(nullptr, &faces); }
+  Iterator_range<Prevent_deref<Face_iterator> >
+  face_handles()
+  {
+    return make_prevent_deref_range(faces_begin(), faces_end());
+  }
+  Edge_iterator     edges_begin()     { return halfedges_begin(); }
+  Edge_iterator     edges_end()       { return halfedges_end(); }
+  Iterator_range<Prevent_deref<Edge_iterator> >
+  edge_handles()
+  {
+    return make_prevent_deref_range(edges_begin(), edges_end());
+  }
+
+  Inner_ccb_iterator inner_ccbs_begin()
+  { return Inner_ccb_iterator(in_ccbs.next_live(0), &in_ccbs); }
+  Inner_ccb_iterator inner_ccbs_end()
+  { return Inner_ccb_iterator(nullptr, &in_ccbs); }
+  //@}
+
+  /// \name Obtaining constant iterators.
+  //@{
+  Vertex_const_iterator   vertices_begin() const
+  { return Vertex_const_iterator(vertices.next_live(0), &vertices); }
+  Vertex_const_iterator   vertices_end() const
+  { return Vertex_const_iterator(nullptr, &vertices); }
+  Iterator_range<Prevent_deref<Vertex_const_iterator> >
+  vertex_handles() const
+  {
+    return make_prevent_deref_range(vertices_begin(), vertices_end());
+  }
+  Halfedge_const_iterator halfedges_begin() const
+  { return Halfedge_const_iterator(halfedges.next_live(0), &halfedges); }
+  Halfedge_const_iterator halfedges_end() const
+  { return Halfedge_const_iterator(nullptr, &halfedges); }
+  Iterator_range<Prevent_deref<Halfedge_const_iterator> >
+  halfedge_handles() const
+  {
+    return make_prevent_deref_range(halfedges_begin(), halfedges_end());
+  }
+  Face_const_iterator     faces_begin() const
+  { return Face_const_iterator(faces.next_live(0), &faces); }
+  Face_const_iterator     faces_end() const
+  { return Face_const_iterator(nullptr, &faces); }
+  Iterator_range<Prevent_deref<Face_const_iterator> >
+  face_handles() const
+  {
+    return make_prevent_deref_range(faces_begin(), faces_end());
+  }
+  Edge_const_iterator     edges_begin() const { return halfedges_begin(); }
+  Edge_const_iterator     edges_end() const { return halfedges_end(); }
+  Iterator_range<Prevent_deref<Edge_const_iterator> >
+  edge_handles() const
+  {
+    return make_prevent_deref_range(edges_begin(), edges_end());
+  }
+  //@}
+
+  // \name Creation of new DCEL features.
+  //@{
+  /*! Create a new vertex. */
+  Vertex* new_vertex() { return vertices.create(); }
+
+  /*! Create a new pair of opposite halfedges. */
+  Halfedge* new_edge()
+  {
+    // The two halfedges are consecutive; mark the second one.
+    Halfedge* h1 = halfedges.create();
+    (h1 + 1)->i_prev |= Idx::flag;
+    return (h1);
+  }
+
+  /*! Create a new face. */
+  Face* new_face() { return faces.create(); }
+
+  /*! Create a new outer CCB. */
+  Outer_ccb* new_outer_ccb() { return out_ccbs.create(); }
+
+  /*! Create a new inner CCB. */
+  Inner_ccb* new_inner_ccb() { return in_ccbs.create(); }
+
+  /*! Create a new isolated vertex. */
+  Isolated_vertex* new_isolated_vertex() { return iso_verts.create(); }
+  //@}
+
+  /// \name Deletion of DCEL features.
+  //@{
+  /*! Delete an existing vertex. */
+  void delete_vertex(Vertex* v) { vertices.destroy(v); }
+
+  /*! Delete an existing pair of opposite halfedges. */
+  void delete_edge(Halfedge* h)
+  { halfedges.destroy(((h->i_prev & Idx::flag) != 0) ? h - 1 : h); }
+
+  /*! Delete an existing face. */
+  void delete_face(Face* f) { faces.destroy(f); }
+
+  /*! Delete an existing outer CCB. */
+  void delete_outer_ccb(Outer_ccb* oc) { out_ccbs.destroy(oc); }
+
+  /*! Delete an existing inner CCB. */
+  void delete_inner_ccb(Inner_ccb* ic) { in_ccbs.destroy(ic); }
+
+  /*! Delete an existing isolated vertex. */
+  void delete_isolated_vertex(Isolated_vertex* iv) { iso_verts.destroy(iv); }
+
+  /*! Delete all DCEL features. */
+  void delete_all()
+  {
+    vertices.clear();
+    halfedges.clear();
+    faces.clear();
+    out_ccbs.clear();
+    in_ccbs.clear();
+    iso_verts.clear();
+  }
+  //@}
+
+  /*! Assign our DCEL the contents of another DCEL. As the records are
+   * addressed by their indices, the duplicates are placed at the same
+   * indices as the originals, and their links are copied as is.
+   */
+  void assign(const Self& dcel)
+  {
+    vertices.copy(dcel.vertices, [](Vertex& dup, const Vertex& v)
+                  { dup.assign(v); dup.copy_links(v); });
+    halfedges.copy(dcel.halfedges, [](Halfedge& dup, const Halfedge& h)
+                   { dup.assign(h); dup.copy_links(h); });
+    faces.copy(dcel.faces, [](Face& dup, const Face& f)
+               { dup.assign(f); dup.copy_links(f); });
+    out_ccbs.copy(dcel.out_ccbs, [](Outer_ccb& dup, const Outer_ccb& oc)
+                  { dup = oc; });
+    in_ccbs.copy(dcel.in_ccbs, [](Inner_ccb& dup, const Inner_ccb& ic)
+                 { dup = ic; });
+    iso_verts.copy(dcel.iso_verts, [](Isolated_vertex& dup,
+                                      const Isolated_vertex& iv)
+                   { dup = iv; });
+  }
+
+protected:
+  /// \name Translation between records and indices.
+  //@{
+  static Self* owner(const Vertex* v) { return Vertex_list::owner(v); }
+  static Self* owner(const Halfedge* h) { return Halfedge_list::owner(h); }
+  static Self* owner(const Face* f) { return Face_list::owner(f); }
+  static Self* owner(const Outer_ccb* oc) { return Outer_ccb_list::owner(oc); }
+  static Self* owner(const Inner_ccb* ic) { return Inner_ccb_list::owner(ic); }
+  static Self* owner(const Isolated_vertex* iv)
+  { return Iso_vert_list::owner(iv); }
+
+  static std::uint32_t index_of(const Vertex* v)
+  { return (v == nullptr) ? Idx::null : Vertex_list::index(v); }
+  static std::uint32_t index_of(const Halfedge* h)
+  { return (h == nullptr) ? Idx::null : Halfedge_list::index(h); }
+  static std::uint32_t index_of(const Face* f)
+  { return (f == nullptr) ? Idx::null : Face_list::index(f); }
+  static std::uint32_t index_of(const Outer_ccb* oc)
+  { return (oc == nullptr) ? Idx::null : Outer_ccb_list::index(oc); }
+  static std::uint32_t index_of(const Inner_ccb* ic)
+  { return (ic == nullptr) ? Idx::null : Inner_ccb_list::index(ic); }
+  static std::uint32_t index_of(const Isolated_vertex* iv)
+  { return (iv == nullptr) ? Idx::null : Iso_vert_list::index(iv); }
+
+  Vertex* vertex_at(std::uint32_t i) const
+  { return (i == Idx::null) ? nullptr : vertices.pointer(i); }
+
+  Halfedge* halfedge_at(std::uint32_t i) const
+  { return (i == Idx::null) ? nullptr : halfedges.pointer(i); }
+
+  Face* face_at(std::uint32_t i) const
+  { return (i == Idx::null) ? nullptr : faces.pointer(i); }
+
+  Outer_ccb* outer_ccb_at(std::uint32_t i) const
+  { return (i == Idx::null) ? nullptr : out_ccbs.pointer(i); }
+
+  Inner_ccb* inner_ccb_at(std::uint32_t i) const
+  { return (i == Idx::null) ? nullptr : in_ccbs.pointer(i); }
+
+  Isolated_vertex* isolated_vertex_at(std::uint32_t i) const
+  { return (i == Idx::null) ? nullptr : iso_verts.pointer(i); }
+
+  Outer_ccb* record_at_(std::uint32_t i, const Outer_ccb*) const
+  { return outer_ccb_at(i); }
+  Inner_ccb* record_at_(std::uint32_t i, const Inner_ccb*) const
+  { return inner_ccb_at(i); }
+  Isolated_vertex* record_at_(std::uint32_t i, const Isolated_vertex*) const
+  { return isolated_vertex_at(i); }
+
+  /*! Obtain the CCB or isolated-vertex record of a given index. */
+  template <typename Record>
+  typename std::remove_const<Record>::type* record_at(std::uint32_t i) const
+  { return record_at_(i, static_cast<const Record*>(nullptr)); }
+  //@}
+};
+
+} //namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif
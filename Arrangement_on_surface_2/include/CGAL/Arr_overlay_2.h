@@ -35,7 +35,10 @@
 #include <CGAL/Surface_sweep_2/Arr_overlay_ss_visitor.h>
 #include <CGAL/Surface_sweep_2/Arr_overlay_event.h>
 #include <CGAL/Surface_sweep_2/Arr_overlay_subcurve.h>
+#include <CGAL/Surface_sweep_2/Slab_partition.h>
+#include <CGAL/Arrangement_2/Arr_slab_overlay.h>
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
 
 namespace CGAL {
 
@@ -123,6 +126,10 @@ private:
 };
 
 /*! Compute the overlay of two input arrangements.
+ * \tparam ConcurrencyTag enables sequential versus parallel overlay.
+ *               With Parallel_tag, the plane is partitioned into vertical
+ *               slabs that are swept concurrently, provided that all the
+ *               boundary sides of the geometry traits are oblivious.
  * \tparam GeometryTraitsA_2 the geometry traits of the first arrangement.
  * \tparam GeometryTraitsB_2 the geometry traits of the second arrangement.
  * \tparam GeometryTraitsRes_2 the geometry traits of the resulting arrangement.
@@ -141,7 +148,8 @@ private:
  *               overlay operations of pairs of DCEL features from
  *               TopologyTraitsA and TopologyTraitsB to the resulting ResDcel.
  */
-template <typename GeometryTraitsA_2,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename GeometryTraitsA_2,
           typename GeometryTraitsB_2,
           typename GeometryTraitsRes_2,
           typename TopologyTraitsA,
@@ -203,6 +211,13 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
   CGAL_USE_TYPE(Optional_cell_red);
   CGAL_USE_TYPE(Optional_cell_blue);
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  typedef typename Ss2::internal::Sweep_concurrency_tag<ConcurrencyTag,
+                                                        Rgt2>::type Tag;
+
   // The result arrangement cannot be on of the input arrangements.
   CGAL_precondition(((void*)(&arr) != (void*)(&arr1)) &&
                     ((void*)(&arr) != (void*)(&arr2)));
@@ -230,6 +245,33 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
     xcvs_vec[i] = Ovl_x_monotone_curve_2(eit2->curve(), invalid_he1, he2);
   }
 
+  // Prepare a vector of extended points that represent all isolated vertices
+  // in both input arrangements.
+  const std::size_t total_iso_verts =
+    arr1.number_of_isolated_vertices() + arr2.number_of_isolated_vertices();
+  std::vector<Ovl_point_2> pts_vec(total_iso_verts);
+
+  i = 0;
+  typename Arr_a::Vertex_const_iterator  vit1;
+  for (vit1 = arr1.vertices_begin(); vit1 != arr1.vertices_end(); ++vit1) {
+    if (vit1->is_isolated()) {
+      typename Arr_a::Vertex_const_handle v1 = vit1;
+      pts_vec[i++] =
+        Ovl_point_2(vit1->point(), std::make_optional(Cell_handle_red(v1)),
+                    std::optional<Cell_handle_blue>());
+    }
+  }
+
+  typename Arr_b::Vertex_const_iterator  vit2;
+  for (vit2 = arr2.vertices_begin(); vit2 != arr2.vertices_end(); ++vit2) {
+    if (vit2->is_isolated()) {
+      typename Arr_b::Vertex_const_handle v2 = vit2;
+      pts_vec[i++] =
+        Ovl_point_2(vit2->point(), std::optional<Cell_handle_red>(),
+                    std::make_optional(Cell_handle_blue(v2)));
+    }
+  }
+
   // Obtain an extended traits-class object and define the sweep-line visitor.
   const typename Arr_res::Traits_adaptor_2* traits_adaptor =
     arr.traits_adaptor();
@@ -250,14 +292,20 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
                      const Ovl_gt2&, Ovl_gt2>
     ex_traits(*traits_adaptor);
 
+  // Overlay the slabs of a vertical partition concurrently, if requested.
+  if constexpr (std::is_same<Tag, Parallel_tag>::value) {
+    Arr_slab_overlay<Arr_a, Arr_b, Arr_res, Overlay_traits>
+      slab_overlay(arr1, arr2, arr, ovl_tr, ex_traits);
+    slab_overlay(xcvs_vec, pts_vec,
+                 Ss2::internal::number_of_sweep_slabs(xcvs_vec.size()));
+    return;
+  }
+
   Ovl_visitor visitor(&arr1, &arr2, &arr, &ovl_tr);
   Ss2::Surface_sweep_2<Ovl_visitor> surface_sweep(&ex_traits, &visitor);
 
   // In case both arrangement do not contain isolated vertices, go on and
   // overlay them.
-  const std::size_t total_iso_verts =
-    arr1.number_of_isolated_vertices() + arr2.number_of_isolated_vertices();
-
   if (total_iso_verts == 0) {
     // Clear the result arrangement and perform the sweep to construct it.
     arr.clear();
@@ -273,31 +321,6 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
     return;
   }
 
-  // Prepare a vector of extended points that represent all isolated vertices
-  // in both input arrangements.
-  std::vector<Ovl_point_2> pts_vec(total_iso_verts);
-
-  i = 0;
-  typename Arr_a::Vertex_const_iterator  vit1;
-  for (vit1 = arr1.vertices_begin(); vit1 != arr1.vertices_end(); ++vit1) {
-    if (vit1->is_isolated()) {
-      typename Arr_a::Vertex_const_handle v1 = vit1;
-      pts_vec[i++] =
-        Ovl_point_2(vit1->point(), std::make_optional(Cell_handle_red(v1)),
-                    std::optional<Cell_handle_blue>());
-    }
-  }
-
-  typename Arr_b::Vertex_const_iterator  vit2;
-  for (vit2 = arr2.vertices_begin(); vit2 != arr2.vertices_end(); ++vit2) {
-    if (vit2->is_isolated()) {
-      typename Arr_b::Vertex_const_handle v2 = vit2;
-      pts_vec[i++] =
-        Ovl_point_2(vit2->point(), std::optional<Cell_handle_red>(),
-                    std::make_optional(Cell_handle_blue(v2)));
-    }
-  }
-
   // Clear the result arrangement and perform the sweep to construct it.
   arr.clear();
   if (std::is_same<typename Agt2::Bottom_side_category,
@@ -315,11 +338,13 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
 }
 
 /*! Compute the (simple) overlay of two input arrangements.
+ * \tparam ConcurrencyTag enables sequential versus parallel overlay.
  * \param[in] arr1 the first arrangement.
  * \param[in] arr2 the second arrangement.
  * \param[out] arr the resulting arrangement.
  */
-template <typename GeometryTraitsA_2,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename GeometryTraitsA_2,
           typename GeometryTraitsB_2,
           typename GeometryTraitsRes_2,
           typename TopologyTraitsA,
@@ -341,7 +366,7 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
   typedef Arrangement_on_surface_2<Rgt2, Rtt>                   Arr_res;
 
   _Arr_default_overlay_traits_base<Arr_a, Arr_b, Arr_res> ovl_traits;
-  overlay(arr1, arr2, arr, ovl_traits);
+  overlay<ConcurrencyTag>(arr1, arr2, arr, ovl_traits);
 }
 
 } // namespace CGAL
@@ -0,0 +1,375 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_LANDMARKS_DYNAMIC_NEAREST_NEIGHBOR_H
+#define CGAL_ARR_LANDMARKS_DYNAMIC_NEAREST_NEIGHBOR_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+/*! \file
+ * Definition of the Arr_landmarks_dynamic_nearest_neighbor<Arrangement>
+ * template.
+ */
+
+#include <CGAL/basic.h>
+#include <CGAL/tags.h>
+#include <CGAL/Search_traits.h>
+#include <CGAL/Orthogonal_incremental_neighbor_search.h>
+#include <CGAL/Arr_point_location_result.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace CGAL {
+
+/*! \class
+ * A class that answers nearest-neighbor queries on a set of landmark
+ * vertices that supports batched insertions and removals.
+ * The landmarks are kept in an immutable kd-tree (a snapshot), together with
+ * a small buffer of the landmarks inserted since the snapshot was built and
+ * the set of identifiers of the landmarks removed since. Once the buffer and
+ * the removed set grow beyond the square root of the snapshot size, a new
+ * snapshot is built from the old one and the buffered changes, and replaces
+ * it. Building never accesses the arrangement.
+ * If ConcurrencyTag is Parallel_tag, the new snapshot is built on a
+ * background thread; queries keep using the old snapshot and the buffer
+ * until the new snapshot is swapped in, and may be issued concurrently from
+ * several threads. Otherwise, the snapshot is rebuilt by the call that
+ * triggers it.
+ */
+template <typename Arrangement_, typename ConcurrencyTag_ = Sequential_tag>
+class Arr_landmarks_dynamic_nearest_neighbor {
+public:
+  typedef Arrangement_                                  Arrangement_2;
+  typedef ConcurrencyTag_                               Concurrency_tag;
+
+  typedef typename Arrangement_2::Vertex_const_handle   Vertex_const_handle;
+
+  typedef Arr_point_location_result<Arrangement_2>      PL_result;
+  typedef typename PL_result::Type                      PL_result_type;
+
+  typedef typename Arrangement_2::Geometry_traits_2     Geometry_traits_2;
+  typedef typename Geometry_traits_2::Approximate_number_type
+    Approximate_number_type;
+  typedef typename Geometry_traits_2::Point_2           Point_2;
+
+  /*! \class NN_Point_2
+   * Stores a landmark vertex along with the approximate coordinates of its
+   * point and a unique identifier. The point itself is not copied, so that
+   * landmarks can be safely moved between threads.
+   */
+  class NN_Point_2 {
+  public:
+    Vertex_const_handle m_vertex;       // The landmark vertex.
+    std::size_t m_id;                   // The landmark identifier.
+    Approximate_number_type m_vec[2];   // Approximate x and y-coordinates.
+
+  public:
+    /*! Default constructor. */
+    NN_Point_2() : m_id(0) { m_vec[0] = m_vec[1] = 0; }
+
+    /*! Constructor from a query point. */
+    NN_Point_2(const Point_2& p) :
+      m_id(0)
+    {
+      // Obtain the coordinate approximations,
+      Geometry_traits_2 m_traits;
+      m_vec[0] = m_traits.approximate_2_object()(p, 0);
+      m_vec[1] = m_traits.approximate_2_object()(p, 1);
+    }
+
+    /*! Constructor from a vertex and an identifier. */
+    NN_Point_2(Vertex_const_handle v, std::size_t id) :
+      m_vertex(v),
+      m_id(id)
+    {
+      // Obtain the coordinate approximations,
+      Geometry_traits_2 m_traits;
+      m_vec[0] = m_traits.approximate_2_object()(v->point(), 0);
+      m_vec[1] = m_traits.approximate_2_object()(v->point(), 1);
+    }
+
+    /* Get the landmark vertex. */
+    Vertex_const_handle vertex() const { return m_vertex; }
+
+    /* Get the landmark identifier. */
+    std::size_t id() const { return m_id; }
+
+    /*! Get an iterator for the approximate coordinates. */
+    const Approximate_number_type* begin() const { return (m_vec); }
+
+    /*! Get a past-the-end iterator for the approximate coordinates. */
+    const Approximate_number_type* end() const { return (m_vec + 2); }
+
+    /*! Equality operators. */
+    bool operator== (const NN_Point_2& nnp) const
+    { return (m_vec[0] == nnp.m_vec[0] && m_vec[1] == nnp.m_vec[1]); }
+
+    bool operator!= (const NN_Point_2& nnp) const
+    { return (m_vec[0] != nnp.m_vec[0] || m_vec[1] != nnp.m_vec[1]); }
+  };
+
+  /*! \struct Construct_coord_iterator
+   * An auxiliary structure that generates iterators (actually pointers) for
+   * traversing the approximated point coordinates.
+   */
+  struct Construct_coord_iterator
+  {
+    typedef const Approximate_number_type*      result_type;
+
+    /*! Get an iterator for the approximate coordinates. */
+    const Approximate_number_type* operator()(const NN_Point_2& nnp) const
+    { return (nnp.begin()); }
+
+    /*! Get a past-the-end iterator for the approximate coordinates. */
+    const Approximate_number_type* operator()(const NN_Point_2& nnp, int) const
+    { return (nnp.end()); }
+  };
+
+protected:
+  typedef CGAL::Search_traits<Approximate_number_type, NN_Point_2,
+                              const Approximate_number_type*,
+                              Construct_coord_iterator>     Search_traits;
+  typedef CGAL::Orthogonal_incremental_neighbor_search<Search_traits>
+                                                            Neighbor_search;
+  typedef typename Neighbor_search::Tree                    Tree;
+  typedef std::shared_ptr<const Tree>                       Tree_ptr;
+  typedef std::unordered_set<std::size_t>                   Id_set;
+
+  enum { MIN_CHANGES = 16 };
+
+  // Data members:
+  mutable std::shared_mutex m_mutex;    // Guards the members below.
+  Tree_ptr m_tree;                      // The current snapshot.
+  std::vector<NN_Point_2> m_inserted;   // Landmarks missing from the snapshot.
+  Id_set m_removed;                     // Removed landmarks, which may still
+                                        // appear in the snapshot or in
+                                        // m_inserted.
+  std::size_t m_size;                   // The number of landmarks.
+  bool m_building;                      // Is a snapshot being built?
+  std::thread m_builder;                // The background builder.
+
+private:
+  typedef Arr_landmarks_dynamic_nearest_neighbor<Arrangement_2,
+                                                 Concurrency_tag>  Self;
+
+  /*! Copy constructor - not supported. */
+  Arr_landmarks_dynamic_nearest_neighbor(const Self&);
+
+  /*! Assignment operator - not supported. */
+  Self& operator=(const Self&);
+
+public:
+  /*! Default constructor. */
+  Arr_landmarks_dynamic_nearest_neighbor() :
+    m_tree(std::make_shared<const Tree>()),
+    m_size(0),
+    m_building(false)
+  {}
+
+  /*! Destructor. */
+  ~Arr_landmarks_dynamic_nearest_neighbor() { wait(); }
+
+  /*! Determine whether there are no landmarks. */
+  bool is_empty() const
+  {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return (m_size == 0);
+  }
+
+  /*! Obtain the number of landmarks. */
+  std::size_t size() const
+  {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_size;
+  }
+
+  /*! Insert a batch of landmarks.
+   * \param begin An iterator for the first landmark.
+   * \param end A past-the-end iterator for the landmarks.
+   * \pre The identifiers of the landmarks are distinct from the identifiers
+   *      of all landmarks inserted so far.
+   */
+  template <class InputIterator>
+  void insert(InputIterator begin, InputIterator end)
+  {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for (; begin != end; ++begin) {
+      m_inserted.push_back(*begin);
+      ++m_size;
+    }
+    _update(lock);
+  }
+
+  /*! Remove a batch of landmarks.
+   * \param begin An iterator for the identifier of the first landmark.
+   * \param end A past-the-end iterator for the identifiers.
+   * \pre The landmarks have been inserted and not removed since.
+   */
+  template <class InputIterator>
+  void remove(InputIterator begin, InputIterator end)
+  {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for (; begin != end; ++begin) {
+      CGAL_precondition(m_size > 0);
+      m_removed.insert(*begin);
+      --m_size;
+    }
+    _update(lock);
+  }
+
+  /*! Remove all landmarks. */
+  void clear()
+  {
+    wait();
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_tree = std::make_shared<const Tree>();
+    m_inserted.clear();
+    m_removed.clear();
+    m_size = 0;
+  }
+
+  /*! Wait until the background builder, if any, terminates. */
+  void wait()
+  {
+    if (m_builder.joinable()) m_builder.join();
+  }
+
+  /*! Find the nearest landmark to the query point.
+   * \param q The query point.
+   * \param obj Output: The location of the nearest landmark point in the
+   *                    arrangement (namely, the landmark vertex).
+   * \pre There is at least one landmark.
+   * \return The nearest landmark point.
+   */
+  Point_2 find_nearest_neighbor(const Point_2& q, PL_result_type& obj) const
+  {
+    NN_Point_2 nn_query(q);
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    CGAL_precondition_msg(m_size > 0, "There are no landmarks.");
+
+    const NN_Point_2* nearest_p = nullptr;
+    Approximate_number_type min_dist(0);
+
+    // Find the nearest landmark in the snapshot that has not been removed.
+    if (! m_tree->empty()) {
+      Neighbor_search search(*m_tree, nn_query);
+      for (auto it = search.begin(); it != search.end(); ++it) {
+        if (m_removed.find(it->first.id()) != m_removed.end()) continue;
+        nearest_p = &(it->first);
+        min_dist = it->second;
+
+        // The search object owns the reported points, so look for a nearer
+        // landmark among the buffered ones before it goes out of scope.
+        _scan_inserted(nn_query, nearest_p, min_dist);
+        obj = PL_result::make_result(nearest_p->vertex());
+        return nearest_p->vertex()->point();
+      }
+    }
+
+    _scan_inserted(nn_query, nearest_p, min_dist);
+    CGAL_assertion(nearest_p != nullptr);
+    obj = PL_result::make_result(nearest_p->vertex());
+    return nearest_p->vertex()->point();
+  }
+
+protected:
+  /*! Look for a landmark in the buffer nearer than the given one. */
+  void _scan_inserted(const NN_Point_2& q, const NN_Point_2*& nearest_p,
+                      Approximate_number_type& min_dist) const
+  {
+    for (const NN_Point_2& p : m_inserted) {
+      if (m_removed.find(p.id()) != m_removed.end()) continue;
+      const Approximate_number_type dx = p.m_vec[0] - q.m_vec[0];
+      const Approximate_number_type dy = p.m_vec[1] - q.m_vec[1];
+      const Approximate_number_type dist = dx*dx + dy*dy;
+      if ((nearest_p == nullptr) || (dist < min_dist)) {
+        nearest_p = &p;
+        min_dist = dist;
+      }
+    }
+  }
+
+  /*! Determine whether the buffered changes call for a new snapshot. */
+  bool _is_outdated() const
+  {
+    const double n = static_cast<double>(m_tree->size());
+    const std::size_t threshold =
+      (std::max)(std::size_t(MIN_CHANGES),
+                 static_cast<std::size_t>(std::sqrt(n) + 0.5));
+    return (m_inserted.size() + m_removed.size() >= threshold);
+  }
+
+  /*! Build a new snapshot if needed, or start the background builder.
+   * \param lock The (acquired) exclusive lock on the members.
+   */
+  void _update(std::unique_lock<std::shared_mutex>& lock)
+  {
+    if (m_building || ! _is_outdated()) return;
+
+    if constexpr (std::is_convertible<Concurrency_tag, Parallel_tag>::value) {
+      // The previous builder has already released the lock for the last
+      // time, so joining it here cannot dead-lock.
+      if (m_builder.joinable()) m_builder.join();
+      m_building = true;
+      m_builder = std::thread([this] {
+        std::unique_lock<std::shared_mutex> builder_lock(m_mutex);
+        while (_is_outdated()) _rebuild(builder_lock);
+        m_building = false;
+      });
+    }
+    else {
+      m_building = true;
+      _rebuild(lock);
+      m_building = false;
+    }
+  }
+
+  /*! Build a new snapshot from the current one and the buffered changes,
+   * and swap it in. The lock is released while the kd-tree is built.
+   * \param lock The (acquired) exclusive lock on the members.
+   */
+  void _rebuild(std::unique_lock<std::shared_mutex>& lock)
+  {
+    // Capture the state.
+    Tree_ptr old_tree = m_tree;
+    std::vector<NN_Point_2> inserted = m_inserted;
+    Id_set removed = m_removed;
+    lock.unlock();
+
+    // Build the new snapshot.
+    std::vector<NN_Point_2> points;
+    points.reserve(old_tree->size() + inserted.size());
+    for (const NN_Point_2& p : *old_tree)
+      if (removed.find(p.id()) == removed.end()) points.push_back(p);
+    for (const NN_Point_2& p : inserted)
+      if (removed.find(p.id()) == removed.end()) points.push_back(p);
+    auto tree = std::make_shared<Tree>(points.begin(), points.end());
+    if (! points.empty()) tree->build();
+
+    // Swap it in, and keep only the changes made in the meantime.
+    lock.lock();
+    m_tree = tree;
+    m_inserted.erase(m_inserted.begin(), m_inserted.begin() + inserted.size());
+    for (std::size_t id : removed) m_removed.erase(id);
+  }
+};
+
+} //namespace CGAL
+
+#endif
@@ -0,0 +1,242 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_LANDMARKS_DYNAMIC_VERTICES_GENERATOR_H
+#define CGAL_ARR_LANDMARKS_DYNAMIC_VERTICES_GENERATOR_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+/*! \file
+ * Definition of the Arr_landmarks_dynamic_vertices_generator<Arrangement>
+ * template.
+ */
+
+#include <CGAL/tags.h>
+#include <CGAL/Arr_point_location_result.h>
+#include <CGAL/Arr_point_location/Arr_lm_dynamic_nearest_neighbor.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace CGAL {
+
+/*! \class Arr_landmarks_dynamic_vertices_generator
+ * A generator for the landmarks point-location class, which uses the
+ * arrangement vertices as its set of landmarks, like
+ * Arr_landmarks_vertices_generator. Unlike the latter, it does not rebuild
+ * its search structure on every change of the arrangement. Instead, it
+ * forwards the created and removed vertices to a dynamic nearest-neighbor
+ * structure, in a single batch per global operation (e.g., an aggregated
+ * insertion). If ConcurrencyTag is Parallel_tag, the search structure is
+ * rebuilt on a background thread, while queries keep using the previous one.
+ */
+template <typename Arrangement_, typename ConcurrencyTag_ = Sequential_tag>
+class Arr_landmarks_dynamic_vertices_generator :
+    public Arrangement_::Observer
+{
+public:
+  typedef Arrangement_                                  Arrangement_2;
+  typedef ConcurrencyTag_                               Concurrency_tag;
+  typedef typename Arrangement_2::Base_aos              Base_aos;
+
+  typedef Arr_landmarks_dynamic_nearest_neighbor<Arrangement_2,
+                                                 Concurrency_tag>
+                                                        Nearest_neighbor;
+
+  typedef typename Base_aos::Vertex_const_handle        Vertex_const_handle;
+  typedef typename Base_aos::Vertex_handle              Vertex_handle;
+  typedef typename Base_aos::Point_2                    Point_2;
+
+  typedef typename Nearest_neighbor::NN_Point_2         NN_Point_2;
+
+  typedef Arr_point_location_result<Base_aos>           PL_result;
+  typedef typename PL_result::Type                      PL_result_type;
+
+private:
+  typedef Arr_landmarks_dynamic_vertices_generator<Arrangement_2,
+                                                   Concurrency_tag>  Self;
+
+  typedef std::unordered_map<const void*, std::size_t>  Id_map;
+
+protected:
+  // Data members:
+  Nearest_neighbor nn;                  // The nearest-neighbor structure.
+  Id_map m_ids;                         // The landmark identifiers of the
+                                        // vertices.
+  std::size_t m_next_id;                // The next landmark identifier.
+  bool m_in_global_change;              // Are the changes being batched?
+  std::vector<NN_Point_2> m_batch_inserted;   // The batched insertions.
+  std::vector<std::size_t> m_batch_removed;   // The batched removals.
+
+private:
+  /*! Copy constructor - not supported. */
+  Arr_landmarks_dynamic_vertices_generator(const Self&);
+
+  /*! Assignment operator - not supported. */
+  Self& operator=(const Self&);
+
+public:
+  /*! Constructor from an arrangement.
+   * \param arr (in) The arrangement.
+   */
+  Arr_landmarks_dynamic_vertices_generator(const Base_aos& arr) :
+    Base_aos::Observer(const_cast<Base_aos&>(arr)),
+    m_next_id(0),
+    m_in_global_change(false)
+  { build_landmark_set(); }
+
+  /*! Determine whether there are no landmarks. */
+  bool is_empty() const { return nn.is_empty(); }
+
+  /*! Create the landmark set, using all arrangement vertices.
+   */
+  void build_landmark_set()
+  {
+    clear_landmark_set();
+    const auto* arr = this->arrangement();
+    for (auto vit = arr->vertices_begin(); vit != arr->vertices_end(); ++vit)
+      _insert(vit);
+    nn.insert(m_batch_inserted.begin(), m_batch_inserted.end());
+    m_batch_inserted.clear();
+  }
+
+  /*! Clear the landmark set.
+   */
+  void clear_landmark_set()
+  {
+    nn.clear();
+    m_ids.clear();
+    m_batch_inserted.clear();
+    m_batch_removed.clear();
+  }
+
+  /*! Wait until the search structure is no longer being rebuilt in the
+   * background.
+   */
+  void wait() { nn.wait(); }
+
+  /*! Obtain the nearest neighbor (landmark) to the given point.
+   * \param p The query point.
+   * \param obj Output: The location of the nearest landmark point in the
+   *                    arrangement (a vertex handle).
+   * \return The nearest landmark point.
+   */
+  Point_2 closest_landmark(const Point_2& p, PL_result_type& obj)
+  { return nn.find_nearest_neighbor(p, obj); }
+
+  /// \name Overloaded observer functions on global changes.
+  //@{
+
+  /*! Notification before the arrangement is assigned with the content of
+   * another arrangement.
+   */
+  virtual void before_assign(const Base_aos& /* arr */) override
+  { clear_landmark_set(); }
+
+  /*! Notification after the arrangement has been assigned with another
+   * arrangement.
+   */
+  virtual void after_assign() override { build_landmark_set(); }
+
+  /*! Notification before the observer is attached to an arrangement. */
+  virtual void before_attach(const Base_aos& /* arr */) override
+  { clear_landmark_set(); }
+
+  /*! Notification after the observer has been attached to an arrangement. */
+  virtual void after_attach() override { build_landmark_set(); }
+
+  /*! Notification before the observer is detached from the arrangement. */
+  virtual void before_detach() override { clear_landmark_set(); }
+
+  /*! Notification after the arrangement is cleared. */
+  virtual void after_clear() override { build_landmark_set(); }
+
+  /*! Notification before a global operation modifies the arrangement. */
+  virtual void before_global_change() override { m_in_global_change = true; }
+
+  /*! Notification after a global operation is completed. */
+  virtual void after_global_change() override {
+    m_in_global_change = false;
+    _flush();
+  }
+  //@}
+
+  /// \name Overloaded observer functions on local changes.
+  //@{
+
+  /*! Notification after the creation of a new vertex. */
+  virtual void after_create_vertex(Vertex_handle v) override {
+    _insert(v);
+    _flush();
+  }
+
+  /*! Notification after the creation of a new boundary vertex. */
+  virtual void after_create_boundary_vertex(Vertex_handle v) override {
+    _insert(v);
+    _flush();
+  }
+
+  /*! Notification before the modification of the point of a vertex. */
+  virtual void before_modify_vertex(Vertex_handle v, const Point_2& /* p */)
+  override { _remove(v); }
+
+  /*! Notification after the point of a vertex has been modified. */
+  virtual void after_modify_vertex(Vertex_handle v) override {
+    _insert(v);
+    _flush();
+  }
+
+  /*! Notification before the removal of a vertex. */
+  virtual void before_remove_vertex(Vertex_handle v) override {
+    _remove(v);
+    _flush();
+  }
+  //@}
+
+protected:
+  /*! Add a vertex to the batched insertions. */
+  void _insert(Vertex_const_handle v) {
+    // Vertices at infinity have no associated point.
+    if (v->is_at_open_boundary()) return;
+
+    const std::size_t id = m_next_id++;
+    m_ids[&(*v)] = id;
+    m_batch_inserted.push_back(NN_Point_2(v, id));
+  }
+
+  /*! Add a vertex to the batched removals. */
+  void _remove(Vertex_const_handle v) {
+    auto it = m_ids.find(&(*v));
+    if (it == m_ids.end()) return;
+    m_batch_removed.push_back(it->second);
+    m_ids.erase(it);
+  }
+
+  /*! Forward the batched changes to the nearest-neighbor structure, unless a
+   * global operation is in progress.
+   */
+  void _flush() {
+    if (m_in_global_change) return;
+
+    // Insert first, as a vertex may be created and removed in the same batch.
+    if (! m_batch_inserted.empty()) {
+      nn.insert(m_batch_inserted.begin(), m_batch_inserted.end());
+      m_batch_inserted.clear();
+    }
+    if (! m_batch_removed.empty()) {
+      nn.remove(m_batch_removed.begin(), m_batch_removed.end());
+      m_batch_removed.clear();
+    }
+  }
+};
+
+} //namespace CGAL
+
+#endif
@@ -0,0 +1,372 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_COMPACT_CONTAINER_H
+#define CGAL_ARR_COMPACT_CONTAINER_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+/*! \file
+ * The definition of the block container that stores the records of the
+ * compact DCEL, and of its iterators.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <CGAL/assertions.h>
+
+namespace CGAL {
+namespace internal {
+
+/*! The 32-bit links between the records of the compact DCEL. The most
+ * significant bit of a link is free for the records to squat on.
+ */
+struct Arr_compact_index {
+  typedef std::uint32_t         Index;
+
+  static constexpr Index null = 0x7FFFFFFF;     // no record
+  static constexpr Index mask = 0x7FFFFFFF;     // the index bits
+  static constexpr Index flag = 0x80000000;     // the squatted bit
+};
+
+/*! \class
+ * A container of records addressed by 32-bit indices. The records are
+ * stored in blocks that never move, so pointers to records remain valid
+ * until they are destroyed. Every block is aligned to its size and starts
+ * with a header, such that the index of a record, and the owner of the
+ * container, are obtained from the address of the record alone.
+ * Records are created and destroyed in groups of GroupSize consecutive
+ * records (e.g., pairs of twin halfedges); a group never straddles two
+ * blocks. Destroyed groups are kept in a free list and reused.
+ */
+template <typename T, typename Owner, unsigned int GroupSize = 1>
+class Arr_compact_container {
+public:
+  typedef Arr_compact_container<T, Owner, GroupSize>    Self;
+  typedef Arr_compact_index::Index                      Index;
+  typedef std::size_t                                   size_type;
+
+private:
+  struct Block_header {
+    Self* container;            // The container that owns the block.
+    Owner* owner;               // The owner of the container.
+    Index first;                // The index of the first record in the block.
+  };
+
+  static constexpr std::size_t header_bytes()
+  { return ((sizeof(Block_header) + alignof(T) - 1) / alignof(T)) * alignof(T); }
+
+  // A block holds at least 64 records, and is at least 64KB large.
+  static constexpr std::size_t block_bytes()
+  {
+    std::size_t bytes = std::size_t(1) << 16;
+    while (bytes < header_bytes() + 64 * sizeof(T)) bytes <<= 1;
+    return bytes;
+  }
+
+  static constexpr Index block_capacity()
+  {
+    return static_cast<Index>(((block_bytes() - header_bytes()) / sizeof(T)) /
+                              GroupSize * GroupSize);
+  }
+
+  Owner* m_owner;                       // The owner of the container.
+  std::vector<T*> m_blocks;             // The first record of every block.
+  std::vector<std::uint64_t> m_live;    // One bit per live record.
+  Index m_end;                          // The number of used slots.
+  Index m_size;                         // The number of live records.
+  Index m_free;                         // The head of the free list.
+
+  // Copy constructor and assignment operator - not supported.
+  Arr_compact_container(const Self&);
+  Self& operator=(const Self&);
+
+public:
+  /*! Constructor. */
+  Arr_compact_container(Owner* owner) :
+    m_owner(owner),
+    m_end(0),
+    m_size(0),
+    m_free(Arr_compact_index::null)
+  {}
+
+  /*! Destructor. */
+  ~Arr_compact_container() { clear(); }
+
+  /*! Obtain the number of live records. */
+  size_type size() const { return m_size; }
+
+  /*! Obtain the number of used slots, live or free. */
+  Index end_index() const { return m_end; }
+
+  /*! Check whether the record of the given index is live. */
+  bool is_live(Index i) const
+  { return ((m_live[i >> 6] >> (i & 63)) & 1) != 0; }
+
+  /*! Obtain the record of a given index. */
+  T* pointer(Index i) const
+  {
+    CGAL_precondition(i < m_end);
+    return m_blocks[i / block_capacity()] + (i % block_capacity());
+  }
+
+  /*! Obtain the index of a record. */
+  static Index index(const T* p)
+  {
+    const Block_header* h = header(p);
+    return h->first + static_cast<Index>(p - first_record(h));
+  }
+
+  /*! Obtain the container of a record. */
+  static Self* container(const T* p) { return header(p)->container; }
+
+  /*! Obtain the owner of the container of a record. */
+  static Owner* owner(const T* p) { return header(p)->owner; }
+
+  /*! Create a group of records and obtain the first one. */
+  T* create()
+  {
+    Index i;
+    if (m_free != Arr_compact_index::null) {
+      i = m_free;
+      std::memcpy(&m_free, static_cast<void*>(_slot(i)), sizeof(Index));
+    }
+    else {
+      // The indices are 32-bit, and the largest ones are reserved; this is a
+      // limit of the container, which is checked in release builds too.
+      if (m_end > Arr_compact_index::null - 2 * GroupSize)
+        CGAL_error_msg("Too many records for 32-bit indices.");
+      if (m_end == m_blocks.size() * std::size_t(block_capacity()))
+        _allocate_block();
+      i = m_end;
+      m_end += GroupSize;
+    }
+
+    for (Index k = 0; k < GroupSize; ++k) {
+      ::new (static_cast<void*>(_slot(i + k))) T();
+      m_live[(i + k) >> 6] |= (std::uint64_t(1) << ((i + k) & 63));
+    }
+    m_size += GroupSize;
+    return _slot(i);
+  }
+
+  /*! Destroy the group of records that starts at the given one. */
+  void destroy(T* p)
+  {
+    const Index i = index(p);
+    CGAL_precondition(i % GroupSize == 0);
+    for (Index k = 0; k < GroupSize; ++k) {
+      CGAL_precondition(is_live(i + k));
+      _slot(i + k)->~T();
+      m_live[(i + k) >> 6] &= ~(std::uint64_t(1) << ((i + k) & 63));
+    }
+    std::memcpy(static_cast<void*>(_slot(i)), &m_free, sizeof(Index));
+    m_free = i;
+    m_size -= GroupSize;
+  }
+
+  /*! Destroy all records and free all blocks. */
+  void clear()
+  {
+    for (Index i = 0; i < m_end; ++i)
+      if (is_live(i)) _slot(i)->~T();
+
+    for (T* first : m_blocks)
+      ::operator delete(static_cast<void*>(header(first)),
+                        std::align_val_t(block_bytes()));
+    m_blocks.clear();
+    m_live.clear();
+    m_end = 0;
+    m_size = 0;
+    m_free = Arr_compact_index::null;
+  }
+
+  /*! Make the container a duplicate of another, with the same indices.
+   * Every live record is default constructed and then passed, together with
+   * its origin, to the given copy function.
+   */
+  template <typename CopyFunction>
+  void copy(const Self& other, CopyFunction copy_record)
+  {
+    clear();
+    while (m_blocks.size() < other.m_blocks.size()) _allocate_block();
+    m_live = other.m_live;
+    m_end = other.m_end;
+    m_size = other.m_size;
+    m_free = other.m_free;
+
+    for (Index i = 0; i < m_end; ++i) {
+      if (is_live(i)) {
+        T* p = ::new (static_cast<void*>(_slot(i))) T();
+        copy_record(*p, *other.pointer(i));
+      }
+      else if (i % GroupSize == 0) {
+        // Copy the link of the free list.
+        std::memcpy(static_cast<void*>(_slot(i)),
+                    static_cast<const void*>(other.pointer(i)), sizeof(Index));
+      }
+    }
+  }
+
+  /*! Obtain the first live record with index at least i, or nullptr. */
+  T* next_live(Index i) const
+  {
+    while (i < m_end) {
+      const std::uint64_t word = m_live[i >> 6] >> (i & 63);
+      if (word == 0) {
+        i = (i | 63) + 1;
+        continue;
+      }
+      if ((word & 1) != 0) return pointer(i);
+      ++i;
+    }
+    return nullptr;
+  }
+
+  /*! Obtain the last live record with index at most i, or nullptr. */
+  T* prev_live(Index i) const
+  {
+    if (m_end == 0) return nullptr;
+    if (i >= m_end) i = m_end - 1;
+    while (true) {
+      if (is_live(i)) return pointer(i);
+      if (i == 0) return nullptr;
+      --i;
+    }
+  }
+
+private:
+  static Block_header* header(const T* p)
+  {
+    const std::uintptr_t mask = ~(std::uintptr_t(block_bytes()) - 1);
+    return reinterpret_cast<Block_header*>
+      (reinterpret_cast<std::uintptr_t>(p) & mask);
+  }
+
+  static T* first_record(const Block_header* h)
+  {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>
+                                (const_cast<Block_header*>(h)) +
+                                header_bytes());
+  }
+
+  T* _slot(Index i) const
+  { return m_blocks[i / block_capacity()] + (i % block_capacity()); }
+
+  void _allocate_block()
+  {
+    void* mem = ::operator new(block_bytes(), std::align_val_t(block_bytes()));
+    Block_header* h = ::new (mem) Block_header;
+    h->container = this;
+    h->owner = m_owner;
+    h->first = static_cast<Index>(m_blocks.size()) * block_capacity();
+    m_blocks.push_back(first_record(h));
+    m_live.resize((m_blocks.size() * std::size_t(block_capacity()) + 63) / 64,
+                  0);
+  }
+};
+
+/*! \class
+ * A bidirectional iterator over the live records of a compact container.
+ * As with the iterators of an in-place list, an iterator can be constructed
+ * from a pointer to a record; the container is only looked up when the
+ * iterator moves.
+ */
+template <typename Container, typename Value>
+class Arr_compact_iterator {
+public:
+  typedef Arr_compact_iterator<Container, Value>        Self;
+  typedef std::bidirectional_iterator_tag               iterator_category;
+  typedef typename std::remove_const<Value>::type       value_type;
+  typedef std::ptrdiff_t                                difference_type;
+  typedef Value*                                        pointer;
+  typedef Value&                                        reference;
+
+private:
+  Value* m_ptr;                 // The current record (nullptr at the end).
+  const Container* m_cont;      // The container (may be nullptr).
+
+  template <typename C, typename V> friend class Arr_compact_iterator;
+
+  const Container* _container() const
+  { return (m_cont != nullptr) ? m_cont : Container::container(m_ptr); }
+
+public:
+  /*! Constructors. */
+  Arr_compact_iterator() : m_ptr(nullptr), m_cont(nullptr) {}
+
+  Arr_compact_iterator(Value* p) : m_ptr(p), m_cont(nullptr) {}
+
+  Arr_compact_iterator(Value* p, const Container* c) : m_ptr(p), m_cont(c) {}
+
+  template <typename V,
+            typename = std::enable_if_t<std::is_convertible<V*, Value*>::value>>
+  Arr_compact_iterator(const Arr_compact_iterator<Container, V>& it) :
+    m_ptr(it.m_ptr),
+    m_cont(it.m_cont)
+  {}
+
+  /*! Access operations. */
+  reference operator*() const { return *m_ptr; }
+  pointer operator->() const { return m_ptr; }
+
+  /*! Equality operators. */
+  bool operator==(const Self& it) const { return (m_ptr == it.m_ptr); }
+  bool operator!=(const Self& it) const { return (m_ptr != it.m_ptr); }
+
+  /*! Increment operators. */
+  Self& operator++()
+  {
+    CGAL_precondition(m_ptr != nullptr);
+    const Container* c = _container();
+    m_ptr = c->next_live(Container::index(m_ptr) + 1);
+    m_cont = c;
+    return *this;
+  }
+
+  Self operator++(int)
+  {
+    Self tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  /*! Decrement operators. */
+  Self& operator--()
+  {
+    CGAL_precondition(m_cont != nullptr || m_ptr != nullptr);
+    const Container* c = _container();
+    if (m_ptr == nullptr) m_ptr = c->prev_live(c->end_index());
+    else {
+      const typename Container::Index i = Container::index(m_ptr);
+      m_ptr = (i == 0) ? nullptr : c->prev_live(i - 1);
+    }
+    m_cont = c;
+    return *this;
+  }
+
+  Self operator--(int)
+  {
+    Self tmp = *this;
+    --(*this);
+    return tmp;
+  }
+};
+
+} // namespace internal
+} // namespace CGAL
+
+#endif
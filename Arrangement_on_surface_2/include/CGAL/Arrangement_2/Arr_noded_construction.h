@@ -0,0 +1,567 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_NODED_CONSTRUCTION_H
+#define CGAL_ARR_NODED_CONSTRUCTION_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+/*! \file
+ * Definition of the Arr_noded_construction class-template.
+ */
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <CGAL/assertions.h>
+#include <CGAL/enum.h>
+#include <CGAL/Arr_enums.h>
+#include <CGAL/Arr_accessor.h>
+#include <CGAL/Multiset.h>
+#include <CGAL/Arrangement_2/Arr_traits_adaptor_2.h>
+
+namespace CGAL {
+
+/*! \class
+ * A class that constructs the DCEL of a planar arrangement of bounded curves
+ * directly from an indexed set of points and curves, without sweeping.
+ * The curves must be noded, that is, pairwise interior-disjoint, and their
+ * interiors must not contain any of the points. Their endpoints are given as
+ * indices into the point range.
+ *
+ * The halfedges incident to every vertex are sorted around it using the
+ * Compare_y_at_x_right_2 and Compare_y_at_x_left_2 predicates, and the
+ * connected components of the boundaries of the faces are found by walking
+ * along the resulting halfedge cycles. A cycle is an inner CCB if its face
+ * contains the points immediately to the left of its lexicographically
+ * smallest vertex, and the face that contains it is then found by shooting a
+ * ray upward from that vertex; the rays (and the ones shot from the isolated
+ * vertices) are answered together by sweeping over the x-ranges of the
+ * curves, which are kept sorted from bottom to top, such that every ray
+ * takes a logarithmic number of comparisons.
+ */
+template <typename Arrangement_>
+class Arr_noded_construction {
+public:
+  typedef Arrangement_                                  Arrangement_2;
+  typedef typename Arrangement_2::Geometry_traits_2     Geometry_traits_2;
+  typedef typename Arrangement_2::Point_2               Point_2;
+  typedef typename Arrangement_2::X_monotone_curve_2    X_monotone_curve_2;
+
+private:
+  typedef Arr_traits_basic_adaptor_2<Geometry_traits_2> Traits_adaptor_2;
+  typedef Arr_accessor<Arrangement_2>                   Accessor;
+
+  typedef typename Accessor::Dcel_vertex            DVertex;
+  typedef typename Accessor::Dcel_halfedge          DHalfedge;
+  typedef typename Accessor::Dcel_face              DFace;
+  typedef typename Accessor::Dcel_outer_ccb         DOuter_ccb;
+  typedef typename Accessor::Dcel_inner_ccb         DInner_ccb;
+  typedef typename Accessor::Dcel_isolated_vertex   DIso_vertex;
+
+  static constexpr std::size_t invalid =
+    (std::numeric_limits<std::size_t>::max)();
+
+  // Data members:
+  Arrangement_2&               m_arr;
+  Accessor                     m_arr_access;
+  const Traits_adaptor_2*      m_traits;
+
+  // The halfedges are indexed, such that the halfedges of the i-th curve are
+  // 2i, directed from its first to its second point, and 2i+1.
+  std::vector<DVertex*>        m_vertices;     // The DCEL vertices.
+  std::vector<DHalfedge*>      m_halfedges;    // The DCEL halfedges.
+  std::vector<std::size_t>     m_targets;      // The halfedge targets.
+  std::vector<std::size_t>     m_next;         // The halfedge successors.
+  std::vector<std::size_t>     m_cycles;       // The halfedge cycles.
+  std::vector<std::size_t>     m_isolated;     // The isolated vertices.
+  std::vector<std::size_t>     m_ranks;        // The ranks of the vertices
+                                               // in xy-lexicographic order.
+
+  /*! Obtain the point of a vertex. */
+  const Point_2& point(std::size_t v) const { return m_vertices[v]->point(); }
+
+  /*! Obtain the curve of a halfedge. */
+  const X_monotone_curve_2& curve(std::size_t he) const
+  { return m_halfedges[he]->curve(); }
+
+  /*! Determine whether the curve of an halfedge lies to the right of its
+   * target.
+   */
+  bool is_to_the_right(std::size_t he) const
+  { return (m_halfedges[he]->direction() == ARR_RIGHT_TO_LEFT); }
+
+private:
+  // Copy constructor and assignment operator - not supported.
+  Arr_noded_construction(const Arr_noded_construction&);
+  Arr_noded_construction& operator=(const Arr_noded_construction&);
+
+public:
+  /*! Constructor. */
+  Arr_noded_construction(Arrangement_2& arr) :
+    m_arr(arr),
+    m_arr_access(arr),
+    m_traits(static_cast<const Traits_adaptor_2*>(arr.geometry_traits()))
+  {}
+
+  /*! Construct the arrangement.
+   * \param points The points.
+   * \param edges The curves, given as pairs of indices of their endpoints.
+   * \pre The arrangement is empty.
+   */
+  template <typename PointRange, typename EdgeRange>
+  void operator()(const PointRange& points, const EdgeRange& edges)
+  {
+    auto construct_xcv = m_traits->construct_x_monotone_curve_2_object();
+    _construct(points, edges,
+               [&](const Point_2& p, const Point_2& q)
+               { return construct_xcv(p, q); });
+  }
+
+  /*! Construct the arrangement, given the curves associated with the edges.
+   * \param points The points.
+   * \param edges The curves, given as pairs of indices of their endpoints.
+   * \param curves The curves, in the order of the edges.
+   * \pre The arrangement is empty.
+   */
+  template <typename PointRange, typename EdgeRange, typename XCurveRange>
+  void operator()(const PointRange& points, const EdgeRange& edges,
+                  const XCurveRange& curves)
+  {
+    CGAL_precondition(std::size_t(std::distance(curves.begin(), curves.end()))
+                      == std::size_t(std::distance(edges.begin(), edges.end())));
+    auto cit = curves.begin();
+    _construct(points, edges,
+               [&](const Point_2&, const Point_2&)
+               { return *(cit++); });
+  }
+
+  /*! Obtain the DCEL vertex of the i-th point. */
+  DVertex* vertex(std::size_t i) const { return m_vertices[i]; }
+
+  /*! Obtain the DCEL halfedge of the i-th curve, directed from its first
+   * point to its second point.
+   */
+  DHalfedge* halfedge(std::size_t i) const { return m_halfedges[2 * i]; }
+
+protected:
+  /*! Construct the arrangement, obtaining the curve of every edge from the
+   * given function of its endpoints (the edges are visited in order).
+   */
+  template <typename PointRange, typename EdgeRange, typename CurveFunction>
+  void _construct(const PointRange& points, const EdgeRange& edges,
+                  CurveFunction edge_curve)
+  {
+    CGAL_precondition(m_arr.is_empty());
+
+    _create_vertices_and_edges(points, edges, edge_curve);
+    _rank_vertices();
+    _connect_halfedges();
+
+    std::vector<std::size_t> lowest_halfedges;
+    std::vector<bool> is_outer;
+    _create_ccbs(lowest_halfedges, is_outer);
+
+    _locate_components(lowest_halfedges, is_outer);
+  }
+
+  /*! Create the DCEL vertices and edges. */
+  template <typename PointRange, typename EdgeRange, typename CurveFunction>
+  void _create_vertices_and_edges(const PointRange& points,
+                                  const EdgeRange& edges,
+                                  CurveFunction edge_curve)
+  {
+    auto compare_xy = m_traits->compare_xy_2_object();
+
+    for (auto it = points.begin(); it != points.end(); ++it)
+      m_vertices.push_back(m_arr_access.new_vertex(&(*it), ARR_INTERIOR,
+                                                   ARR_INTERIOR));
+
+    for (auto it = edges.begin(); it != edges.end(); ++it) {
+      const std::size_t src = static_cast<std::size_t>(it->first);
+      const std::size_t trg = static_cast<std::size_t>(it->second);
+      CGAL_precondition(src < m_vertices.size() && trg < m_vertices.size());
+      CGAL_precondition(src != trg);
+
+      // Allocate a pair of twin halfedges, and associate them with the curve
+      // connecting the two points.
+      DVertex* src_v = m_vertices[src];
+      DVertex* trg_v = m_vertices[trg];
+      const X_monotone_curve_2 xcv = edge_curve(src_v->point(),
+                                                trg_v->point());
+      DHalfedge* he = m_arr_access.new_edge(&xcv);
+
+      he->set_vertex(trg_v);
+      he->opposite()->set_vertex(src_v);
+      he->set_direction(compare_xy(src_v->point(), trg_v->point()) == SMALLER ?
+                        ARR_LEFT_TO_RIGHT : ARR_RIGHT_TO_LEFT);
+
+      m_halfedges.push_back(he);
+      m_halfedges.push_back(he->opposite());
+      m_targets.push_back(trg);
+      m_targets.push_back(src);
+    }
+  }
+
+  /*! Rank the vertices in xy-lexicographic order. All the subsequent
+   * comparisons of vertices then only compare their ranks.
+   */
+  void _rank_vertices()
+  {
+    auto compare_xy = m_traits->compare_xy_2_object();
+
+    std::vector<std::size_t> order(m_vertices.size());
+    for (std::size_t v = 0; v < order.size(); ++v) order[v] = v;
+    std::sort(order.begin(), order.end(),
+              [&](std::size_t v1, std::size_t v2) -> bool
+              { return (compare_xy(point(v1), point(v2)) == SMALLER); });
+
+    m_ranks.resize(order.size());
+    for (std::size_t r = 0; r < order.size(); ++r) {
+      CGAL_precondition((r == 0) ||
+                        (compare_xy(point(order[r - 1]), point(order[r])) ==
+                         SMALLER));
+      m_ranks[order[r]] = r;
+    }
+  }
+
+  /*! Sort the halfedges around their target vertices, and set their
+   * successors.
+   */
+  void _connect_halfedges()
+  {
+    const std::size_t n_vertices = m_vertices.size();
+    const std::size_t n_halfedges = m_halfedges.size();
+
+    // Bucket the halfedges by their targets.
+    std::vector<std::size_t> offsets(n_vertices + 1, 0);
+    for (std::size_t he = 0; he < n_halfedges; ++he)
+      ++offsets[m_targets[he] + 1];
+    for (std::size_t v = 0; v < n_vertices; ++v) offsets[v + 1] += offsets[v];
+
+    std::vector<std::size_t> incident(n_halfedges);
+    std::vector<std::size_t> fill(offsets.begin(), offsets.end() - 1);
+    for (std::size_t he = 0; he < n_halfedges; ++he)
+      incident[fill[m_targets[he]]++] = he;
+
+    auto cmp_y_right = m_traits->compare_y_at_x_right_2_object();
+    auto cmp_y_left = m_traits->compare_y_at_x_left_2_object();
+
+    m_next.resize(n_halfedges);
+    for (std::size_t v = 0; v < n_vertices; ++v) {
+      auto begin = incident.begin() + offsets[v];
+      auto end = incident.begin() + offsets[v + 1];
+      if (begin == end) {
+        m_isolated.push_back(v);
+        continue;
+      }
+
+      // Sort the incident halfedges in clockwise order, starting from the
+      // top: the curves to the right of the vertex from top to bottom, then
+      // the curves to its left from bottom to top. There is nothing to sort
+      // for a vertex of degree at most two, whose (circular) order is unique.
+      const Point_2& p = point(v);
+      if (end - begin > 2)
+        std::sort(begin, end,
+                  [&](std::size_t he1, std::size_t he2) -> bool
+                  {
+                    const bool right1 = is_to_the_right(he1);
+                    if (right1 != is_to_the_right(he2)) return right1;
+                    if (right1)
+                      return (cmp_y_right(curve(he1), curve(he2), p) == LARGER);
+                    return (cmp_y_left(curve(he1), curve(he2), p) == SMALLER);
+                  });
+
+      // The successor of an incoming halfedge is the twin of the next
+      // incoming halfedge in clockwise order.
+      for (auto it = begin; it != end; ++it) {
+        const std::size_t next = (it + 1 == end) ? *begin : *(it + 1);
+        m_next[*it] = next ^ 1;
+        m_halfedges[*it]->set_next(m_halfedges[next ^ 1]);
+      }
+      m_vertices[v]->set_halfedge(m_halfedges[*begin]);
+    }
+  }
+
+  /*! Walk along the halfedge cycles and create their CCBs.
+   * \param lowest_halfedges Output: for each cycle, an halfedge incident to its
+   *                         lexicographically smallest vertex.
+   * \param is_outer Output: for each cycle, whether it is an outer CCB.
+   */
+  void _create_ccbs(std::vector<std::size_t>& lowest_halfedges,
+                    std::vector<bool>& is_outer)
+  {
+    auto cmp_y_right = m_traits->compare_y_at_x_right_2_object();
+
+    const std::size_t n_halfedges = m_halfedges.size();
+    m_cycles.assign(n_halfedges, invalid);
+
+    for (std::size_t first = 0; first < n_halfedges; ++first) {
+      if (m_cycles[first] != invalid) continue;
+
+      const std::size_t cycle = lowest_halfedges.size();
+
+      // Find the lexicographically smallest vertex along the cycle.
+      std::size_t lowest = first;
+      std::size_t he = first;
+      do {
+        m_cycles[he] = cycle;
+        if (m_ranks[m_targets[he]] < m_ranks[m_targets[lowest]]) lowest = he;
+        he = m_next[he];
+      } while (he != first);
+
+      // All the curves incident to the smallest vertex lie to its right. The
+      // cycle is an inner CCB if the face to the left of one of its halfedges
+      // contains the points immediately to the left of the vertex; that is,
+      // if the cycle turns from an incoming curve to an outgoing curve that
+      // lies above it (or back along the same curve).
+      const std::size_t v = m_targets[lowest];
+      bool outer = true;
+      he = first;
+      do {
+        if (m_targets[he] == v) {
+          const std::size_t next = m_next[he];
+          if ((next == (he ^ 1)) ||
+              (cmp_y_right(curve(he), curve(next), point(v)) == SMALLER))
+          {
+            outer = false;
+            lowest = he;
+          }
+        }
+        he = m_next[he];
+      } while (outer && (he != first));
+
+      lowest_halfedges.push_back(lowest);
+      is_outer.push_back(outer);
+
+      if (outer) {
+        // Create a new bounded face whose outer boundary is the cycle.
+        DFace* f = m_arr_access.new_face();
+        f->set_unbounded(false);
+        f->set_fictitious(false);
+        DOuter_ccb* oc = m_arr_access.new_outer_ccb();
+        oc->set_face(f);
+        he = first;
+        do {
+          m_halfedges[he]->set_outer_ccb(oc);
+          he = m_next[he];
+        } while (he != first);
+        f->add_outer_ccb(oc, m_halfedges[first]);
+      }
+    }
+  }
+
+  /*! Compare two curves that are defined immediately to the left of a
+   * given x-coordinate, and are interior-disjoint.
+   * \param he1, he2 The halfedges of the curves directed from right to left.
+   * \pre The left endpoints of both curves lie strictly to the left of the
+   *      x-coordinate.
+   * \return SMALLER if he1 lies below he2 immediately to the left of the
+   *         x-coordinate; LARGER otherwise.
+   */
+  Comparison_result _compare_y_to_the_left(std::size_t he1,
+                                           std::size_t he2) const
+  {
+    auto compare_y_at_x = m_traits->compare_y_at_x_2_object();
+    auto cmp_y_right = m_traits->compare_y_at_x_right_2_object();
+
+    // Compare at the (lexicographically) larger of the two left endpoints. As
+    // the curves do not cross, they keep this order up to the x-coordinate.
+    const std::size_t v1 = m_targets[he1];
+    const std::size_t v2 = m_targets[he2];
+    if (v1 == v2) return cmp_y_right(curve(he1), curve(he2), point(v1));
+    if (m_ranks[v1] > m_ranks[v2]) return compare_y_at_x(point(v1), curve(he2));
+    return CGAL::opposite(compare_y_at_x(point(v2), curve(he1)));
+  }
+
+  /*! A functor that compares the curves of two halfedges that are directed
+   * from right to left, immediately to the left of the current position of
+   * the sweep in _locate_components().
+   */
+  class Curve_compare {
+    const Arr_noded_construction& m_construction;
+
+  public:
+    Curve_compare(const Arr_noded_construction& construction) :
+      m_construction(construction)
+    {}
+
+    Comparison_result operator()(std::size_t he1, std::size_t he2) const
+    {
+      if (he1 == he2) return EQUAL;
+      return m_construction._compare_y_to_the_left(he1, he2);
+    }
+  };
+
+  typedef Multiset<std::size_t, Curve_compare>          Status_line;
+  typedef typename Status_line::iterator                Status_iterator;
+
+  /*! Find the faces that contain the inner CCBs and the isolated vertices,
+   * and insert them into these faces.
+   */
+  void _locate_components(const std::vector<std::size_t>& lowest_halfedges,
+                          const std::vector<bool>& is_outer)
+  {
+    auto compare_y_at_x = m_traits->compare_y_at_x_2_object();
+
+    // The query vertices: the smallest vertices of the inner CCBs, and the
+    // isolated vertices. Each query is associated with the index of its
+    // cycle, or with the number of cycles plus the index of its vertex.
+    const std::size_t n_cycles = lowest_halfedges.size();
+    std::vector<std::size_t> queries;
+    for (std::size_t c = 0; c < n_cycles; ++c)
+      if (! is_outer[c]) queries.push_back(c);
+    for (std::size_t v : m_isolated) queries.push_back(n_cycles + v);
+    if (queries.empty()) return;
+
+    auto query_vertex = [&](std::size_t q) -> std::size_t
+    {
+      return (q < n_cycles) ? m_targets[lowest_halfedges[q]] : (q - n_cycles);
+    };
+
+    std::sort(queries.begin(), queries.end(),
+              [&](std::size_t q1, std::size_t q2) -> bool
+              {
+                return (m_ranks[query_vertex(q1)] < m_ranks[query_vertex(q2)]);
+              });
+
+    // The curves, represented by their halfedges directed from right to left
+    // (whose targets are their left endpoints), sorted by their left endpoints.
+    std::vector<std::size_t> curves;
+    curves.reserve(m_halfedges.size() / 2);
+    for (std::size_t he = 0; he < m_halfedges.size(); he += 2)
+      curves.push_back(is_to_the_right(he) ? he : he + 1);
+    std::sort(curves.begin(), curves.end(),
+              [&](std::size_t he1, std::size_t he2) -> bool
+              { return (m_ranks[m_targets[he1]] < m_ranks[m_targets[he2]]); });
+
+    // The curves sorted by their right endpoints.
+    std::vector<std::size_t> curves_by_right(curves);
+    std::sort(curves_by_right.begin(), curves_by_right.end(),
+              [&](std::size_t he1, std::size_t he2) -> bool
+              {
+                return (m_ranks[m_targets[he1 ^ 1]] <
+                        m_ranks[m_targets[he2 ^ 1]]);
+              });
+
+    // Sweep over the queries from left to right, maintaining the curves whose
+    // x-ranges contain the points immediately to the left of the query, sorted
+    // from bottom to top. The face that contains the query vertex is the face
+    // below the lowest such curve that lies above the vertex. The active
+    // curves are maintained by comparing the ranks of their endpoints with
+    // the rank of the query; this may also keep curves that start or end
+    // vertically below the query, which are not above it anyway. Vertical
+    // curves never lie above the points to the left of the query, and are
+    // not maintained.
+    auto is_vertical = m_traits->is_vertical_2_object();
+    Status_line active(Curve_compare(*this));
+    std::vector<Status_iterator> positions(curves.size());
+    std::vector<bool> is_active(curves.size(), false);
+    auto compare_to_curve = [&](std::size_t v, std::size_t he)
+                            { return compare_y_at_x(point(v), curve(he)); };
+
+    std::vector<std::size_t> above(queries.size(), invalid);
+    auto next_curve = curves.begin();
+    auto next_removed = curves_by_right.begin();
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      const std::size_t v = query_vertex(queries[i]);
+      const std::size_t rank = m_ranks[v];
+
+      // Remove the curves that lie to the left of the query.
+      while ((next_removed != curves_by_right.end()) &&
+             (m_ranks[m_targets[*next_removed ^ 1]] < rank))
+      {
+        const std::size_t c = *next_removed++ / 2;
+        if (is_active[c]) {
+          active.erase(positions[c]);
+          is_active[c] = false;
+        }
+      }
+
+      // Insert the curves that start to the left of the query, and end at it
+      // or to its right.
+      while ((next_curve != curves.end()) &&
+             (m_ranks[m_targets[*next_curve]] < rank))
+      {
+        const std::size_t he = *next_curve++;
+        if ((m_ranks[m_targets[he ^ 1]] < rank) || is_vertical(curve(he)))
+          continue;
+        positions[he / 2] = active.insert(he);
+        is_active[he / 2] = true;
+      }
+
+      Status_iterator it = active.upper_bound(v, compare_to_curve);
+      if (it != active.end()) above[i] = *it;
+    }
+
+    // Resolve the faces of the inner CCBs, following the chains of CCBs lying
+    // above each other until an outer CCB (or the unbounded face) is reached.
+    // In a planar arrangement, the components not enclosed by any curve lie
+    // in the reference face.
+    DFace* unbounded_face = m_arr.topology_traits()->reference_face();
+    std::vector<DFace*> faces(n_cycles, nullptr);
+    std::vector<std::size_t> above_cycles(n_cycles, invalid);
+    for (std::size_t i = 0; i < queries.size(); ++i)
+      if ((queries[i] < n_cycles) && (above[i] != invalid))
+        above_cycles[queries[i]] = m_cycles[above[i]];
+
+    std::vector<std::size_t> path;
+    auto face_of_cycle = [&](std::size_t c) -> DFace*
+    {
+      path.clear();
+      while ((faces[c] == nullptr) && ! is_outer[c] &&
+             (above_cycles[c] != invalid))
+      {
+        path.push_back(c);
+        c = above_cycles[c];
+      }
+      DFace* f = (faces[c] != nullptr) ? faces[c] :
+        (is_outer[c] ? m_halfedges[lowest_halfedges[c]]->outer_ccb()->face() :
+         unbounded_face);
+      faces[c] = f;
+      for (std::size_t k : path) faces[k] = f;
+      return f;
+    };
+
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      DFace* f = (above[i] == invalid) ? unbounded_face :
+        face_of_cycle(m_cycles[above[i]]);
+
+      if (queries[i] < n_cycles) {
+        // Insert the inner CCB into the face.
+        const std::size_t c = queries[i];
+        faces[c] = f;
+        DInner_ccb* ic = m_arr_access.new_inner_ccb();
+        ic->set_face(f);
+        const std::size_t first = lowest_halfedges[c];
+        std::size_t he = first;
+        do {
+          m_halfedges[he]->set_inner_ccb(ic);
+          he = m_next[he];
+        } while (he != first);
+        f->add_inner_ccb(ic, m_halfedges[first]);
+      }
+      else {
+        // Insert the isolated vertex into the face.
+        DVertex* v = m_vertices[queries[i] - n_cycles];
+        DIso_vertex* iv = m_arr_access.new_isolated_vertex();
+        iv->set_face(f);
+        v->set_isolated_vertex(iv);
+        f->add_isolated_vertex(iv, v);
+      }
+    }
+  }
+};
+
+} // namespace CGAL
+
+#endif
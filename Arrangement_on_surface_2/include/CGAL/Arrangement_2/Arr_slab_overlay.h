@@ -0,0 +1,588 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_SLAB_OVERLAY_H
+#define CGAL_ARR_SLAB_OVERLAY_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+/*! \file
+ * Definition of the Arr_slab_overlay class-template.
+ */
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <variant>
+#include <unordered_map>
+
+#include <boost/range/irange.hpp>
+
+#include <CGAL/assertions.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Arr_accessor.h>
+#include <CGAL/Arrangement_2/Arr_noded_construction.h>
+#include <CGAL/Surface_sweep_2.h>
+#include <CGAL/Surface_sweep_2/Slab_partition.h>
+#include <CGAL/Surface_sweep_2/Arr_overlay_traits_2.h>
+#include <CGAL/Surface_sweep_2/Arr_overlay_slab_visitor.h>
+
+namespace CGAL {
+
+/*! \class
+ * A class that computes the overlay of two planar arrangements of bounded
+ * curves, sweeping the slabs of a vertical partition concurrently.
+ *
+ * Every slab reports the vertices of the overlay that it contains, together
+ * with the red and blue cells that contain them and the input edges incident
+ * to them (see Arr_overlay_slab_visitor). Concatenating the reports of the
+ * slabs yields all the overlay vertices in xy-lexicographic order, so the
+ * vertices along every input edge are obtained by distributing them among
+ * the edges. Consecutive vertices along an edge bound an overlay edge, whose
+ * curve is obtained by splitting the input curve; a red edge and a blue edge
+ * that overlap yield the same overlay edge.
+ *
+ * The DCEL of the result is then constructed directly from the overlay
+ * vertices and edges (see Arr_noded_construction). Finally, the red face and
+ * the blue face that contain every overlay face are found by propagating
+ * them across the overlay edges that do not originate from a red edge (resp.
+ * a blue edge), and the overlay traits is notified about all the vertices,
+ * edges, and faces of the result.
+ */
+template <typename ArrangementRed_2, typename ArrangementBlue_2,
+          typename ArrangementRes_2, typename OverlayTraits>
+class Arr_slab_overlay {
+public:
+  typedef ArrangementRed_2                              Arrangement_red_2;
+  typedef ArrangementBlue_2                             Arrangement_blue_2;
+  typedef ArrangementRes_2                              Arrangement_res_2;
+  typedef OverlayTraits                                 Overlay_traits;
+
+  typedef typename Arrangement_res_2::Geometry_traits_2 Geometry_traits_2;
+  typedef Arr_traits_basic_adaptor_2<Geometry_traits_2> Gt_adaptor_2;
+  typedef Arr_overlay_traits_2<Gt_adaptor_2, Arrangement_red_2,
+                               Arrangement_blue_2>      Ovl_gt2;
+
+  typedef typename Ovl_gt2::X_monotone_curve_2          Ovl_x_monotone_curve_2;
+  typedef typename Ovl_gt2::Point_2                     Ovl_point_2;
+
+private:
+  typedef Arrangement_red_2                             Arr_red;
+  typedef Arrangement_blue_2                            Arr_blue;
+  typedef Arrangement_res_2                             Arr_res;
+
+  typedef typename Gt_adaptor_2::Point_2                Point_2;
+  typedef typename Gt_adaptor_2::X_monotone_curve_2     X_monotone_curve_2;
+
+  typedef typename Ovl_gt2::Halfedge_handle_red         Halfedge_handle_red;
+  typedef typename Ovl_gt2::Halfedge_handle_blue        Halfedge_handle_blue;
+  typedef typename Ovl_gt2::Vertex_handle_red           Vertex_handle_red;
+  typedef typename Ovl_gt2::Vertex_handle_blue          Vertex_handle_blue;
+  typedef typename Ovl_gt2::Face_handle_red             Face_handle_red;
+  typedef typename Ovl_gt2::Face_handle_blue            Face_handle_blue;
+  typedef typename Ovl_gt2::Cell_handle_red             Cell_handle_red;
+  typedef typename Ovl_gt2::Cell_handle_blue            Cell_handle_blue;
+
+  typedef typename Arr_res::Vertex_handle               Vertex_handle;
+  typedef typename Arr_res::Halfedge_handle             Halfedge_handle;
+  typedef typename Arr_res::Face_handle                 Face_handle;
+
+  typedef Arr_overlay_slab_visitor<Ovl_gt2>             Slab_visitor;
+  typedef Surface_sweep_2::Surface_sweep_2<Slab_visitor>
+                                                        Slab_surface_sweep;
+  typedef Surface_sweep_2::Slab_partition<Ovl_gt2>      Slab_partition;
+
+  typedef std::unordered_map<const void*, std::size_t>  Edge_index_map;
+
+  static constexpr std::size_t invalid =
+    (std::numeric_limits<std::size_t>::max)();
+
+  // Data members:
+  const Arr_red&               m_red_arr;
+  const Arr_blue&              m_blue_arr;
+  Arr_res&                     m_arr;
+  Overlay_traits&              m_overlay_traits;
+  const Ovl_gt2&               m_traits;
+
+  // The input edges are indexed as the given x-monotone curves.
+  std::size_t                  m_n_red;         // The number of red edges.
+  Edge_index_map               m_red_index;     // The red edge indices.
+  Edge_index_map               m_blue_index;    // The blue edge indices.
+  std::vector<Halfedge_handle_red>  m_red_halfedges;
+  std::vector<Halfedge_handle_blue> m_blue_halfedges;
+
+  // The overlay vertices are indexed in xy-lexicographic order.
+  std::vector<Ovl_point_2>     m_nodes;         // The overlay vertices.
+  std::vector<std::size_t>     m_edge_offsets;  // The vertices along the i-th
+                                                // input edge are in
+                                                // [m_edge_offsets[i],
+                                                // m_edge_offsets[i+1]) of
+                                                // m_edge_nodes.
+  std::vector<std::size_t>     m_edge_nodes;
+
+  // The overlay edges, directed from left to right.
+  std::vector<std::pair<std::size_t, std::size_t> > m_edges;
+  std::vector<X_monotone_curve_2> m_curves;
+  std::vector<std::size_t>     m_red_edges;     // The originating red edges.
+  std::vector<std::size_t>     m_blue_edges;    // The originating blue edges.
+
+  /*! \class
+   * A visitor class to facilitate the call to create_vertex().
+   */
+  class Create_vertex_visitor {
+  private:
+    Overlay_traits* m_overlay_traits;
+    Vertex_handle m_vertex_handle;
+
+  public:
+    /*! Constructor */
+    Create_vertex_visitor(Overlay_traits* overlay_traits,
+                          Vertex_handle vertex_handle) :
+      m_overlay_traits(overlay_traits),
+      m_vertex_handle(vertex_handle)
+    {}
+
+    void operator()(const Vertex_handle_red& red_v,
+                    const Vertex_handle_blue& blue_v) const
+    { m_overlay_traits->create_vertex(red_v, blue_v, m_vertex_handle); }
+
+    void operator()(const Halfedge_handle_red& red_he,
+                    const Vertex_handle_blue& blue_v) const
+    { m_overlay_traits->create_vertex(red_he, blue_v, m_vertex_handle); }
+
+    void operator()(const Face_handle_red& red_f,
+                    const Vertex_handle_blue& blue_v) const
+    { m_overlay_traits->create_vertex(red_f, blue_v, m_vertex_handle); }
+
+    void operator()(const Vertex_handle_red& red_v,
+                    const Halfedge_handle_blue& blue_he) const
+    { m_overlay_traits->create_vertex(red_v, blue_he, m_vertex_handle); }
+
+    void operator()(const Vertex_handle_red& red_v,
+                    const Face_handle_blue& blue_f) const
+    { m_overlay_traits->create_vertex(red_v, blue_f, m_vertex_handle); }
+
+    void operator()(const Halfedge_handle_red& red_he,
+                    const Halfedge_handle_blue& blue_he) const
+    { m_overlay_traits->create_vertex(red_he, blue_he, m_vertex_handle); }
+
+    /* The following functions should never be called */
+    void operator()(const Halfedge_handle_red& /* red_he */,
+                    const Face_handle_blue& /* blue_f */) const
+    { CGAL_error(); }
+    void operator()(const Face_handle_red& /* red_f */,
+                    const Halfedge_handle_blue& /* blue_he */) const
+    { CGAL_error(); }
+    void operator()(const Face_handle_red& /* red_f */,
+                    const Face_handle_blue& /* blue_f */) const
+    { CGAL_error(); }
+  };
+
+private:
+  // Copy constructor and assignment operator - not supported.
+  Arr_slab_overlay(const Arr_slab_overlay&);
+  Arr_slab_overlay& operator=(const Arr_slab_overlay&);
+
+public:
+  /*! Constructor.
+   * \param red_arr The red arrangement.
+   * \param blue_arr The blue arrangement.
+   * \param arr The result arrangement.
+   * \param overlay_traits The overlay traits.
+   * \param traits The overlay geometry traits.
+   */
+  Arr_slab_overlay(const Arr_red& red_arr, const Arr_blue& blue_arr,
+                   Arr_res& arr, Overlay_traits& overlay_traits,
+                   const Ovl_gt2& traits) :
+    m_red_arr(red_arr),
+    m_blue_arr(blue_arr),
+    m_arr(arr),
+    m_overlay_traits(overlay_traits),
+    m_traits(traits),
+    m_n_red(0)
+  {}
+
+  /*! Compute the overlay.
+   * \param xcvs The curves of the red edges followed by the curves of the
+   *        blue edges, each associated with its halfedge directed from right
+   *        to left.
+   * \param pts The points of the red and blue isolated vertices.
+   * \param number_of_slabs The requested number of slabs.
+   */
+  void operator()(const std::vector<Ovl_x_monotone_curve_2>& xcvs,
+                  const std::vector<Ovl_point_2>& pts,
+                  std::size_t number_of_slabs)
+  {
+    _index_edges(xcvs);
+    _sweep_slabs(xcvs, pts, number_of_slabs);
+    _split_edges(xcvs);
+
+    // Construct the DCEL of the result.
+    Arr_accessor<Arr_res> arr_access(m_arr);
+    m_arr.clear();
+    arr_access.notify_before_global_change();
+
+    std::vector<Point_2> points;
+    points.reserve(m_nodes.size());
+    for (const Ovl_point_2& p : m_nodes) points.push_back(p.base());
+    Arr_noded_construction<Arr_res> construct(m_arr);
+    construct(points, m_edges, m_curves);
+
+    _notify_overlay_traits(construct);
+    arr_access.notify_after_global_change();
+  }
+
+private:
+  /*! Index the red and blue edges by their halfedges. */
+  void _index_edges(const std::vector<Ovl_x_monotone_curve_2>& xcvs)
+  {
+    m_red_index.reserve(m_red_arr.number_of_edges());
+    m_blue_index.reserve(m_blue_arr.number_of_edges());
+    for (std::size_t i = 0; i < xcvs.size(); ++i) {
+      const Ovl_x_monotone_curve_2& xcv = xcvs[i];
+      if (xcv.red_halfedge_handle() != Halfedge_handle_red()) {
+        CGAL_assertion(i == m_n_red);
+        m_red_index[&(*xcv.red_halfedge_handle())] = i;
+        m_red_halfedges.push_back(xcv.red_halfedge_handle());
+        ++m_n_red;
+      }
+      else {
+        m_blue_index[&(*xcv.blue_halfedge_handle())] = i;
+        m_blue_halfedges.push_back(xcv.blue_halfedge_handle());
+      }
+    }
+  }
+
+  /*! Sweep the slabs, and obtain the overlay vertices and the overlay
+   * vertices along every input edge.
+   */
+  void _sweep_slabs(const std::vector<Ovl_x_monotone_curve_2>& xcvs,
+                    const std::vector<Ovl_point_2>& pts,
+                    std::size_t number_of_slabs)
+  {
+    Slab_partition partition(&m_traits, xcvs.begin(), xcvs.end(),
+                             number_of_slabs);
+    std::vector<std::vector<Ovl_x_monotone_curve_2> > slab_xcvs;
+    std::vector<std::vector<Ovl_point_2> > slab_pts;
+    partition.distribute(xcvs.begin(), xcvs.end(), pts.begin(), pts.end(),
+                         slab_xcvs, slab_pts);
+
+    // Every slab reports its vertices, and the input edges incident to each
+    // (sorted and without duplicates).
+    const std::size_t n_slabs = partition.number_of_slabs();
+    std::vector<std::vector<Ovl_point_2> > slab_nodes(n_slabs);
+    std::vector<std::vector<std::size_t> > slab_offsets(n_slabs);
+    std::vector<std::vector<std::size_t> > slab_edges(n_slabs);
+    CGAL::for_each<Parallel_tag>
+      (boost::irange<std::size_t>(0, n_slabs),
+       [&](std::size_t i) -> bool
+       {
+         // Every slab is swept with its own copy of the traits, as some
+         // traits (e.g., the conic traits) cache intersections internally.
+         Gt_adaptor_2 slab_base_tr(*m_traits.base_traits());
+         Ovl_gt2 slab_tr(slab_base_tr);
+         Slab_visitor visitor(partition, i);
+         Slab_surface_sweep surface_sweep(&slab_tr, &visitor);
+         surface_sweep.sweep(slab_xcvs[i].begin(), slab_xcvs[i].end(),
+                             slab_pts[i].begin(), slab_pts[i].end());
+         slab_xcvs[i].clear();
+
+         const std::vector<std::size_t>& offsets = visitor.offsets();
+         const auto& halfedges = visitor.halfedges();
+         std::vector<std::size_t>& edges = slab_edges[i];
+         slab_offsets[i].push_back(0);
+         for (std::size_t k = 0; k + 1 < offsets.size(); ++k) {
+           const std::size_t first = edges.size();
+           for (std::size_t j = offsets[k]; j < offsets[k + 1]; ++j) {
+             if (halfedges[j].first != Halfedge_handle_red())
+               edges.push_back(m_red_index.find(&(*halfedges[j].first))->
+                               second);
+             if (halfedges[j].second != Halfedge_handle_blue())
+               edges.push_back(m_blue_index.find(&(*halfedges[j].second))->
+                               second);
+           }
+           std::sort(edges.begin() + first, edges.end());
+           edges.erase(std::unique(edges.begin() + first, edges.end()),
+                       edges.end());
+           slab_offsets[i].push_back(edges.size());
+         }
+         slab_nodes[i] = std::move(visitor.nodes());
+         return true;
+       });
+
+    // Concatenate the vertices of the slabs, and distribute them among the
+    // edges. As the vertices are visited in xy-lexicographic order, the
+    // vertices along every edge are sorted.
+    m_edge_offsets.assign(xcvs.size() + 1, 0);
+    for (const std::vector<std::size_t>& edges : slab_edges)
+      for (std::size_t e : edges) ++m_edge_offsets[e + 1];
+    for (std::size_t e = 0; e < xcvs.size(); ++e)
+      m_edge_offsets[e + 1] += m_edge_offsets[e];
+    m_edge_nodes.resize(m_edge_offsets.back());
+
+    std::vector<std::size_t> next(m_edge_offsets.begin(),
+                                  m_edge_offsets.end() - 1);
+    for (std::size_t i = 0; i < n_slabs; ++i) {
+      const std::vector<std::size_t>& offsets = slab_offsets[i];
+      for (std::size_t k = 0; k < slab_nodes[i].size(); ++k) {
+        const std::size_t v = m_nodes.size();
+        m_nodes.push_back(std::move(slab_nodes[i][k]));
+        for (std::size_t j = offsets[k]; j < offsets[k + 1]; ++j)
+          m_edge_nodes[next[slab_edges[i][j]]++] = v;
+      }
+      slab_nodes[i].clear();
+    }
+  }
+
+  /*! Split the input edges at the overlay vertices along them, and merge
+   * the pieces of overlapping red and blue edges.
+   */
+  void _split_edges(const std::vector<Ovl_x_monotone_curve_2>& xcvs)
+  {
+    // The i-th edge, which has k vertices along it, is split into the k-1
+    // pieces that start at m_edge_offsets[i] - i.
+    const std::size_t n_edges = xcvs.size();
+    const std::size_t n_pieces = m_edge_nodes.size() - n_edges;
+    std::vector<X_monotone_curve_2> curves(n_pieces);
+    CGAL::for_each<Parallel_tag>
+      (boost::irange<std::size_t>(0, n_edges),
+       [&](std::size_t i) -> bool
+       {
+         const std::size_t first = m_edge_offsets[i];
+         const std::size_t last = m_edge_offsets[i + 1] - 1;
+         CGAL_assertion(first < last);
+         std::size_t p = first - i;
+         X_monotone_curve_2 xcv = xcvs[i].base();
+         X_monotone_curve_2 right;
+         Gt_adaptor_2 tr(*m_traits.base_traits());
+         auto split = tr.split_2_object();
+         for (std::size_t j = first + 1; j < last; ++j, ++p) {
+           split(xcv, m_nodes[m_edge_nodes[j]].base(), curves[p], right);
+           xcv = right;
+         }
+         curves[p] = xcv;
+         return true;
+       });
+
+    // Group the pieces by their left vertex, and look for a blue piece that
+    // overlaps every red piece. The red pieces precede the blue pieces in
+    // every group.
+    std::vector<std::size_t> piece_edges(n_pieces);
+    std::vector<std::size_t> group_offsets(m_nodes.size() + 1, 0);
+    for (std::size_t i = 0; i < n_edges; ++i) {
+      for (std::size_t j = m_edge_offsets[i]; j + 1 < m_edge_offsets[i + 1];
+           ++j)
+      {
+        piece_edges[j - i] = i;
+        ++group_offsets[m_edge_nodes[j] + 1];
+      }
+    }
+    for (std::size_t v = 0; v < m_nodes.size(); ++v)
+      group_offsets[v + 1] += group_offsets[v];
+    std::vector<std::size_t> groups(n_pieces);
+    std::vector<std::size_t> next(group_offsets.begin(),
+                                  group_offsets.end() - 1);
+    for (std::size_t p = 0; p < n_pieces; ++p) {
+      const std::size_t i = piece_edges[p];
+      groups[next[m_edge_nodes[p + i]]++] = p;
+    }
+
+    auto equal = m_traits.base_traits()->equal_2_object();
+    std::vector<bool> is_merged(n_pieces, false);
+    m_edges.reserve(n_pieces);
+    m_curves.reserve(n_pieces);
+    m_red_edges.reserve(n_pieces);
+    m_blue_edges.reserve(n_pieces);
+    for (std::size_t v = 0; v < m_nodes.size(); ++v) {
+      for (std::size_t g = group_offsets[v]; g < group_offsets[v + 1]; ++g) {
+        const std::size_t p = groups[g];
+        if (is_merged[p]) continue;
+
+        const std::size_t i = piece_edges[p];
+        const std::size_t trg = m_edge_nodes[p + i + 1];
+        std::size_t red_e = invalid;
+        std::size_t blue_e = invalid;
+        if (i < m_n_red) {
+          red_e = i;
+          for (std::size_t h = g + 1; h < group_offsets[v + 1]; ++h) {
+            const std::size_t q = groups[h];
+            const std::size_t k = piece_edges[q];
+            if ((k >= m_n_red) && ! is_merged[q] &&
+                (m_edge_nodes[q + k + 1] == trg) && equal(curves[p], curves[q]))
+            {
+              blue_e = k;
+              is_merged[q] = true;
+              break;
+            }
+          }
+        }
+        else blue_e = i;
+
+        m_edges.push_back(std::make_pair(v, trg));
+        m_curves.push_back(std::move(curves[p]));
+        m_red_edges.push_back(red_e);
+        m_blue_edges.push_back(blue_e);
+      }
+    }
+  }
+
+  /*! Find the red (or blue) faces that contain the faces of the result.
+   * \param construct The construction of the result DCEL.
+   * \param faces The indices of the result faces.
+   * \param n_faces The number of result faces.
+   * \param edges The originating edges of the overlay edges.
+   * \param halfedge The halfedge of an originating edge, directed from right
+   *        to left.
+   * \param unbounded_face The unbounded face.
+   * \param labels Output: the red (or blue) face of every result face.
+   */
+  template <typename Construct, typename HalfedgeFunction,
+            typename InputFaceHandle>
+  void _label_faces(const Construct& construct,
+                    const std::unordered_map<const void*, std::size_t>& faces,
+                    std::size_t n_faces,
+                    const std::vector<std::size_t>& edges,
+                    HalfedgeFunction halfedge,
+                    InputFaceHandle unbounded_face,
+                    std::vector<InputFaceHandle>& labels) const
+  {
+    // Merge the faces separated by overlay edges that do not originate from
+    // an edge of the given color.
+    std::vector<std::size_t> parents(n_faces);
+    for (std::size_t f = 0; f < n_faces; ++f) parents[f] = f;
+    auto find = [&](std::size_t f) -> std::size_t
+    {
+      while (parents[f] != f) f = parents[f] = parents[parents[f]];
+      return f;
+    };
+
+    auto face_index = [&](Halfedge_handle he) -> std::size_t
+    { return faces.find(&(*he->face()))->second; };
+
+    for (std::size_t i = 0; i < m_edges.size(); ++i) {
+      if (edges[i] != invalid) continue;
+      Halfedge_handle he(construct.halfedge(i));
+      const std::size_t f1 = find(face_index(he));
+      const std::size_t f2 = find(face_index(he->twin()));
+      if (f1 != f2) parents[f1] = f2;
+    }
+
+    // The remaining overlay edges are directed from left to right, whereas
+    // the input halfedges are directed from right to left.
+    labels.assign(n_faces, InputFaceHandle());
+    std::vector<bool> is_labeled(n_faces, false);
+    auto set_label = [&](std::size_t f, InputFaceHandle label)
+    {
+      f = find(f);
+      CGAL_assertion(! is_labeled[f] || (labels[f] == label));
+      labels[f] = label;
+      is_labeled[f] = true;
+    };
+    for (std::size_t i = 0; i < m_edges.size(); ++i) {
+      if (edges[i] == invalid) continue;
+      Halfedge_handle he(construct.halfedge(i));
+      auto input_he = halfedge(edges[i]);
+      set_label(face_index(he), input_he->twin()->face());
+      set_label(face_index(he->twin()), input_he->face());
+    }
+    set_label(faces.find(&(*_unbounded_face(m_arr)))->second, unbounded_face);
+
+    for (std::size_t f = 0; f < n_faces; ++f) {
+      CGAL_assertion(is_labeled[find(f)]);
+      labels[f] = labels[find(f)];
+    }
+  }
+
+  /*! Notify the overlay traits about the vertices, edges, and faces of the
+   * result.
+   */
+  template <typename Construct>
+  void _notify_overlay_traits(const Construct& construct)
+  {
+    // Index the result faces, and find the red and blue faces that contain
+    // them.
+    std::unordered_map<const void*, std::size_t> faces;
+    std::vector<Face_handle> res_faces;
+    for (auto fit = m_arr.faces_begin(); fit != m_arr.faces_end(); ++fit) {
+      faces[&(*fit)] = res_faces.size();
+      res_faces.push_back(fit);
+    }
+
+    std::vector<Face_handle_red> red_faces;
+    std::vector<Face_handle_blue> blue_faces;
+    _label_faces(construct, faces, res_faces.size(), m_red_edges,
+                 [&](std::size_t e) { return _red_halfedge(e); },
+                 _unbounded_face(m_red_arr), red_faces);
+    _label_faces(construct, faces, res_faces.size(), m_blue_edges,
+                 [&](std::size_t e) { return _blue_halfedge(e); },
+                 _unbounded_face(m_blue_arr), blue_faces);
+
+    // Notify about the vertices. A vertex that lies in a red face (or in a
+    // blue face) lies in all its incident result faces.
+    for (std::size_t v = 0; v < m_nodes.size(); ++v) {
+      Vertex_handle vh(construct.vertex(v));
+      const std::size_t f = (vh->is_isolated()) ?
+        faces.find(&(*vh->face()))->second :
+        faces.find(&(*vh->incident_halfedges()->face()))->second;
+
+      const Cell_handle_red* red_cell = m_nodes[v].red_cell_handle();
+      const Cell_handle_blue* blue_cell = m_nodes[v].blue_cell_handle();
+      const Cell_handle_red red_handle = (red_cell != nullptr) ?
+        *red_cell : Cell_handle_red(red_faces[f]);
+      const Cell_handle_blue blue_handle = (blue_cell != nullptr) ?
+        *blue_cell : Cell_handle_blue(blue_faces[f]);
+      Create_vertex_visitor visitor(&m_overlay_traits, vh);
+      std::visit(visitor, red_handle, blue_handle);
+    }
+
+    // Notify about the edges, using their halfedges directed from right to
+    // left.
+    for (std::size_t i = 0; i < m_edges.size(); ++i) {
+      Halfedge_handle he = Halfedge_handle(construct.halfedge(i))->twin();
+      const std::size_t f = faces.find(&(*he->face()))->second;
+      if (m_red_edges[i] == invalid)
+        m_overlay_traits.create_edge(red_faces[f],
+                                     _blue_halfedge(m_blue_edges[i]), he);
+      else if (m_blue_edges[i] == invalid)
+        m_overlay_traits.create_edge(_red_halfedge(m_red_edges[i]),
+                                     blue_faces[f], he);
+      else
+        m_overlay_traits.create_edge(_red_halfedge(m_red_edges[i]),
+                                     _blue_halfedge(m_blue_edges[i]), he);
+    }
+
+    // Notify about the faces.
+    for (std::size_t f = 0; f < res_faces.size(); ++f)
+      m_overlay_traits.create_face(red_faces[f], blue_faces[f], res_faces[f]);
+  }
+
+  /*! Obtain the halfedge of a red edge, directed from right to left. */
+  Halfedge_handle_red _red_halfedge(std::size_t e) const
+  { return m_red_halfedges[e]; }
+
+  /*! Obtain the halfedge of a blue edge, directed from right to left. */
+  Halfedge_handle_blue _blue_halfedge(std::size_t e) const
+  { return m_blue_halfedges[e - m_n_red]; }
+
+  /*! Obtain the unbounded face of an arrangement. */
+  template <typename Arrangement>
+  static auto _unbounded_face(Arrangement& arr) -> decltype(arr.faces_begin())
+  {
+    auto fit = arr.faces_begin();
+    while (! fit->is_unbounded()) ++fit;
+    return fit;
+  }
+};
+
+} // namespace CGAL
+
+#endif
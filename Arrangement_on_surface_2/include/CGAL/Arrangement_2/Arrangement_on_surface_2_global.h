@@ -22,6 +22,7 @@
  */
 
 #include <list>
+#include <type_traits>
 #include <boost/type_traits.hpp>
 #include <list>
 
@@ -30,6 +31,7 @@
 #include <CGAL/Arrangement_2/Arr_compute_zone_visitor.h>
 #include <CGAL/Arrangement_2/Arr_do_intersect_zone_visitor.h>
 #include <CGAL/Arrangement_2/Arr_traits_adaptor_2.h>
+#include <CGAL/Arrangement_2/Arr_noded_construction.h>
 #include <CGAL/Arr_point_location_result.h>
 #include <CGAL/No_intersection_surface_sweep_2.h>
 #include <CGAL/Surface_sweep_2/Arr_insertion_ss_visitor.h>
@@ -1036,6 +1038,48 @@ void insert_non_intersecting_curves
   arr_access.notify_after_global_change();
 }
 
+//-----------------------------------------------------------------------------
+// Construct an arrangement from a set of noded curves, given as pairs of
+// indices into a range of points, building the DCEL directly (without
+// sweeping). The curves must be pairwise interior-disjoint, and their
+// interiors must not contain any of the points.
+//
+template <typename GeometryTraits_2, typename TopologyTraits,
+          typename PointRange, typename EdgeRange>
+void insert_noded_curves
+(Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
+ const PointRange& points, const EdgeRange& edges)
+{
+  typedef GeometryTraits_2                              Gt2;
+  typedef TopologyTraits                                Tt;
+
+  typedef Arrangement_on_surface_2<Gt2, Tt>             Arr;
+
+  // The DCEL is built for a planar arrangement of bounded curves, whose
+  // components not enclosed by any curve lie in the unbounded face.
+  static_assert(std::is_same<typename Arr::Are_all_sides_oblivious_category,
+                             Arr_all_sides_oblivious_tag>::value,
+                "insert_noded_curves() supports only arrangements whose "
+                "sides are all oblivious.");
+
+  CGAL_precondition_msg(arr.is_empty(),
+                        "The arrangement must be empty.");
+
+  // Obtain an arrangement accessor.
+  Arr_accessor<Arr> arr_access(arr);
+
+  // Notify the arrangement observers that a global operation is about to
+  // take place.
+  arr_access.notify_before_global_change();
+
+  Arr_noded_construction<Arr> construct(arr);
+  construct(points, edges);
+
+  // Notify the arrangement observers that the global operation has been
+  // completed.
+  arr_access.notify_after_global_change();
+}
+
 //-----------------------------------------------------------------------------
 // Remove an edge from the arrangement. In case it is possible to merge
 // the edges incident to the end-vertices of the removed edge after its
@@ -2965,6 +2965,23 @@ void insert_non_intersecting_curves
 (Arrangement_on_surface_2<GeomTraits, TopTraits>& arr,
  InputIterator begin, InputIterator end);
 
+/*!
+ * Construct an arrangement from a set of noded curves, given as pairs of
+ * indices into a range of points. The DCEL is built directly, without
+ * sweeping.
+ * \param arr The arrangement.
+ * \param points The points.
+ * \param edges The curves, given as pairs of indices of their endpoints.
+ * \pre The arrangement is empty, and all its sides are oblivious. The
+ *      curves are pairwise interior-disjoint, and their interiors do not
+ *      contain any point.
+ */
+template <typename GeomTraits, typename TopTraits,
+          typename PointRange, typename EdgeRange>
+void insert_noded_curves
+(Arrangement_on_surface_2<GeomTraits, TopTraits>& arr,
+ const PointRange& points, const EdgeRange& edges);
+
 /*!
  * Remove an edge from the arrangement. In case it is possible to merge
  * the edges incident to the end-vertices of the removed edge after its
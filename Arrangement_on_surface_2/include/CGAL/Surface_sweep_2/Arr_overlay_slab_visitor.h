@@ -0,0 +1,194 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_OVERLAY_SLAB_VISITOR_H
+#define CGAL_ARR_OVERLAY_SLAB_VISITOR_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+/*! \file
+ *
+ * Definition of the Arr_overlay_slab_visitor class-template.
+ */
+
+#include <vector>
+#include <utility>
+#include <optional>
+
+#include <CGAL/Surface_sweep_2/Default_visitor.h>
+#include <CGAL/Surface_sweep_2/Slab_partition.h>
+
+namespace CGAL {
+
+/*! \class Arr_overlay_slab_visitor
+ *
+ * A surface-sweep visitor that computes the vertices of the overlay of a
+ * "red" arrangement and a "blue" arrangement within a single slab of a
+ * vertical partition, without constructing any arrangement.
+ * The visitor records, in increasing xy-lexicographical order, every event
+ * that lies in its slab, together with the red and blue cells that contain
+ * the event point and the red and blue halfedges incident to it.
+ * The geometry traits must be an instance of Arr_overlay_traits_2.
+ */
+template <typename OverlayTraits_2, typename Allocator_ = CGAL_ALLOCATOR(int)>
+class Arr_overlay_slab_visitor :
+  public Surface_sweep_2::Default_visitor<
+    Arr_overlay_slab_visitor<OverlayTraits_2, Allocator_>,
+    OverlayTraits_2, Allocator_>
+{
+public:
+  typedef OverlayTraits_2                               Geometry_traits_2;
+  typedef Allocator_                                    Allocator;
+
+private:
+  typedef Geometry_traits_2                             Gt2;
+  typedef Arr_overlay_slab_visitor<Gt2, Allocator>      Self;
+  typedef Surface_sweep_2::Default_visitor<Self, Gt2, Allocator>
+                                                        Base;
+
+public:
+  typedef typename Base::Event                          Event;
+  typedef typename Base::Subcurve                       Subcurve;
+  typedef typename Subcurve::Status_line_iterator       Status_line_iterator;
+
+  typedef typename Gt2::X_monotone_curve_2              X_monotone_curve_2;
+  typedef typename Gt2::Point_2                         Point_2;
+
+  typedef typename Gt2::Halfedge_handle_red             Halfedge_handle_red;
+  typedef typename Gt2::Halfedge_handle_blue            Halfedge_handle_blue;
+  typedef typename Gt2::Cell_handle_red                 Cell_handle_red;
+  typedef typename Gt2::Cell_handle_blue                Cell_handle_blue;
+
+  typedef std::pair<Halfedge_handle_red, Halfedge_handle_blue>
+                                                        Halfedge_pair;
+  typedef Surface_sweep_2::Slab_partition<Gt2>          Slab_partition;
+
+protected:
+  const Slab_partition& m_partition;    // The vertical partition.
+  std::size_t m_slab;                   // The index of the slab.
+
+  std::vector<Point_2> m_nodes;         // The events in the slab.
+  std::vector<std::size_t> m_offsets;   // The incident halfedges of the i-th
+                                        // node are in [m_offsets[i],
+                                        // m_offsets[i+1]) of m_halfedges.
+  std::vector<Halfedge_pair> m_halfedges;
+
+public:
+  /*! Constructor.
+   * \param partition The vertical partition.
+   * \param slab The index of the slab swept by the visitor.
+   */
+  Arr_overlay_slab_visitor(const Slab_partition& partition, std::size_t slab) :
+    m_partition(partition),
+    m_slab(slab),
+    m_offsets(1, 0)
+  {}
+
+  /// \name Sweep-line notifications.
+  //@{
+
+  /*! Record an event that lies in the slab. */
+  bool after_handle_event(Event* event,
+                          Status_line_iterator /* iter */,
+                          bool /* flag */)
+  {
+    CGAL_assertion(event->is_closed());
+    if (m_partition.slab(event->point()) != m_slab) return true;
+
+    m_nodes.push_back(event->point());
+    for (auto it = event->left_curves_begin();
+         it != event->left_curves_end(); ++it)
+      _add_halfedges((*it)->last_curve());
+    for (auto it = event->right_curves_begin();
+         it != event->right_curves_end(); ++it)
+      _add_halfedges((*it)->last_curve());
+    m_offsets.push_back(m_halfedges.size());
+    return true;
+  }
+
+  /*! Update the red and blue cells of an event given a curve end. */
+  void update_event(Event* e,
+                    const Point_2& end_point,
+                    const X_monotone_curve_2& /* cv */,
+                    Arr_curve_end /* cv_end */,
+                    bool /* is_new */)
+  { _merge_cells(e->point(), end_point); }
+
+  /*! Update the event to be the given infinite curve end. */
+  void update_event(Event* /* e */,
+                    const X_monotone_curve_2& /* cv */,
+                    Arr_curve_end /* cv_end */,
+                    bool /* is_new */)
+  { CGAL_error(); }
+
+  /*! Update an event that corresponds to an intersection between curves. */
+  void update_event(Event* /* e */,
+                    Subcurve* /* c1 */,
+                    Subcurve* /* c2 */,
+                    bool /* is_new */)
+  {}
+
+  /*! Update an event that lies in the interior of a subcurve. */
+  void update_event(Event* e, Subcurve* sc)
+  {
+    Point_2& pt = e->point();
+    const X_monotone_curve_2& xcv = sc->last_curve();
+    if (pt.is_red_cell_empty()) {
+      CGAL_assertion(xcv.red_halfedge_handle() != Halfedge_handle_red());
+      pt.set_red_cell(std::make_optional
+                      (Cell_handle_red(xcv.red_halfedge_handle())));
+    }
+    else if (pt.is_blue_cell_empty()) {
+      CGAL_assertion(xcv.blue_halfedge_handle() != Halfedge_handle_blue());
+      pt.set_blue_cell(std::make_optional
+                       (Cell_handle_blue(xcv.blue_halfedge_handle())));
+    }
+  }
+
+  /*! Update the red and blue cells of an event given an isolated point. */
+  void update_event(Event* e, const Point_2& p, bool /* is_new */)
+  { _merge_cells(e->point(), p); }
+  //@}
+
+  /// \name Access the recorded events.
+  //@{
+
+  /*! Obtain the events in the slab, sorted xy-lexicographically. */
+  std::vector<Point_2>& nodes() { return m_nodes; }
+
+  /*! Obtain the offsets of the incident halfedges of the events. */
+  std::vector<std::size_t>& offsets() { return m_offsets; }
+
+  /*! Obtain the (red, blue) pairs of halfedges incident to the events, where
+   * one of the two handles may be invalid. A halfedge may appear more than
+   * once among the pairs of the same event.
+   */
+  std::vector<Halfedge_pair>& halfedges() { return m_halfedges; }
+  //@}
+
+protected:
+  /*! Record the red and blue halfedges associated with a curve. */
+  void _add_halfedges(const X_monotone_curve_2& xcv)
+  {
+    m_halfedges.push_back(Halfedge_pair(xcv.red_halfedge_handle(),
+                                        xcv.blue_halfedge_handle()));
+  }
+
+  /*! Merge the red and blue cells of a point into those of an event. */
+  void _merge_cells(Point_2& pt, const Point_2& p)
+  {
+    if (pt.is_red_cell_empty()) pt.set_red_cell(p.red_cell());
+    else if (pt.is_blue_cell_empty()) pt.set_blue_cell(p.blue_cell());
+  }
+};
+
+} // namespace CGAL
+
+#endif
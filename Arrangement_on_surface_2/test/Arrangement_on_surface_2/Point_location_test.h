@@ -5,6 +5,7 @@
 #define SIMPLE_PL_ENABLED 1
 #define WALK_PL_ENABLED 1
 #define LM_PL_ENABLED 1
+#define LM_DYNAMIC_PL_ENABLED 1
 #define LM_RANDOM_PL_ENABLED 1
 #define LM_GRID_PL_ENABLED 1
 #define LM_HALTON_PL_ENABLED 1
@@ -23,6 +24,7 @@
 #include <CGAL/Arr_walk_along_line_point_location.h>
 #include <CGAL/Arr_landmarks_point_location.h>
 #include <CGAL/Arr_trapezoid_ric_point_location.h>
+#include <CGAL/Arr_point_location/Arr_lm_dynamic_vertices_generator.h>
 #include <CGAL/Arr_point_location/Arr_lm_random_generator.h>
 #include <CGAL/Arr_point_location/Arr_lm_grid_generator.h>
 #include <CGAL/Arr_point_location/Arr_lm_halton_generator.h>
@@ -85,6 +87,12 @@ protected:
                                                     Walk_pl;
   typedef typename CGAL::Arr_landmarks_point_location<Arrangement>
                                                     Lm_pl;
+  typedef typename CGAL::Arr_landmarks_dynamic_vertices_generator<Arrangement,
+                                                       CGAL::Parallel_tag>
+                                                    Dynamic_lm_generator;
+  typedef typename CGAL::Arr_landmarks_point_location<Arrangement,
+                                                      Dynamic_lm_generator>
+                                                    Lm_dynamic_pl;
   typedef typename CGAL::Arr_random_landmarks_generator<Arrangement>
                                                     Random_lm_generator;
   typedef typename CGAL::Arr_landmarks_point_location<Arrangement,
@@ -137,6 +145,7 @@ protected:
     SIMPLE_PL,
     WALK_PL,
     LM_PL,
+    LM_DYNAMIC_PL,
     LM_RANDOM_PL,
     LM_GRID_PL,
     LM_HALTON_PL,
@@ -154,6 +163,7 @@ protected:
 #if (TEST_GEOM_TRAITS == SEGMENT_GEOM_TRAITS) || \
   (TEST_GEOM_TRAITS == LINEAR_GEOM_TRAITS)
                          Lm_pl*,
+                         Lm_dynamic_pl*,
                          Lm_random_pl*,
                          Lm_grid_pl*,
                          Lm_halton_pl*,
@@ -408,6 +418,29 @@ private:
 #define QUERY_PL_LM(obj)
 #endif
 
+// Landmarks (dynamic vertices)
+#if (LM_DYNAMIC_PL_ENABLED)
+#define INIT_PL_LM_DYNAMIC()          \
+  init_pl<Lm_dynamic_pl, LM_DYNAMIC_PL>("Landmarks (dynamic vertices)");
+#define ALLOCATE_PL_LM_DYNAMIC()      \
+  allocate_pl<Lm_dynamic_pl, LM_DYNAMIC_PL>()
+#define CONSTRUCT_PL_LM_DYNAMIC()     \
+  construct_pl<Lm_dynamic_pl, LM_DYNAMIC_PL>()
+#define DEALLOCATE_PL_LM_DYNAMIC()    \
+  deallocate_pl<Lm_dynamic_pl, LM_DYNAMIC_PL>()
+#define ATTACH_PL_LM_DYNAMIC()        \
+  attach_pl<Lm_dynamic_pl, LM_DYNAMIC_PL>()
+#define QUERY_PL_LM_DYNAMIC(obj)      \
+  query_pl<Lm_dynamic_pl, LM_DYNAMIC_PL>(obj)
+#else
+#define INIT_PL_LM_DYNAMIC()
+#define ALLOCATE_PL_LM_DYNAMIC()
+#define CONSTRUCT_PL_LM_DYNAMIC()
+#define DEALLOCATE_PL_LM_DYNAMIC()
+#define ATTACH_PL_LM_DYNAMIC()
+#define QUERY_PL_LM_DYNAMIC(obj)
+#endif
+
 // Landmarks random
 #if (LM_RANDOM_PL_ENABLED)
 #define INIT_PL_LM_RANDOM()       \
@@ -644,6 +677,8 @@ private:
 #define MEASURE_SIMPLE_PL(timer, op) measure<SIMPLE_PL>(timer, [&](){ op; });
 #define MEASURE_WALK_PL(timer, op) measure<WALK_PL>(timer, [&](){ op; });
 #define MEASURE_LM_PL(timer, op) measure<LM_PL>(timer, [&](){ op; });
+#define MEASURE_LM_DYNAMIC_PL(timer, op) \
+  measure<LM_DYNAMIC_PL>(timer, [&](){ op; });
 #define MEASURE_LM_RANDOM_PL(timer, op) \
   measure<LM_RANDOM_PL>(timer, [&](){ op; });
 #define MEASURE_LM_GRID_PL(timer, op) \
@@ -684,6 +719,7 @@ Point_location_test(const Geom_traits& geom_traits) :
   (TEST_GEOM_TRAITS == LINEAR_GEOM_TRAITS)
 
   INIT_PL_LM();
+  INIT_PL_LM_DYNAMIC();
   INIT_PL_LM_RANDOM();
   INIT_PL_LM_GRID();
   INIT_PL_LM_HALTON();
@@ -744,6 +780,7 @@ void Point_location_test<GeomTraits, TopolTraits>::deallocate_pl_strategies()
   (TEST_GEOM_TRAITS == LINEAR_GEOM_TRAITS)
 
   DEALLOCATE_PL_LM();
+  DEALLOCATE_PL_LM_DYNAMIC();
   DEALLOCATE_PL_LM_RANDOM();
   DEALLOCATE_PL_LM_GRID();
   DEALLOCATE_PL_LM_HALTON();
@@ -810,6 +847,7 @@ bool Point_location_test<GeomTraits, TopolTraits>::allocate_pl_strategies()
   (TEST_GEOM_TRAITS == LINEAR_GEOM_TRAITS)
 
   ALLOCATE_PL_LM();
+  ALLOCATE_PL_LM_DYNAMIC();
   ALLOCATE_PL_LM_RANDOM();
   ALLOCATE_PL_LM_GRID();
   ALLOCATE_PL_LM_HALTON();
@@ -842,6 +880,7 @@ bool Point_location_test<GeomTraits, TopolTraits>::construct_pl_strategies()
   (TEST_GEOM_TRAITS == LINEAR_GEOM_TRAITS)
 
   MEASURE_LM_PL(timer, CONSTRUCT_PL_LM());
+  MEASURE_LM_DYNAMIC_PL(timer, CONSTRUCT_PL_LM_DYNAMIC());
   MEASURE_LM_RANDOM_PL(timer, CONSTRUCT_PL_LM_RANDOM());
   MEASURE_LM_GRID_PL(timer, CONSTRUCT_PL_LM_GRID());
   MEASURE_LM_HALTON_PL(timer, CONSTRUCT_PL_LM_HALTON());
@@ -877,6 +916,7 @@ bool Point_location_test<GeomTraits, TopolTraits>::attach_pl_strategies()
   (TEST_GEOM_TRAITS == LINEAR_GEOM_TRAITS)
 
   MEASURE_LM_PL(timer, ATTACH_PL_LM());
+  MEASURE_LM_DYNAMIC_PL(timer, ATTACH_PL_LM_DYNAMIC());
   MEASURE_LM_RANDOM_PL(timer, ATTACH_PL_LM_RANDOM());
   MEASURE_LM_GRID_PL(timer, ATTACH_PL_LM_GRID());
   MEASURE_LM_HALTON_PL(timer, ATTACH_PL_LM_HALTON());
@@ -918,6 +958,7 @@ bool Point_location_test<GeomTraits, TopolTraits>::perform()
   (TEST_GEOM_TRAITS == LINEAR_GEOM_TRAITS)
 
   QUERY_PL_LM(objs[pl_index++]);
+  QUERY_PL_LM_DYNAMIC(objs[pl_index++]);
   QUERY_PL_LM_RANDOM(objs[pl_index++]);
   QUERY_PL_LM_GRID(objs[pl_index++]);
   QUERY_PL_LM_HALTON(objs[pl_index++]);
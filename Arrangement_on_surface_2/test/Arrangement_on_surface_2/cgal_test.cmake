@@ -1440,6 +1440,17 @@ compile_and_run(test_unbounded_rational_insertion)
 compile_and_run(test_unbounded_rational_direct_insertion)
 compile_and_run(test_rational_function_traits_2)
 compile_and_run(test_iso_verts)
+compile_and_run(test_noded_construction)
+compile_and_run(test_compact_dcel)
+compile_and_run(test_dynamic_landmarks)
+compile_and_run(test_parallel_overlay)
+find_package(TBB QUIET)
+include(CGAL_TBB_support)
+if(TARGET CGAL::TBB_support)
+  target_link_libraries(test_parallel_overlay CGAL::TBB_support)
+else()
+  message(STATUS "NOTICE: Intel TBB was not found. Parallel overlay test will not be performed.")
+endif()
 
 compile_and_run(test_vert_ray_shoot_vert_segments)
 
@@ -0,0 +1,254 @@
+// Testing the compact DCEL against the default DCEL.
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arr_compact_dcel.h>
+#include <CGAL/Arr_extended_dcel.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_overlay_2.h>
+#include <CGAL/Arr_default_overlay_traits.h>
+#include <CGAL/Arr_walk_along_line_point_location.h>
+#include <CGAL/Arr_landmarks_point_location.h>
+#include <CGAL/Arr_observer.h>
+#include <CGAL/Random.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                  Traits_2;
+typedef Traits_2::Point_2                                   Point_2;
+typedef Traits_2::X_monotone_curve_2                        Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                       Arrangement_2;
+typedef CGAL::Arr_compact_dcel<Traits_2>                    Compact_dcel;
+typedef CGAL::Arrangement_2<Traits_2, Compact_dcel>         Compact_arrangement_2;
+
+typedef CGAL::Arr_compact_dcel
+  <Traits_2, CGAL::Arr_compact_vertex_base<Point_2>,
+   CGAL::Arr_compact_halfedge_base<Segment_2>,
+   CGAL::Arr_extended_face<CGAL::Arr_compact_face_base, int> >
+                                                            Data_dcel;
+typedef CGAL::Arrangement_2<Traits_2, Data_dcel>            Data_arrangement_2;
+
+// A signature of the faces of an arrangement: for each face, the number of
+// halfedges along its outer boundary, its number of holes and of isolated
+// vertices, and the sizes of its holes.
+template <typename Arrangement>
+std::vector<std::vector<std::size_t> > signature(const Arrangement& arr)
+{
+  std::vector<std::vector<std::size_t> > sig;
+  for (auto fit = arr.faces_begin(); fit != arr.faces_end(); ++fit) {
+    std::vector<std::size_t> s(1, 0);
+    if (! fit->is_unbounded()) {
+      auto curr = fit->outer_ccb();
+      do { ++s[0]; } while (++curr != fit->outer_ccb());
+    }
+    s.push_back(fit->number_of_holes());
+    s.push_back(fit->number_of_isolated_vertices());
+    for (auto hit = fit->holes_begin(); hit != fit->holes_end(); ++hit) {
+      std::size_t n = 0;
+      auto curr = *hit;
+      do { ++n; } while (++curr != *hit);
+      s.push_back(n);
+    }
+    for (auto vit = fit->isolated_vertices_begin();
+         vit != fit->isolated_vertices_end(); ++vit)
+      if (vit->face() != fit) s.push_back(std::size_t(-1));
+    std::sort(s.begin() + 3, s.end());
+    sig.push_back(s);
+  }
+  std::sort(sig.begin(), sig.end());
+  return sig;
+}
+
+template <typename Arrangement, typename Reference>
+bool compare(const Arrangement& arr, const Reference& ref, const char* what)
+{
+  if (! arr.is_valid()) {
+    std::cerr << what << ": the arrangement is not valid." << std::endl;
+    return false;
+  }
+  if ((arr.number_of_vertices() != ref.number_of_vertices()) ||
+      (arr.number_of_edges() != ref.number_of_edges()) ||
+      (arr.number_of_faces() != ref.number_of_faces()) ||
+      (arr.number_of_isolated_vertices() != ref.number_of_isolated_vertices()))
+  {
+    std::cerr << what << ": different sizes: " << arr.number_of_vertices()
+              << ", " << arr.number_of_edges() << ", " << arr.number_of_faces()
+              << " vs " << ref.number_of_vertices() << ", "
+              << ref.number_of_edges() << ", " << ref.number_of_faces()
+              << std::endl;
+    return false;
+  }
+  if (signature(arr) != signature(ref)) {
+    std::cerr << what << ": different faces." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Count the faces that are created and merged.
+class Face_counter : public CGAL::Arr_observer<Compact_arrangement_2> {
+public:
+  int n_splits = 0;
+  int n_merges = 0;
+
+  Face_counter(Compact_arrangement_2& arr) :
+    CGAL::Arr_observer<Compact_arrangement_2>(arr)
+  {}
+
+  virtual void after_split_face(Face_handle, Face_handle, bool) override
+  { ++n_splits; }
+
+  virtual void after_merge_face(Face_handle) override { ++n_merges; }
+};
+
+std::vector<Segment_2> random_segments(std::size_t n, int grid,
+                                       CGAL::Random& rnd)
+{
+  std::vector<Segment_2> segs;
+  while (segs.size() < n) {
+    Point_2 p(rnd.get_int(0, grid), rnd.get_int(0, grid));
+    Point_2 q(p.x() + rnd.get_int(-grid / 4, grid / 4),
+              p.y() + rnd.get_int(-grid / 4, grid / 4));
+    if (rnd.get_int(0, 10) == 0) q = Point_2(p.x(), q.y());     // vertical
+    if (p != q) segs.push_back(Segment_2(p, q));
+  }
+  return segs;
+}
+
+bool test_random(std::size_t n, int grid, CGAL::Random& rnd)
+{
+  std::vector<Segment_2> segs = random_segments(n, grid, rnd);
+  std::vector<Point_2> points;
+  for (int i = 0; i < 20; ++i)
+    points.push_back(Point_2(rnd.get_double(0, grid), rnd.get_double(0, grid)));
+
+  // Aggregated construction.
+  Arrangement_2 ref;
+  Compact_arrangement_2 arr;
+  CGAL::insert(ref, segs.begin(), segs.end());
+  CGAL::insert(arr, segs.begin(), segs.end());
+  if (! compare(arr, ref, "aggregated")) return false;
+
+  // Incremental insertion of points and segments, with an observer.
+  Face_counter counter(arr);
+  for (const Point_2& p : points) {
+    CGAL::insert_point(ref, p);
+    CGAL::insert_point(arr, p);
+  }
+  std::vector<Segment_2> more = random_segments(n / 4, grid, rnd);
+  std::size_t n_faces = arr.number_of_faces();
+  for (const Segment_2& s : more) {
+    CGAL::insert(ref, s);
+    CGAL::insert(arr, s);
+  }
+  if (! compare(arr, ref, "incremental")) return false;
+  if (n_faces + counter.n_splits - counter.n_merges != arr.number_of_faces()) {
+    std::cerr << "Wrong number of face splits." << std::endl;
+    return false;
+  }
+
+  // Copy and assignment.
+  Compact_arrangement_2 copy(arr);
+  Compact_arrangement_2 assigned;
+  assigned = arr;
+  if (! compare(copy, ref, "copy") || ! compare(assigned, ref, "assign"))
+    return false;
+
+  // Removal of every other edge, and of the isolated vertices.
+  counter.detach();
+  std::vector<Segment_2> removed;
+  std::size_t k = 0;
+  for (auto eit = arr.edges_begin(); eit != arr.edges_end(); ) {
+    Compact_arrangement_2::Halfedge_handle curr = eit;
+    ++eit;
+    if (k++ % 2 == 0) {
+      removed.push_back(curr->curve());
+      arr.remove_edge(curr);
+    }
+  }
+  Traits_2::Equal_2 equal = ref.geometry_traits()->equal_2_object();
+  for (const Segment_2& s : removed) {
+    for (auto eit = ref.edges_begin(); eit != ref.edges_end(); ++eit) {
+      if (equal(eit->curve(), s)) {
+        ref.remove_edge(eit);
+        break;
+      }
+    }
+  }
+  if (! compare(arr, ref, "removal")) return false;
+
+  // Point location with the compact DCEL.
+  typedef CGAL::Arr_walk_along_line_point_location<Compact_arrangement_2>
+    Walk_pl;
+  typedef CGAL::Arr_landmarks_point_location<Compact_arrangement_2>
+    Landmarks_pl;
+  Walk_pl walk_pl(copy);
+  Landmarks_pl lm_pl(copy);
+  for (int i = 0; i < 50; ++i) {
+    Point_2 q(rnd.get_double(0, grid), rnd.get_double(0, grid));
+    if (walk_pl.locate(q) != lm_pl.locate(q)) {
+      std::cerr << "Different point-location results." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool test_overlay(CGAL::Random& rnd)
+{
+  std::vector<Segment_2> segs1 = random_segments(60, 100, rnd);
+  std::vector<Segment_2> segs2 = random_segments(60, 100, rnd);
+
+  Arrangement_2 ref1, ref2, ref;
+  CGAL::insert(ref1, segs1.begin(), segs1.end());
+  CGAL::insert(ref2, segs2.begin(), segs2.end());
+  CGAL::overlay(ref1, ref2, ref);
+
+  Data_arrangement_2 arr1, arr2, arr;
+  CGAL::insert(arr1, segs1.begin(), segs1.end());
+  CGAL::insert(arr2, segs2.begin(), segs2.end());
+  int i = 0;
+  for (auto fit = arr1.faces_begin(); fit != arr1.faces_end(); ++fit)
+    fit->set_data(1);
+  for (auto fit = arr2.faces_begin(); fit != arr2.faces_end(); ++fit)
+    fit->set_data(2 + (i++ % 2) * 2);
+
+  typedef CGAL::Arr_face_overlay_traits<Data_arrangement_2, Data_arrangement_2,
+                                        Data_arrangement_2, std::plus<int> >
+    Overlay_traits;
+  Overlay_traits overlay_traits;
+  CGAL::overlay(arr1, arr2, arr, overlay_traits);
+  if (! compare(arr, ref, "overlay")) return false;
+
+  for (auto fit = arr.faces_begin(); fit != arr.faces_end(); ++fit) {
+    if ((fit->data() != 3) && (fit->data() != 5)) {
+      std::cerr << "Wrong overlay data." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  bool ok = true;
+
+  {
+    Compact_arrangement_2 arr;
+    ok = ok && arr.is_empty() && arr.is_valid();
+  }
+
+  for (int grid : {10, 100, 1000}) {
+    ok = ok && test_random(30, grid, rnd);
+    ok = ok && test_random(300, grid, rnd);
+  }
+  ok = ok && test_overlay(rnd);
+
+  if (! ok) return 1;
+  std::cout << "Passed." << std::endl;
+  return 0;
+}
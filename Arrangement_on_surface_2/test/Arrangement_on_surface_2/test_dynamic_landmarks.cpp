@@ -0,0 +1,116 @@
+// Testing the landmarks point location with the dynamic vertices generator
+// against the naive point location, while the arrangement is edited.
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <variant>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_naive_point_location.h>
+#include <CGAL/Arr_landmarks_point_location.h>
+#include <CGAL/Arr_point_location/Arr_lm_dynamic_vertices_generator.h>
+#include <CGAL/Random.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                  Traits_2;
+typedef Traits_2::Point_2                                   Point_2;
+typedef Traits_2::X_monotone_curve_2                        Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                       Arrangement_2;
+typedef CGAL::Arr_naive_point_location<Arrangement_2>       Naive_pl;
+typedef Naive_pl::result_type                               Result_type;
+typedef Arrangement_2::Halfedge_const_handle                Halfedge_handle;
+
+// Two locations are the same if they are equal, or twin halfedges.
+bool same_location(const Result_type& res1, const Result_type& res2)
+{
+  if (res1 == res2) return true;
+  const Halfedge_handle* hh1 = std::get_if<Halfedge_handle>(&res1);
+  const Halfedge_handle* hh2 = std::get_if<Halfedge_handle>(&res2);
+  return (hh1 != nullptr) && (hh2 != nullptr) && ((*hh1)->twin() == *hh2);
+}
+
+// Locate random points with both point-location strategies, and compare.
+template <typename Point_location>
+bool compare(const Arrangement_2& arr, const Point_location& pl,
+             std::size_t n, CGAL::Random& rnd)
+{
+  Naive_pl naive_pl(arr);
+  for (std::size_t i = 0; i < n; ++i) {
+    Point_2 p(rnd.get_double(-10, 1010), rnd.get_double(-10, 1010));
+    if (! same_location(naive_pl.locate(p), pl.locate(p))) {
+      std::cerr << "Different locations of " << p << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename ConcurrencyTag>
+bool test(CGAL::Random& rnd)
+{
+  typedef CGAL::Arr_landmarks_dynamic_vertices_generator<Arrangement_2,
+                                                         ConcurrencyTag>
+                                                            Generator;
+  typedef CGAL::Arr_landmarks_point_location<Arrangement_2, Generator>
+                                                            Landmarks_pl;
+
+  Arrangement_2 arr;
+  Landmarks_pl pl(arr);
+
+  // Incremental insertions interleaved with queries.
+  for (std::size_t i = 0; i < 300; ++i) {
+    Point_2 p(rnd.get_double(0, 1000), rnd.get_double(0, 1000));
+    Point_2 q(p.x() + rnd.get_double(-100, 100),
+              p.y() + rnd.get_double(-100, 100));
+    if (p == q) continue;
+    CGAL::insert(arr, Segment_2(p, q), pl);
+    if ((i % 50 == 0) && ! compare(arr, pl, 20, rnd)) return false;
+  }
+
+  // A batch of segments inserted by a single global operation.
+  std::vector<Segment_2> segs;
+  for (std::size_t i = 0; i < 300; ++i) {
+    Point_2 p(rnd.get_double(0, 1000), rnd.get_double(0, 1000));
+    Point_2 q(p.x() + rnd.get_double(-100, 100),
+              p.y() + rnd.get_double(-100, 100));
+    if (p != q) segs.push_back(Segment_2(p, q));
+  }
+  CGAL::insert(arr, segs.begin(), segs.end());
+  if (! compare(arr, pl, 200, rnd)) return false;
+
+  // Concurrent queries, possibly during a background rebuild.
+  bool ok = true;
+  std::thread reader([&] {
+    CGAL::Random reader_rnd(1);
+    ok = compare(arr, pl, 200, reader_rnd);
+  });
+  bool main_ok = compare(arr, pl, 200, rnd);
+  reader.join();
+  if (! ok || ! main_ok) return false;
+
+  // Remove random edges, which also removes or merges vertices.
+  for (std::size_t i = 0; i < 200; ++i) {
+    auto hit = arr.halfedges_begin();
+    std::advance(hit, rnd.get_int(0, int(arr.number_of_halfedges())));
+    CGAL::remove_edge(arr, Arrangement_2::Halfedge_handle(hit));
+    if ((i % 40 == 0) && ! compare(arr, pl, 20, rnd)) return false;
+  }
+  if (! compare(arr, pl, 200, rnd)) return false;
+
+  // Clear and refill the arrangement.
+  arr.clear();
+  CGAL::insert(arr, segs.begin(), segs.begin() + 50);
+  return compare(arr, pl, 200, rnd);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  if (! test<CGAL::Sequential_tag>(rnd)) return 1;
+  if (! test<CGAL::Parallel_tag>(rnd)) return 1;
+  std::cout << "Passed." << std::endl;
+  return 0;
+}
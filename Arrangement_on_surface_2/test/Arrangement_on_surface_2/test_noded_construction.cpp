@@ -0,0 +1,215 @@
+// Testing the construction of arrangements from noded segments.
+
+#include <iostream>
+#include <map>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Random.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                  Traits_2;
+typedef Traits_2::Point_2                                   Point_2;
+typedef Traits_2::X_monotone_curve_2                        Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                       Arrangement_2;
+typedef std::pair<std::size_t, std::size_t>                 Edge;
+
+// Extract the points and the (arbitrarily oriented) edges of an arrangement.
+void extract(const Arrangement_2& arr,
+             std::vector<Point_2>& points, std::vector<Edge>& edges)
+{
+  std::map<Arrangement_2::Vertex_const_handle, std::size_t> indices;
+  for (auto vit = arr.vertices_begin(); vit != arr.vertices_end(); ++vit) {
+    indices[vit] = points.size();
+    points.push_back(vit->point());
+  }
+  for (auto eit = arr.edges_begin(); eit != arr.edges_end(); ++eit) {
+    Edge e(indices[eit->source()], indices[eit->target()]);
+    if (edges.size() % 2 == 1) std::swap(e.first, e.second);
+    edges.push_back(e);
+  }
+}
+
+// A signature of the faces of an arrangement: for each face, the number of
+// halfedges along its outer boundary, its number of holes, and its number of
+// isolated vertices.
+std::vector<std::vector<std::size_t> > signature(const Arrangement_2& arr)
+{
+  std::vector<std::vector<std::size_t> > sig;
+  for (auto fit = arr.faces_begin(); fit != arr.faces_end(); ++fit) {
+    std::vector<std::size_t> s(1, 0);
+    if (! fit->is_unbounded()) {
+      auto curr = fit->outer_ccb();
+      do { ++s[0]; } while (++curr != fit->outer_ccb());
+    }
+    s.push_back(fit->number_of_holes());
+    s.push_back(fit->number_of_isolated_vertices());
+    for (auto hit = fit->holes_begin(); hit != fit->holes_end(); ++hit) {
+      std::size_t n = 0;
+      auto curr = *hit;
+      do { ++n; } while (++curr != *hit);
+      s.push_back(n);
+    }
+    std::sort(s.begin() + 3, s.end());
+    sig.push_back(s);
+  }
+  std::sort(sig.begin(), sig.end());
+  return sig;
+}
+
+bool test(const std::vector<Point_2>& points, const std::vector<Edge>& edges)
+{
+  Arrangement_2 arr;
+  CGAL::insert_noded_curves(arr, points, edges);
+
+  std::vector<Segment_2> segs;
+  for (const Edge& e : edges)
+    segs.push_back(Segment_2(points[e.first], points[e.second]));
+  std::vector<Point_2> iso_points;
+  std::vector<bool> used(points.size(), false);
+  for (const Edge& e : edges) used[e.first] = used[e.second] = true;
+  for (std::size_t i = 0; i < points.size(); ++i)
+    if (! used[i]) iso_points.push_back(points[i]);
+
+  Arrangement_2 ref;
+  CGAL::insert_non_intersecting_curves(ref, segs.begin(), segs.end());
+  for (const Point_2& p : iso_points) CGAL::insert_point(ref, p);
+
+  if (! arr.is_valid()) {
+    std::cerr << "The arrangement is not valid." << std::endl;
+    return false;
+  }
+  if ((arr.number_of_vertices() != ref.number_of_vertices()) ||
+      (arr.number_of_edges() != ref.number_of_edges()) ||
+      (arr.number_of_faces() != ref.number_of_faces()) ||
+      (arr.number_of_isolated_vertices() != ref.number_of_isolated_vertices()))
+  {
+    std::cerr << "Different sizes: " << arr.number_of_vertices() << ", "
+              << arr.number_of_edges() << ", " << arr.number_of_faces()
+              << " vs " << ref.number_of_vertices() << ", "
+              << ref.number_of_edges() << ", " << ref.number_of_faces()
+              << std::endl;
+    return false;
+  }
+  if (signature(arr) != signature(ref)) {
+    std::cerr << "Different faces." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Nested squares, with an isolated point and an antenna in each, and a
+// square touching the outermost one at a vertex.
+bool test_nested_squares()
+{
+  std::vector<Point_2> points;
+  std::vector<Edge> edges;
+  for (int k = 0; k < 4; ++k) {
+    const std::size_t i = points.size();
+    const int lo = 2 * k, hi = 20 - 2 * k;
+    points.push_back(Point_2(lo, lo));
+    points.push_back(Point_2(hi, lo));
+    points.push_back(Point_2(hi, hi));
+    points.push_back(Point_2(lo, hi));
+    points.push_back(Point_2(lo + 1, 10));          // isolated
+    points.push_back(Point_2(hi - 1, hi - 1));      // antenna tip
+    for (std::size_t j = 0; j < 4; ++j)
+      edges.push_back(Edge(i + j, i + (j + 1) % 4));
+    edges.push_back(Edge(i + 2, i + 5));
+  }
+  const std::size_t i = points.size();
+  points.push_back(Point_2(-5, -5));
+  points.push_back(Point_2(0, -5));
+  points.push_back(Point_2(-5, 0));
+  edges.push_back(Edge(i, i + 1));
+  edges.push_back(Edge(i + 1, 0));
+  edges.push_back(Edge(0, i + 2));
+  edges.push_back(Edge(i + 2, i));
+
+  // A vertical segment and an isolated point on the left.
+  points.push_back(Point_2(-10, 0));
+  points.push_back(Point_2(-10, 30));
+  points.push_back(Point_2(-20, 15));
+  edges.push_back(Edge(points.size() - 3, points.size() - 2));
+
+  return test(points, edges);
+}
+
+// Many small squares in a large square, in rows and columns, with isolated
+// points inside them and vertically below their corners.
+bool test_many_components()
+{
+  std::vector<Point_2> points;
+  std::vector<Edge> edges;
+  auto add_square = [&](int x, int y, int size)
+  {
+    const std::size_t i = points.size();
+    points.push_back(Point_2(x, y));
+    points.push_back(Point_2(x + size, y));
+    points.push_back(Point_2(x + size, y + size));
+    points.push_back(Point_2(x, y + size));
+    for (std::size_t j = 0; j < 4; ++j)
+      edges.push_back(Edge(i + j, i + (j + 1) % 4));
+  };
+
+  add_square(0, 0, 200);
+  for (int i = 0; i < 19; ++i)
+    for (int j = 0; j < 19; ++j) {
+      add_square(10 * i + 2, 10 * j + 2, 6);
+      points.push_back(Point_2(10 * i + 2, 10 * j + 1));
+      points.push_back(Point_2(10 * i + 4, 10 * j + 5));
+    }
+  return test(points, edges);
+}
+
+// Noded random segments, obtained by constructing their arrangement.
+bool test_random(std::size_t n, int grid, CGAL::Random& rnd)
+{
+  std::vector<Segment_2> segs;
+  while (segs.size() < n) {
+    Point_2 p(rnd.get_int(0, grid), rnd.get_int(0, grid));
+    Point_2 q(p.x() + rnd.get_int(-grid / 4, grid / 4),
+              p.y() + rnd.get_int(-grid / 4, grid / 4));
+    if (p != q) segs.push_back(Segment_2(p, q));
+  }
+  Arrangement_2 arr;
+  CGAL::insert(arr, segs.begin(), segs.end());
+  for (int i = 0; i < 10; ++i)
+    CGAL::insert_point(arr, Point_2(rnd.get_double(0, grid),
+                                    rnd.get_double(0, grid)));
+
+  std::vector<Point_2> points;
+  std::vector<Edge> edges;
+  extract(arr, points, edges);
+  return test(points, edges);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  bool ok = true;
+
+  {
+    // Empty input, and isolated points only.
+    Arrangement_2 arr;
+    CGAL::insert_noded_curves(arr, std::vector<Point_2>(), std::vector<Edge>());
+    ok = ok && arr.is_empty();
+    std::vector<Point_2> points = { Point_2(0, 0), Point_2(1, 1) };
+    ok = ok && test(points, std::vector<Edge>());
+  }
+
+  ok = ok && test_nested_squares();
+  ok = ok && test_many_components();
+  for (int grid : {10, 100, 1000}) {
+    ok = ok && test_random(20, grid, rnd);
+    ok = ok && test_random(200, grid, rnd);
+  }
+
+  if (! ok) return 1;
+  std::cout << "Passed." << std::endl;
+  return 0;
+}
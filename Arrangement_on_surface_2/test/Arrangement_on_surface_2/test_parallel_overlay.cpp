@@ -0,0 +1,249 @@
+// Testing the parallel overlay of arrangements against the sequential one.
+
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <tuple>
+#include <algorithm>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arr_extended_dcel.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_overlay_2.h>
+#include <CGAL/Random.h>
+
+#ifndef CGAL_LINKED_WITH_TBB
+
+int main()
+{
+  std::cout << "TBB is not installed. Test is not performed." << std::endl;
+  return 0;
+}
+
+#else
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                  Traits_2;
+typedef Traits_2::Point_2                                   Point_2;
+typedef Traits_2::X_monotone_curve_2                        Segment_2;
+typedef std::pair<int, int>                                 Data;
+typedef CGAL::Arr_extended_dcel<Traits_2, int, int, int>    Dcel;
+typedef CGAL::Arr_extended_dcel<Traits_2, Data, Data, Data> Res_dcel;
+typedef CGAL::Arrangement_2<Traits_2, Dcel>                 Arrangement_2;
+typedef CGAL::Arrangement_2<Traits_2, Res_dcel>             Res_arrangement_2;
+
+// The data of the input vertices, halfedges, and faces are distinct, so the
+// overlay traits records in every result cell the pair of input cells that
+// induced it.
+struct Overlay_traits {
+  typedef Arrangement_2::Vertex_const_handle                Vertex_handle_A;
+  typedef Arrangement_2::Halfedge_const_handle              Halfedge_handle_A;
+  typedef Arrangement_2::Face_const_handle                  Face_handle_A;
+  typedef Vertex_handle_A                                   Vertex_handle_B;
+  typedef Halfedge_handle_A                                 Halfedge_handle_B;
+  typedef Face_handle_A                                     Face_handle_B;
+  typedef Res_arrangement_2::Vertex_handle                  Vertex_handle_R;
+  typedef Res_arrangement_2::Halfedge_handle                Halfedge_handle_R;
+  typedef Res_arrangement_2::Face_handle                    Face_handle_R;
+
+  template <typename A, typename B>
+  void create_vertex(A a, B b, Vertex_handle_R v) const
+  { v->set_data(Data(a->data(), b->data())); }
+
+  void create_vertex(Face_handle_A, Face_handle_B, Vertex_handle_R) const {}
+
+  void create_edge(Halfedge_handle_A a, Halfedge_handle_B b,
+                   Halfedge_handle_R h) const
+  {
+    h->set_data(Data(a->data(), b->data()));
+    h->twin()->set_data(Data(a->twin()->data(), b->twin()->data()));
+  }
+
+  void create_edge(Halfedge_handle_A a, Face_handle_B b,
+                   Halfedge_handle_R h) const
+  {
+    h->set_data(Data(a->data(), b->data()));
+    h->twin()->set_data(Data(a->twin()->data(), b->data()));
+  }
+
+  void create_edge(Face_handle_A a, Halfedge_handle_B b,
+                   Halfedge_handle_R h) const
+  {
+    h->set_data(Data(a->data(), b->data()));
+    h->twin()->set_data(Data(a->data(), b->twin()->data()));
+  }
+
+  void create_face(Face_handle_A a, Face_handle_B b, Face_handle_R f) const
+  { f->set_data(Data(a->data(), b->data())); }
+};
+
+// Assign distinct data to all the cells of an arrangement.
+void set_data(Arrangement_2& arr, int first)
+{
+  int id = first;
+  for (auto vit = arr.vertices_begin(); vit != arr.vertices_end(); ++vit)
+    vit->set_data(id++);
+  for (auto hit = arr.halfedges_begin(); hit != arr.halfedges_end(); ++hit)
+    hit->set_data(id++);
+  for (auto fit = arr.faces_begin(); fit != arr.faces_end(); ++fit)
+    fit->set_data(id++);
+}
+
+typedef std::tuple<Point_2, Point_2, Data>                  Halfedge_key;
+
+// A description of the result arrangement that does not depend on the
+// order of its cells.
+struct Description {
+  std::vector<std::pair<Point_2, Data> > vertices;
+  std::vector<Halfedge_key> halfedges;
+  std::vector<std::pair<Data, std::size_t> > faces;
+
+  Description(const Res_arrangement_2& arr)
+  {
+    for (auto vit = arr.vertices_begin(); vit != arr.vertices_end(); ++vit)
+      vertices.push_back(std::make_pair(vit->point(), vit->data()));
+    for (auto hit = arr.halfedges_begin(); hit != arr.halfedges_end(); ++hit)
+      halfedges.push_back(Halfedge_key(hit->source()->point(),
+                                       hit->target()->point(), hit->data()));
+    for (auto fit = arr.faces_begin(); fit != arr.faces_end(); ++fit)
+      faces.push_back(std::make_pair(fit->data(),
+                                     fit->number_of_isolated_vertices()));
+    std::sort(vertices.begin(), vertices.end());
+    std::sort(halfedges.begin(), halfedges.end());
+    std::sort(faces.begin(), faces.end());
+  }
+
+  bool operator==(const Description& other) const
+  {
+    return (vertices == other.vertices) && (halfedges == other.halfedges) &&
+      (faces == other.faces);
+  }
+};
+
+bool test(Arrangement_2& arr1, Arrangement_2& arr2)
+{
+  set_data(arr1, 0);
+  set_data(arr2, 1000000);
+
+  Overlay_traits overlay_traits;
+  Res_arrangement_2 seq, par;
+  CGAL::overlay(arr1, arr2, seq, overlay_traits);
+  CGAL::overlay<CGAL::Parallel_tag>(arr1, arr2, par, overlay_traits);
+
+  if (! par.is_valid()) {
+    std::cerr << "The arrangement is not valid." << std::endl;
+    return false;
+  }
+  if ((par.number_of_vertices() != seq.number_of_vertices()) ||
+      (par.number_of_edges() != seq.number_of_edges()) ||
+      (par.number_of_faces() != seq.number_of_faces()) ||
+      (par.number_of_isolated_vertices() != seq.number_of_isolated_vertices()))
+  {
+    std::cerr << "Different sizes: " << par.number_of_vertices() << ", "
+              << par.number_of_edges() << ", " << par.number_of_faces()
+              << " vs " << seq.number_of_vertices() << ", "
+              << seq.number_of_edges() << ", " << seq.number_of_faces()
+              << std::endl;
+    return false;
+  }
+  if (! (Description(par) == Description(seq))) {
+    std::cerr << "Different overlay data." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Random segments on a grid, so that red and blue segments often overlap
+// and share endpoints, with a few isolated points.
+void random_arrangement(Arrangement_2& arr, std::size_t n, int grid,
+                        CGAL::Random& rnd)
+{
+  std::vector<Segment_2> segs;
+  while (segs.size() < n) {
+    Point_2 p(rnd.get_int(0, grid), rnd.get_int(0, grid));
+    Point_2 q(p.x() + rnd.get_int(-grid / 4, grid / 4),
+              (rnd.get_int(0, 3) == 0) ? p.y() :
+              p.y() + rnd.get_int(-grid / 4, grid / 4));
+    if (p != q) segs.push_back(Segment_2(p, q));
+  }
+  CGAL::insert(arr, segs.begin(), segs.end());
+  for (int i = 0; i < 10; ++i)
+    CGAL::insert_point(arr, Point_2(rnd.get_int(0, grid),
+                                    rnd.get_int(0, grid)));
+}
+
+// Two grids of squares, shifted with respect to each other, such that
+// every blue square is split among several red squares and vice versa.
+bool test_grids(int n)
+{
+  Arrangement_2 arr1, arr2;
+  std::vector<Segment_2> segs1, segs2;
+  for (int i = 0; i <= n; ++i) {
+    segs1.push_back(Segment_2(Point_2(0, 2 * i), Point_2(2 * n, 2 * i)));
+    segs1.push_back(Segment_2(Point_2(2 * i, 0), Point_2(2 * i, 2 * n)));
+    segs2.push_back(Segment_2(Point_2(1, 2 * i + 1),
+                              Point_2(2 * n + 1, 2 * i + 1)));
+    segs2.push_back(Segment_2(Point_2(2 * i + 1, 1),
+                              Point_2(2 * i + 1, 2 * n + 1)));
+  }
+  CGAL::insert(arr1, segs1.begin(), segs1.end());
+  CGAL::insert(arr2, segs2.begin(), segs2.end());
+  return test(arr1, arr2);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  bool ok = true;
+
+  {
+    // Empty arrangements, and isolated points only.
+    Arrangement_2 arr1, arr2;
+    ok = ok && test(arr1, arr2);
+    CGAL::insert_point(arr1, Point_2(0, 0));
+    CGAL::insert_point(arr2, Point_2(0, 0));
+    CGAL::insert_point(arr2, Point_2(1, 1));
+    ok = ok && test(arr1, arr2);
+  }
+
+  {
+    // Nested squares: a blue square inside a red one, and overlapping edges.
+    Arrangement_2 arr1, arr2;
+    std::vector<Segment_2> segs1 = {
+      Segment_2(Point_2(0, 0), Point_2(10, 0)),
+      Segment_2(Point_2(10, 0), Point_2(10, 10)),
+      Segment_2(Point_2(10, 10), Point_2(0, 10)),
+      Segment_2(Point_2(0, 10), Point_2(0, 0))
+    };
+    std::vector<Segment_2> segs2 = {
+      Segment_2(Point_2(2, 2), Point_2(4, 2)),
+      Segment_2(Point_2(4, 2), Point_2(4, 4)),
+      Segment_2(Point_2(4, 4), Point_2(2, 4)),
+      Segment_2(Point_2(2, 4), Point_2(2, 2)),
+      Segment_2(Point_2(5, 0), Point_2(15, 0)),
+      Segment_2(Point_2(15, 0), Point_2(15, 5)),
+      Segment_2(Point_2(15, 5), Point_2(5, 0))
+    };
+    CGAL::insert(arr1, segs1.begin(), segs1.end());
+    CGAL::insert(arr2, segs2.begin(), segs2.end());
+    CGAL::insert_point(arr2, Point_2(8, 8));
+    ok = ok && test(arr1, arr2);
+  }
+
+  ok = ok && test_grids(30);
+  for (int grid : {20, 100, 1000}) {
+    for (std::size_t n : {50, 300}) {
+      Arrangement_2 arr1, arr2;
+      random_arrangement(arr1, n, grid, rnd);
+      random_arrangement(arr2, n, grid, rnd);
+      ok = ok && test(arr1, arr2);
+    }
+  }
+
+  if (! ok) return 1;
+  std::cout << "Passed." << std::endl;
+  return 0;
+}
+
+#endif
@@ -248,19 +248,17 @@ void box_intersection_all_pairs_d(
   the algorithm is to be run in parallel, if `CGAL::Parallel_tag` is specified
   and \cgal has been linked with the Intel TBB library, or sequentially,
   if `CGAL::Sequential_tag` - the default value - is specified.
-  The parallelization of the algorithm is based on a divide-and-conquer
-  approach: the two ranges are split in a number of smaller ranges, and
-  all combinations of subranges are treated in parallel. It is thus
-  recommended to use ranges of pointers to bounding boxes, to keep
-  these copies light.
+  The parallelization of the algorithm follows the recursion of the
+  streaming segment tree: the recursive calls for the spanning intervals,
+  for the left subtree, and for the right subtree are run as concurrent
+  tasks, down to subproblems of a few thousand boxes that are handled
+  sequentially. As these calls reorder their ranges, the boxes shared by
+  concurrent calls are copied. It is thus recommended to use ranges
+  of pointers to bounding boxes, to keep these copies light.
 
   \warning The parallel mode comes with a small overhead due to the
-  duplication and splitting of the input ranges. It is an improvement
-  for almost all inputs, but not all. A configuration where the two ranges
-  are small and entirely disjoint might result in a slightly worse
-  runtime when using the parallel version. Users should benchmark both
-  versions to verify that their data does not fall in this (small)
-  set of inputs.
+  duplication of parts of the input ranges. Small inputs are handled
+  sequentially, but users should benchmark both versions on their data.
 
   \warning When using the parallel mode, the callback function must
   be threadsafe.
@@ -23,6 +23,10 @@
 #include <boost/random/uniform_int.hpp>
 #include <boost/random/variate_generator.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_group.h>
+#endif
+
 #include <algorithm>
 #include <iterator>
 #include <functional>
@@ -30,6 +34,7 @@
 #include <cmath>
 #include <climits>
 #include <cstddef>
+#include <vector>
 
 namespace CGAL {
 
@@ -83,6 +88,22 @@ void all_pairs( ForwardIter p_begin, ForwardIter p_end,
 }
 
 
+// Test the intersection of two boxes in the dimensions [first_dim,last_dim].
+// All dimensions are tested without early exit: in the scans below most
+// candidate pairs are rejected in a data-dependent dimension, and the few
+// comparisons are cheaper than the mispredicted branches. The loop body is
+// then free of branches and can be vectorized by the compiler.
+template< class Traits, class Box1, class Box2 >
+inline bool does_intersect_in_dimensions( const Box1& a, const Box2& b,
+                                          int first_dim, int last_dim )
+{
+    bool result = true;
+    for( int dim = first_dim; dim <= last_dim; ++dim )
+        result &= ( Traits::is_lo_less_hi( a, b, dim ) &
+                    Traits::is_lo_less_hi( b, a, dim ) );
+    return result;
+}
+
 template< class RandomAccessIter1, class RandomAccessIter2,
           class Callback, class Traits >
 void one_way_scan( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
@@ -109,15 +130,12 @@ void one_way_scan( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
         {
             if( Traits::id( *p ) == Traits::id( *i ) )
                 continue;
-            for( int dim = 1; dim <= last_dim; ++dim )
-                if( !Traits::does_intersect( *p, *i, dim ) )
-                    goto no_intersection;
+            if( !does_intersect_in_dimensions<Traits>( *p, *i, 1, last_dim ) )
+                continue;
             if( in_order )
                 callback( *p, *i );
             else
                 callback( *i, *p );
-        no_intersection:
-            ;
         }
     }
 
@@ -146,17 +164,14 @@ void modified_two_way_scan(
                 if( Traits::id( *p ) == Traits::id( *i_begin ) )
                     continue;
 
-                for( int dim = 1; dim <= last_dim; ++dim )
-                    if( !Traits::does_intersect( *p, *i_begin, dim ) )
-                        goto no_intersection1;
+                if( !does_intersect_in_dimensions<Traits>( *p, *i_begin, 1, last_dim ) )
+                    continue;
                 if( Traits::contains_lo_point( *i_begin, *p, last_dim ) ) {
                     if( in_order )
                         callback( *p, *i_begin );
                     else
                         callback( *i_begin, *p );
                 }
-            no_intersection1:
-                ;
             }
             ++i_begin;
         } else {
@@ -166,17 +181,14 @@ void modified_two_way_scan(
             {
                 if( Traits::id( *p_begin ) == Traits::id( *i ) )
                     continue;
-                for( int dim = 1; dim <= last_dim; ++dim )
-                    if( !Traits::does_intersect( *p_begin, *i, dim ) )
-                        goto no_intersection2;
+                if( !does_intersect_in_dimensions<Traits>( *p_begin, *i, 1, last_dim ) )
+                    continue;
                 if( Traits::contains_lo_point( *i, *p_begin, last_dim ) ) {
                     if( in_order )
                         callback( *p_begin, *i );
                     else
                         callback( *i, *p_begin );
                 }
-            no_intersection2:
-                ;
             }
             ++p_begin;
         }
@@ -484,6 +496,94 @@ void segment_tree( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
                   callback, traits, cutoff, dim, in_order );
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+
+// Parallel version of segment_tree(): the recursion on the spanning
+// intervals and the recursions on the left and the right subtrees run as
+// concurrent tasks. Since each call reorders the ranges it is given, the
+// points are copied for the spanning intervals, and the intervals that
+// straddle the split value are copied for the right subtree.
+// Below `parallel_cutoff` boxes, the sequential segment_tree() takes over.
+template< class RandomAccessIter1, class RandomAccessIter2,
+          class Callback, class T, class Predicate_traits >
+void parallel_segment_tree( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
+                            RandomAccessIter2 i_begin, RandomAccessIter2 i_end,
+                            T lo, T hi,
+                            Callback callback, Predicate_traits traits,
+                            std::ptrdiff_t cutoff, std::ptrdiff_t parallel_cutoff,
+                            int dim, bool in_order)
+{
+    typedef typename Predicate_traits::Spanning   Spanning;
+    typedef typename Predicate_traits::Lo_less    Lo_less;
+    typedef typename Predicate_traits::Hi_greater Hi_greater;
+
+    typedef typename std::iterator_traits<RandomAccessIter1>::value_type Point_box;
+    typedef typename std::iterator_traits<RandomAccessIter2>::value_type Interval_box;
+
+    const T inf = box_limits< T >::inf();
+    const T sup = box_limits< T >::sup();
+
+    const std::ptrdiff_t p_size = std::distance( p_begin, p_end );
+    const std::ptrdiff_t i_size = std::distance( i_begin, i_end );
+
+    if( dim == 0 || lo >= hi || p_size < cutoff || i_size < cutoff ||
+        p_size + i_size < parallel_cutoff )
+    {
+        segment_tree( p_begin, p_end, i_begin, i_end, lo, hi,
+                      callback, traits, cutoff, dim, in_order );
+        return;
+    }
+
+    RandomAccessIter2 i_span_end = lo == inf || hi == sup ? i_begin :
+        std::partition( i_begin, i_end, Spanning( lo, hi, dim ) );
+
+    // the points must be copied before they get split below
+    std::vector< Point_box > p_span;
+    if( i_begin != i_span_end )
+        p_span.assign( p_begin, p_end );
+
+    tbb::task_group g;
+
+    if( i_begin != i_span_end ) {
+        g.run( [&] {
+            parallel_segment_tree( p_span.begin(), p_span.end(), i_begin, i_span_end,
+                                   inf, sup, callback, traits, cutoff, parallel_cutoff,
+                                   dim - 1, in_order );
+            parallel_segment_tree( i_begin, i_span_end, p_span.begin(), p_span.end(),
+                                   inf, sup, callback, traits, cutoff, parallel_cutoff,
+                                   dim - 1, !in_order );
+        } );
+    }
+
+    T mi;
+    RandomAccessIter1 p_mid = split_points( p_begin, p_end, traits, dim, mi );
+
+    std::vector< Interval_box > i_right;
+    if( p_mid == p_begin || p_mid == p_end )  {
+        modified_two_way_scan( p_begin, p_end, i_span_end, i_end,
+                               callback, traits, dim, in_order );
+    } else {
+        // right intervals have a high point strictly higher than mi
+        std::copy_if( i_span_end, i_end, std::back_inserter( i_right ),
+                      Hi_greater( mi, dim ) );
+        // left intervals have a low point strictly less than mi
+        RandomAccessIter2 i_mid = std::partition( i_span_end, i_end, Lo_less( mi, dim ) );
+
+        g.run( [&] {
+            parallel_segment_tree( p_begin, p_mid, i_span_end, i_mid, lo, mi,
+                                   callback, traits, cutoff, parallel_cutoff,
+                                   dim, in_order );
+        } );
+        parallel_segment_tree( p_mid, p_end, i_right.begin(), i_right.end(), mi, hi,
+                               callback, traits, cutoff, parallel_cutoff,
+                               dim, in_order );
+    }
+
+    g.wait();
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
 #if CGAL_BOX_INTERSECTION_DEBUG
  #undef CGAL_BOX_INTERSECTION_DUMP
 #endif
@@ -28,10 +28,7 @@
 #include <CGAL/use.h>
 #include <CGAL/tags.h>
 
-#ifdef CGAL_LINKED_WITH_TBB
-#include <tbb/task_group.h>
-#endif
-
+#include <algorithm>
 #include <iterator>
 #include <vector>
 
@@ -68,135 +65,12 @@ void box_intersection_segment_tree_d(
 #else // CGAL_LINKED_WITH_TBB
   if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
   {
-    // Here is an illustration for n=2.
-    //
-    // Doing a R1-R2 intersection with a 2-split is doing 4 subpairs in parallel
-    // a-c and b-d
-    // r1[0][0] --a-- r1[0][1] --b-- r1[0][2]
-    // r2[0][0] --c-- r2[0][1] --d-- r2[0][2]
-    //
-    // a-d and b-c
-    // r1[1][0] --a-- r1[1][1] --b-- r1[1][2]
-    // r2[1][0] --c-- r2[1][1] --d-- r2[1][2]
-    //
-    // Ranges must be duplicates since sorting is performed
-
-    typedef typename std::iterator_traits<RandomAccessIter1>::value_type         val_t;
-    typedef typename std::iterator_traits<RandomAccessIter1>::difference_type    diff_size;
-
-    typedef std::vector<val_t>                                                   val_container;
-    typedef typename val_container::iterator                                     It;
-
-    static constexpr int n = 4;
-
-    const diff_size r1s = std::distance(begin1, end1);
-    const diff_size r2s = std::distance(begin2, end2);
-
-    val_container range_1_copies, range_2_copies;
-    range_1_copies.reserve(r1s * n);
-    range_2_copies.reserve(r2s * n);
-
-    const diff_size r1_step = r1s / n;
-    const diff_size r2_step = r2s / n;
-
-    for(int i=0; i<n; ++i)
-    {
-      range_1_copies.insert(range_1_copies.end(), begin1, end1);
-      range_2_copies.insert(range_2_copies.end(), begin2, end2);
-    }
-
-    // for example for n=2, there's 'begin', 'mid', and 'end' but we leave out 'end' for convenience
-    std::array<std::array<It, n>, n> range_1_iterators;
-    std::array<std::array<It, n>, n> range_2_iterators;
-
-    for(int i=0; i<n; ++i)
-    {
-      for(int j=0; j<n; ++j)
-      {
-        range_1_iterators[i][j] = range_1_copies.begin() + i * r1s + j * r1_step;
-        range_2_iterators[i][j] = range_2_copies.begin() + i * r2s + j * r2_step;
-      }
-    }
-
-    tbb::task_group g;
-
-    for(int i=0; i<n; ++i)
-    {
-      for(int j=0; j<n; ++j)
-      {
-        // 'j' vs 'j+i', meaning for each value of 'i' we're matching r1[i] with a shifted version of r2[i]
-        int r1_endi, r1_endj;
-        int r2_endi, r2_endj;
-
-        if(i == (n-1))
-        {
-          if(j == (n-1)) // both very last range and very last iterator
-          {
-            r1_endi = -1;
-            r1_endj = -1;
-          }
-          else
-          {
-            r1_endi = i;
-            r1_endj = j+1;
-          }
-        }
-        else // i != (n-1)
-        {
-          if(j == (n-1)) // end of that range, but not of the full container
-          {
-            r1_endi = i+1;
-            r1_endj = 0;
-          }
-          else
-          {
-            r1_endi = i;
-            r1_endj = j+1;
-          }
-        }
-
-        if(i == (n-1))
-        {
-          if(j+i == (n-1)) // both very last range and very last iterator
-          {
-            r2_endi = -1;
-            r2_endj = -1;
-          }
-          else
-          {
-            r2_endi = i;
-            r2_endj = (j+i+1)%n;
-          }
-        }
-        else // i != (n-1)
-        {
-          if(j+i == (n-1)) // end of that range, but not of the full container
-          {
-            r2_endi = i+1;
-            r2_endj = 0;
-          }
-          else
-          {
-            r2_endi = i;
-            r2_endj = (j+i+1)%n;
-          }
-        }
-
-        It r1_start = range_1_iterators[i][j];
-        It r1_end = (r1_endi == -1) ? range_1_copies.end() : range_1_iterators[r1_endi][r1_endj];
-        It r2_start = range_2_iterators[i][(j+i)%n];
-        It r2_end = (r2_endi == -1) ? range_2_copies.end() : range_2_iterators[r2_endi][r2_endj];
-        CGAL_assertion(range_1_copies.begin() <= r1_start && r1_start <= r1_end && r1_end <= range_1_copies.end());
-        CGAL_assertion(range_2_copies.begin() <= r2_start && r2_start <= r2_end && r2_end <= range_2_copies.end());
-
-        // Specify "copy by value" otherwise the values of iterators for next (i,j) iterations
-        // become shared with different lambdas being run in parallel, and things go wrong
-        g.run([=]{ Box_intersection_d::segment_tree( r1_start, r1_end, r2_start, r2_end,
-                                                     inf, sup, callback, traits, cutoff, dim, in_order); });
-      }
-    }
+    // The recursive calls of the segment tree are spawned as tasks down to
+    // subproblems of this many boxes, which are then handled sequentially.
+    const std::ptrdiff_t parallel_cutoff = (std::max)(cutoff, std::ptrdiff_t(2000));
 
-    g.wait();
+    Box_intersection_d::parallel_segment_tree(begin1, end1, begin2, end2, inf, sup, callback, traits,
+                                              cutoff, parallel_cutoff, dim, in_order);
   }
   else
 #endif // CGAL_LINKED_WITH_TBB
@@ -20,6 +20,10 @@
 #include <iostream>
 #include <iterator>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <atomic>
+#endif
+
 #include "util.h"
 
 static unsigned int failed = 0;
@@ -28,6 +32,17 @@ template< class NT, std::size_t DIM, bool CLOSED >
 struct _test {
 typedef Util< NT, DIM, CLOSED > Uti1;
 
+#ifdef CGAL_LINKED_WITH_TBB
+struct Atomic_counter_callback {
+    std::atomic<unsigned int>& counter;
+    Atomic_counter_callback( std::atomic<unsigned int>& i ) : counter(i) {}
+    void operator()( const typename Uti1::Box& a, const typename Uti1::Box& b ) {
+        Uti1::assert_intersection( a, b );
+        ++counter;
+    }
+};
+#endif
+
 static void
 test_n( unsigned int n,
         CGAL::Box_intersection_d::Setting
@@ -92,6 +107,25 @@ test_n( unsigned int n,
     std::cout << "got " << callback2.get_counter() << " intersections in "
               << timer.time() << " seconds." << std::endl;
 
+#ifdef CGAL_LINKED_WITH_TBB
+    std::cout << "parallel segment tree ... " << std::flush;
+    std::atomic<unsigned int> c3(0);
+    timer.reset();
+    timer.start();
+    CGAL::box_intersection_custom_predicates_d<CGAL::Parallel_tag>(
+                                      boxes1.begin(), boxes1.end(),
+                                      boxes2.begin(), boxes2.end(),
+                                      Atomic_counter_callback(c3), typename Uti1::Traits(),
+                                      cutoff, setting );
+    timer.stop();
+    std::cout << "got " << c3 << " intersections in "
+              << timer.time() << " seconds." << std::endl;
+    if( c3 != callback2.get_counter() ) {
+        ++failed;
+        std::cout << "!! failed !! " << std::endl;
+    }
+#endif
+
     if( callback1.get_counter() != callback2.get_counter() ||
         ( n < allpairs_max && callback0.get_counter() != callback1.get_counter() ) )
     {
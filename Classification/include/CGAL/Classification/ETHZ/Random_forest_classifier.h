@@ -37,6 +37,8 @@
 #include <CGAL/Classification/ETHZ/internal/random-forest/forest.hpp>
 
 #include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
 
 #if defined(CGAL_LINKED_WITH_BOOST_IOSTREAMS) && defined(CGAL_LINKED_WITH_BOOST_SERIALIZATION)
 #include <boost/archive/text_iarchive.hpp>
@@ -233,12 +235,58 @@ public:
 
     std::vector<float> prob (m_labels.size());
 
-    m_rfc->evaluate (ft.data(), prob.data());
+    m_rfc->evaluate_block (ft.data(), 1, prob.data());
 
     for (std::size_t i = 0; i < out.size(); ++ i)
       out[i] = (std::min) (1.f, (std::max) (0.f, prob[i]));
   }
 
+  // Assigns a label to each of the `nb_items` first items. The items are
+  // processed by blocks: the values of the features are gathered for all
+  // the items of the block, which are then given to each tree at once.
+  // The result is the same as calling operator() on each item.
+  template <typename ConcurrencyTag, typename LabelIndexRange>
+  void classify_by_blocks (std::size_t nb_items, LabelIndexRange& output) const
+  {
+    const std::size_t block_size = 256;
+    const std::size_t nb_blocks = (nb_items + block_size - 1) / block_size;
+    const std::size_t nb_labels = m_labels.size();
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t> (0, nb_blocks),
+       [&](const std::size_t& b) -> bool
+       {
+         const std::size_t first = b * block_size;
+         const std::size_t size = (std::min) (block_size, nb_items - first);
+
+         std::vector<float> ft (m_features.size() * size);
+         for (std::size_t f = 0; f < m_features.size(); ++ f)
+           for (std::size_t i = 0; i < size; ++ i)
+             ft[f * size + i] = m_features[f]->value(first + i);
+
+         std::vector<float> prob (size * nb_labels);
+         m_rfc->evaluate_block (ft.data(), size, prob.data());
+
+         for (std::size_t i = 0; i < size; ++ i)
+         {
+           std::size_t nb_class_best = 0;
+           float val_class_best = 0.f;
+           for (std::size_t k = 0; k < nb_labels; ++ k)
+           {
+             float value = (std::min) (1.f, (std::max) (0.f, prob[i * nb_labels + k]));
+             if (val_class_best < value)
+             {
+               val_class_best = value;
+               nb_class_best = k;
+             }
+           }
+           output[first + i] = static_cast<typename LabelIndexRange::iterator::value_type>(nb_class_best);
+         }
+
+         return true;
+       });
+  }
+
   /// \endcond
 
   /// @}
@@ -363,6 +411,7 @@ public:
     ins.push(input);
     boost::archive::text_iarchive ias(ins);
     ias >> BOOST_SERIALIZATION_NVP(*m_rfc);
+    m_rfc->compile();
   }
 #endif
   /// \endcond
@@ -375,6 +424,18 @@ public:
 /// \cond SKIP_IN_MANUAL
 // Backward compatibility
 typedef ETHZ::Random_forest_classifier ETHZ_random_forest_classifier;
+
+// Overload of classify() that evaluates the random forest on blocks of items
+template <typename ConcurrencyTag,
+          typename ItemRange,
+          typename LabelIndexRange>
+void classify (const ItemRange& input,
+               const Label_set&,
+               const ETHZ::Random_forest_classifier& classifier,
+               LabelIndexRange& output)
+{
+  classifier.classify_by_blocks<ConcurrencyTag> (input.size(), output);
+}
 /// \endcond
 
 }
@@ -20,6 +20,7 @@
 //  * fix the randomization of input (which was implicitly losing
 //    samples)
 //  * add method to get feature usage
+//  * add a flattened copy of the trees to evaluate blocks of samples
 
 #ifndef CGAL_INTERNAL_LIBLEARNING_RANDOMFOREST_FOREST_H
 #define CGAL_INTERNAL_LIBLEARNING_RANDOMFOREST_FOREST_H
@@ -30,6 +31,9 @@
 #include <cstdio>
 #endif
 
+#include <cstdint>
+#include <vector>
+
 #include <CGAL/algorithm.h>
 #include <CGAL/IO/binary_file_io.h>
 #include <CGAL/tags.h>
@@ -106,6 +110,16 @@ public:
 
 };
 
+// Node of the flattened forest used for inference: the nodes of a tree are
+// stored in depth-first order, so the left child of an inner node directly
+// follows it.
+template <typename FeatureType>
+struct Compiled_node {
+    int feature;           // -1 for a leaf
+    FeatureType threshold;
+    std::uint32_t next;    // right child of an inner node, offset of the votes of a leaf
+};
+
 template <typename NodeT>
 class RandomForest {
 public:
@@ -116,6 +130,11 @@ public:
 
     boost::ptr_vector< Tree<NodeT> > trees;
 
+    // Flattened copy of the trees, updated by compile()
+    std::vector<Compiled_node<FeatureType> > compiled_nodes;
+    std::vector<float> compiled_votes;
+    std::vector<std::size_t> compiled_roots;
+
     RandomForest() {}
     RandomForest(ParamType const& params) : params(params) {}
 
@@ -182,6 +201,66 @@ public:
             f.apply(i_tree);
           }
         }
+
+        compile();
+    }
+
+    // Stores all the trees in contiguous arrays for evaluate_block()
+    void compile() {
+        compiled_nodes.clear();
+        compiled_votes.clear();
+        compiled_roots.clear();
+        for (size_t i_tree = 0; i_tree < trees.size(); ++i_tree) {
+            compiled_roots.push_back(compiled_nodes.size());
+            compile_node(*(trees[i_tree].root_node));
+        }
+    }
+
+    void compile_node(NodeT const& node) {
+        std::size_t index = compiled_nodes.size();
+        compiled_nodes.push_back(Compiled_node<FeatureType>());
+        // An inner node without a splitter (no proposal could separate its
+        // samples) votes like a leaf with its own distribution
+        if (node.is_leaf || node.splitter.feature == -1) {
+            compiled_nodes[index].feature = -1;
+            compiled_nodes[index].threshold = FeatureType(0);
+            compiled_nodes[index].next = std::uint32_t(compiled_votes.size());
+            compiled_votes.insert(compiled_votes.end(), node.node_dist.begin(), node.node_dist.end());
+        } else {
+            compiled_nodes[index].feature = node.splitter.feature;
+            compiled_nodes[index].threshold = node.splitter.threshold;
+            compile_node(*(node.left));
+            compiled_nodes[index].next = std::uint32_t(compiled_nodes.size());
+            compile_node(*(node.right));
+        }
+    }
+
+    // Evaluates `n_samples` samples stored feature by feature (the value of
+    // feature `f` for sample `i` is `samples[f * n_samples + i]`) and writes the
+    // `n_classes` probabilities of each sample in `results`. Each tree is applied
+    // to all samples before the next one, and the probabilities are the same as
+    // the ones of evaluate().
+    void evaluate_block(FeatureType const* samples, std::size_t n_samples, float* results) const {
+        const std::size_t n_classes = params.n_classes;
+        std::fill_n(results, n_samples * n_classes, 0.0f);
+        for (std::size_t i_tree = 0; i_tree < compiled_roots.size(); ++i_tree) {
+            const std::size_t root = compiled_roots[i_tree];
+            for (std::size_t i_sample = 0; i_sample < n_samples; ++i_sample) {
+                std::size_t n = root;
+                while (compiled_nodes[n].feature >= 0) {
+                    const Compiled_node<FeatureType>& node = compiled_nodes[n];
+                    n = (samples[std::size_t(node.feature) * n_samples + i_sample] > node.threshold)
+                      ? std::size_t(node.next) : n + 1;
+                }
+                float const* votes = compiled_votes.data() + compiled_nodes[n].next;
+                float* sample_results = results + i_sample * n_classes;
+                for (std::size_t i_cls = 0; i_cls < n_classes; ++i_cls)
+                    sample_results[i_cls] += votes[i_cls];
+            }
+        }
+        float scale = 1.0 / trees.size();
+        for (std::size_t i = 0; i < n_samples * n_classes; ++i)
+            results[i] *= scale;
     }
     int evaluate(FeatureType const* sample, float* results) {
         // initialize output probabilities to 0
@@ -252,6 +331,8 @@ public:
         trees.push_back (new TreeType(&params));
         trees.back().read(is);
       }
+
+      compile();
     }
 
     void get_feature_usage (std::vector<std::size_t>& count) const
@@ -16,6 +16,7 @@
 //  * change serialization functions to avoid a bug with boost and some
 //    compilers (that leads to dereferencing a null pointer)
 //  * add a method to get feature usage
+//  * keep a node as a leaf when no proposal separates its samples
 
 #ifndef CGAL_INTERNAL_LIBLEARNING_RANDOMFORESTS_NODE_H
 #define CGAL_INTERNAL_LIBLEARNING_RANDOMFORESTS_NODE_H
@@ -210,6 +211,13 @@ public:
         std::printf("Determining the best split at depth %zu/%zu\n", depth, params->max_depth);
 #endif
         determine_best_split(samples, labels, sample_idxes, split_generator, gen);
+        if (splitter.feature == -1) {
+            // No proposal separates the samples (e.g., they all have the
+            // same features): keep this node as a leaf
+            is_leaf = true;
+            splitter.threshold = 0.0;
+            return;
+        }
 
         left.reset(new Derived(depth + 1, params));
         right.reset(new Derived(depth + 1, params));
@@ -63,7 +63,7 @@ public:
         // start with root
         NodeT const* node = root_node.get();
         // split until leaf
-        while (node && !node->is_leaf) {
+        while (node && !node->is_leaf && node->splitter.feature != -1) {
             node = node->split(sample);
         }
         if (!node) {
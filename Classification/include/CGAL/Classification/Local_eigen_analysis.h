@@ -86,26 +86,31 @@ private:
 
     void operator()(const tbb::blocked_range<std::size_t>& r) const
     {
+      // Buffers and range sum are local to the block: the shared mean
+      // range is only locked once per block
       std::vector<std::size_t> neighbors;
+      std::vector<typename PointMap::value_type> neighbor_points;
+      float range = 0.f;
       for (std::size_t i = r.begin(); i != r.end(); ++ i)
       {
         neighbors.clear();
         m_neighbor_query (get(m_point_map, *(m_input.begin()+i)), std::back_inserter (neighbors));
 
-        std::vector<typename PointMap::value_type> neighbor_points;
+        neighbor_points.clear();
         neighbor_points.reserve(neighbors.size());
         for (std::size_t j = 0; j < neighbors.size(); ++ j)
           neighbor_points.push_back (get(m_point_map, *(m_input.begin()+neighbors[j])));
 
-        m_mutex.lock();
-        m_mean_range += float(CGAL::sqrt
-                              (CGAL::squared_distance (get(m_point_map, *(m_input.begin() + i)),
-                                                       get(m_point_map, *(m_input.begin() + neighbors.back())))));
-        m_mutex.unlock();
+        range += float(CGAL::sqrt
+                       (CGAL::squared_distance (get(m_point_map, *(m_input.begin() + i)),
+                                                get(m_point_map, *(m_input.begin() + neighbors.back())))));
 
         m_eigen.compute<typename PointMap::value_type,
                         DiagonalizeTraits> (i, get(m_point_map, *(m_input.begin()+i)), neighbor_points);
       }
+
+      std::lock_guard<std::mutex> lock (m_mutex);
+      m_mean_range += range;
     }
 
   };
@@ -137,19 +142,22 @@ private:
     void operator()(const tbb::blocked_range<std::size_t>& r) const
     {
       face_iterator begin = faces(m_input).first;
+      std::vector<face_index> neighbors;
+      float range = 0.f;
       for (std::size_t i = r.begin(); i != r.end(); ++ i)
       {
         face_descriptor fd = *(begin + i);
-        std::vector<face_index> neighbors;
+        neighbors.clear();
         m_neighbor_query (fd, std::back_inserter (neighbors));
 
-        m_mutex.lock();
-        m_mean_range += m_eigen.face_radius(fd, m_input);
-        m_mutex.unlock();
+        range += m_eigen.face_radius(fd, m_input);
 
         m_eigen.compute_triangles<FaceListGraph, DiagonalizeTraits>
           (m_input, fd, neighbors);
       }
+
+      std::lock_guard<std::mutex> lock (m_mutex);
+      m_mean_range += range;
     }
 
   };
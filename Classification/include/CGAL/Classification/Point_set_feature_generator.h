@@ -33,6 +33,7 @@
 #include <CGAL/Classification/internal/verbosity.h>
 #include <CGAL/Classification/Feature_set.h>
 #include <CGAL/bounding_box.h>
+#include <CGAL/for_each.h>
 
 #include <CGAL/Real_timer.h>
 
@@ -65,7 +66,8 @@ namespace Classification {
   is `GeomTraits::Point_3`.
   \tparam ConcurrencyTag enables sequential versus parallel
   computation of `CGAL::Classification::Local_eigen_analysis`
-  objects. Possible values are `Parallel_tag` (default value is \cgal
+  objects. In parallel, the neighborhoods and eigen analyses of the
+  different scales are also computed concurrently. Possible values are `Parallel_tag` (default value is \cgal
   is linked with TBB) or `Sequential_tag` (default value otherwise).
   \tparam DiagonalizeTraits model of `DiagonalizeTraits` used for
   matrix diagonalization. It can be omitted: if Eigen 3 (or greater)
@@ -122,21 +124,22 @@ private:
     std::unique_ptr<Local_eigen_analysis> eigen;
     float voxel_size;
 
+    // Computes the neighborhood and the eigen analysis, which are
+    // independent from one scale to another (the finest scale uses all
+    // input points, the others are downsampled with `voxel_size`)
     Scale (const PointRange& input, PointMap point_map,
-           const Iso_cuboid_3& bbox, float voxel_size,
-           const std::unique_ptr<Planimetric_grid>& lower_grid
-           = std::unique_ptr<Planimetric_grid>())
+           float voxel_size, bool finest)
       : voxel_size (voxel_size)
     {
       CGAL::Real_timer t;
       t.start();
-      if (!lower_grid)
+      if (finest)
         neighborhood = std::make_unique<Neighborhood> (input, point_map, ConcurrencyTag());
       else
         neighborhood = std::make_unique<Neighborhood> (input, point_map, voxel_size, ConcurrencyTag());
       t.stop();
 
-      if (!lower_grid)
+      if (finest)
         CGAL_CLASSIFICATION_CERR << "Neighborhood computed in " << t.time() << " second(s)" << std::endl;
       else
         CGAL_CLASSIFICATION_CERR << "Neighborhood with voxel size " << voxel_size
@@ -154,16 +157,22 @@ private:
       t.stop();
       CGAL_CLASSIFICATION_CERR << "Eigen values computed in " << t.time() << " second(s)" << std::endl;
       CGAL_CLASSIFICATION_CERR << "Range = " << range << std::endl;
-      t.reset();
-      t.start();
+    }
 
+    // The grid of a scale is derived from the grid of the scale below
+    void compute_grid (const PointRange& input, PointMap point_map,
+                       const Iso_cuboid_3& bbox,
+                       const std::unique_ptr<Planimetric_grid>& lower_grid
+                       = std::unique_ptr<Planimetric_grid>())
+    {
+      CGAL::Real_timer t;
+      t.start();
       if (!lower_grid)
         grid = std::make_unique<Planimetric_grid> (input, point_map, bbox, this->voxel_size);
       else
         grid = std::make_unique<Planimetric_grid>(lower_grid.get());
       t.stop();
       CGAL_CLASSIFICATION_CERR << "Planimetric grid computed in " << t.time() << " second(s)" << std::endl;
-      t.reset();
     }
 
     float grid_resolution() const { return voxel_size; }
@@ -212,18 +221,34 @@ public:
 
     CGAL::Real_timer t; t.start();
 
-    m_scales.reserve (nb_scales);
-
-    m_scales.emplace_back (std::make_unique<Scale> (m_input, m_point_map, m_bbox, voxel_size));
+    // The smallest scale is always computed
+    nb_scales = (std::max)(nb_scales, std::size_t(1));
+    m_scales.resize (nb_scales);
 
+    // If the smallest scale is estimated, it must be computed before
+    // the others, which are then computed concurrently
+    std::size_t first_concurrent = 0;
     if (voxel_size == -1.f)
-      voxel_size = m_scales[0]->grid_resolution();
-
-    for (std::size_t i = 1; i < nb_scales; ++ i)
     {
-      voxel_size *= 2;
-      m_scales.push_back (std::make_unique<Scale> (m_input, m_point_map, m_bbox, voxel_size, m_scales[i-1]->grid));
+      m_scales[0] = std::make_unique<Scale> (m_input, m_point_map, voxel_size, true);
+      voxel_size = m_scales[0]->grid_resolution();
+      first_concurrent = 1;
     }
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t> (first_concurrent, nb_scales),
+       [&](const std::size_t& i) -> bool
+       {
+         m_scales[i] = std::make_unique<Scale> (m_input, m_point_map,
+                                                voxel_size * float(std::size_t(1) << i), i == 0);
+         return true;
+       });
+
+    for (std::size_t i = 0; i < nb_scales; ++ i)
+      if (i == 0)
+        m_scales[i]->compute_grid (m_input, m_point_map, m_bbox);
+      else
+        m_scales[i]->compute_grid (m_input, m_point_map, m_bbox, m_scales[i-1]->grid);
     t.stop();
     CGAL_CLASSIFICATION_CERR << "Scales computed in " << t.time() << " second(s)" << std::endl;
     t.reset();
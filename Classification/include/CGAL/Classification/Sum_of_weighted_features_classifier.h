@@ -184,6 +184,29 @@ public:
       m_map_features[features[i]] = i;
   }
 
+  /*!
+    \brief copies the weights and effects of the `other` classifier
+    using another set of `features`.
+
+    This constructor can be used to apply a trained classifier to
+    another data set, for example to each tile with
+    `CGAL::Classification::classify_by_tiles()`.
+
+    \warning The feature set should be composed of the same features
+    than the ones used by `other`, and in the same order.
+  */
+  Sum_of_weighted_features_classifier (const Sum_of_weighted_features_classifier& other,
+                                       const Feature_set& features)
+    : m_labels (other.m_labels), m_features (features),
+      m_weights (other.m_weights),
+      m_effect_table (other.m_effect_table),
+      m_map_labels (other.m_map_labels)
+  {
+    CGAL_precondition (features.size() == other.m_features.size());
+    for (std::size_t i = 0; i < features.size(); ++ i)
+      m_map_features[features[i]] = i;
+  }
+
   /// @}
 
   /// \name Weights and Effects
@@ -26,9 +26,14 @@
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
 #include <tbb/scalable_allocator.h>
-#include <mutex>
 #endif // CGAL_LINKED_WITH_TBB
 
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 namespace CGAL {
 
 namespace Classification {
@@ -237,7 +242,9 @@ namespace Classification {
     instead of a big one. The computation of these smaller graph cuts can
     be done in parallel. Increasing the number of subsets allows for
     faster computation times but can also reduce the quality of the
-    results.
+    results. Subdivisions that contain more than twice the average
+    number of items are recursively split into four, so that dense
+    areas do not unbalance the computation.
 
     \tparam ConcurrencyTag enables sequential versus parallel
     algorithm. Possible values are `Parallel_if_available_tag`, `Parallel_tag` or `Sequential_tag`.
@@ -314,24 +321,79 @@ namespace Classification {
     std::cerr << " -> Size of division: " << Dx / nb_x << " " << Dy / nb_y << std::endl;
 #endif
 
+    // Upper bounds of the columns and rows of the grid, to find the
+    // first subdivision overlapping an item by binary search
+    std::vector<double> x_bounds, y_bounds;
+    x_bounds.reserve (nb_x);
+    for (std::size_t x = 0; x < nb_x; ++ x)
+      x_bounds.push_back (bboxes[x * nb_y].xmax());
+    y_bounds.reserve (nb_y);
+    for (std::size_t y = 0; y < nb_y; ++ y)
+      y_bounds.push_back (bboxes[y].ymax());
+
     std::vector<std::vector<std::size_t> > indices (nb);
-    std::vector<std::pair<std::size_t, std::size_t> > input_to_indices(input.size());
 
     for (std::size_t s = 0; s < input.size(); ++ s)
     {
       CGAL::Bbox_3 b = get(item_map, *(input.begin() + s)).bbox();
 
-      std::size_t i = 0;
-      for (; i < bboxes.size(); ++ i)
-        if (CGAL::do_overlap (b, bboxes[i]))
-        {
-          input_to_indices[s] = std::make_pair (i, indices[i].size());
-          indices[i].push_back (s);
-          break;
-        }
-      CGAL_assertion_msg (i != bboxes.size(), "Point was not assigned to any subdivision.");
+      std::size_t x = std::size_t(std::lower_bound (x_bounds.begin(), x_bounds.end(), b.xmin()) - x_bounds.begin());
+      std::size_t y = std::size_t(std::lower_bound (y_bounds.begin(), y_bounds.end(), b.ymin()) - y_bounds.begin());
+      CGAL_assertion_msg (x != nb_x && y != nb_y, "Point was not assigned to any subdivision.");
+      indices[x * nb_y + y].push_back (s);
+    }
+
+    // Subdivisions holding more than twice the average number of items
+    // are split in four, recursively, so that dense areas do not
+    // unbalance the computation
+    const std::size_t max_subdivision_size = 2 * (input.size() / nb + 1);
+    const std::size_t max_depth = 8;
+    std::vector<std::size_t> depths (indices.size(), 0);
+    for (std::size_t sub = 0; sub < indices.size(); )
+    {
+      if (indices[sub].size() <= max_subdivision_size || depths[sub] == max_depth)
+      {
+        ++ sub;
+        continue;
+      }
+
+      const CGAL::Bbox_3 b = bboxes[sub];
+      const double xmid = (b.xmin() + b.xmax()) / 2.;
+      const double ymid = (b.ymin() + b.ymax()) / 2.;
+      const std::array<CGAL::Bbox_3, 4> children
+        = {{ CGAL::Bbox_3 (b.xmin(), b.ymin(), b.zmin(), xmid, ymid, b.zmax()),
+             CGAL::Bbox_3 (b.xmin(), ymid, b.zmin(), xmid, b.ymax(), b.zmax()),
+             CGAL::Bbox_3 (xmid, b.ymin(), b.zmin(), b.xmax(), ymid, b.zmax()),
+             CGAL::Bbox_3 (xmid, ymid, b.zmin(), b.xmax(), b.ymax(), b.zmax()) }};
+
+      std::array<std::vector<std::size_t>, 4> children_indices;
+      for (std::size_t s : indices[sub])
+      {
+        CGAL::Bbox_3 ib = get(item_map, *(input.begin() + s)).bbox();
+        children_indices[(ib.xmin() <= xmid ? 0 : 2) + (ib.ymin() <= ymid ? 0 : 1)].push_back (s);
+      }
+
+      const std::size_t depth = depths[sub] + 1;
+      bboxes[sub] = children[0];
+      indices[sub].swap (children_indices[0]);
+      depths[sub] = depth;
+      for (std::size_t c = 1; c < 4; ++ c)
+      {
+        bboxes.push_back (children[c]);
+        indices.emplace_back (std::move (children_indices[c]));
+        depths.push_back (depth);
+      }
     }
 
+#ifdef CGAL_CLASSIFICATION_VERBOSE
+    std::cerr << "Number of divisions after adaptive refinement = " << indices.size() << std::endl;
+#endif
+
+    std::vector<std::pair<std::size_t, std::size_t> > input_to_indices(input.size());
+    for (std::size_t sub = 0; sub < indices.size(); ++ sub)
+      for (std::size_t j = 0; j < indices[sub].size(); ++ j)
+        input_to_indices[indices[sub][j]] = std::make_pair (sub, j);
+
     CGAL::for_each<ConcurrencyTag>
       (CGAL::make_counting_range<std::size_t> (0, indices.size()),
        [&](const std::size_t& sub) -> bool
@@ -344,13 +406,14 @@ namespace Classification {
          std::vector<std::vector<double> > probability_matrix
            (labels.size(), std::vector<double>(indices[sub].size(), 0.));
          std::vector<std::size_t> assigned_label (indices[sub].size());
+         std::vector<std::size_t> neighbors;
+         std::vector<float> values;
 
          for (std::size_t j = 0; j < indices[sub].size(); ++ j)
          {
            std::size_t s = indices[sub][j];
 
-           std::vector<std::size_t> neighbors;
-
+           neighbors.clear();
            neighbor_query (get(item_map, *(input.begin()+s)), std::back_inserter (neighbors));
 
            for (std::size_t i = 0; i < neighbors.size(); ++ i)
@@ -361,7 +424,7 @@ namespace Classification {
                edge_weights.push_back (strength);
              }
 
-           std::vector<float> values;
+           values.clear();
            classifier(s, values);
            std::size_t nb_class_best = 0;
            float val_class_best = 0.f;
@@ -387,6 +450,165 @@ namespace Classification {
        });
   }
 
+  /*!
+    \ingroup PkgClassificationMain
+
+    \brief runs a classification tile by tile, so that the data
+    structures needed by the classification only exist for a few tiles
+    at a time.
+
+    The bounding rectangle of the input points in the XY plane is
+    split into square tiles of size `tile_size`. For each non-empty
+    tile, the points of the tile, followed by the points of the
+    neighboring tiles that are closer than `halo_size` to the tile (in
+    the XY plane), are given to `tile_classifier`. The halo allows the
+    features of the points close to the border of the tile to be
+    computed with complete neighborhoods. Only the labels of the points
+    of the tile itself are written to `output`.
+
+    `tile_classifier` typically generates the features of the tile with
+    a `Point_set_feature_generator`, instantiates a classifier that was
+    trained beforehand on the same features in the same order, and
+    calls one of the classification functions.
+
+    \tparam ConcurrencyTag enables sequential versus parallel
+    algorithm. Possible values are `Parallel_if_available_tag`,
+    `Parallel_tag` or `Sequential_tag`. With `Parallel_tag`, several
+    tiles are classified concurrently.
+    \tparam PointRange model of `ConstRange`. Its iterator type is
+    `RandomAccessIterator`.
+    \tparam PointMap model of `ReadablePropertyMap` whose key type is
+    the value type of the iterator of `PointRange` and value type is a
+    point type `Point` of a \cgal Kernel.
+    \tparam TileClassifier functor with an operator
+    `void operator()(const std::vector<Point>& points, std::vector<int>& label_indices) const`
+    that fills `label_indices`, which has the same size as `points`,
+    with the index (in the `Label_set`) of the label of each point.
+    With `Parallel_tag`, this operator is called concurrently.
+    \tparam OutputIterator model of `OutputIterator` accepting objects
+    of type `std::pair<std::size_t, int>`.
+
+    \param input input range.
+    \param point_map property map to access the input points.
+    \param tile_size length and width of the tiles.
+    \param halo_size width of the overlap around each tile.
+    \param tile_classifier classifies the points of a tile.
+    \param output where the result is written. For each input point, a
+    pair made of its index in `input` and of the index of its label is
+    written, tile by tile. With `Parallel_tag`, the order of the tiles
+    is not specified.
+
+    \pre `tile_size > 0`
+    \pre `0 <= halo_size <= tile_size`
+
+    \return the output iterator after all the pairs were written.
+  */
+  template <typename ConcurrencyTag,
+            typename PointRange,
+            typename PointMap,
+            typename TileClassifier,
+            typename OutputIterator>
+  OutputIterator classify_by_tiles (const PointRange& input,
+                                    const PointMap point_map,
+                                    const double tile_size,
+                                    const double halo_size,
+                                    const TileClassifier& tile_classifier,
+                                    OutputIterator output)
+  {
+    using Point = typename boost::property_traits<PointMap>::value_type;
+
+    CGAL_precondition (tile_size > 0.);
+    CGAL_precondition (halo_size >= 0. && halo_size <= tile_size);
+
+    if (input.empty())
+      return output;
+
+    CGAL::Bbox_3 bbox = CGAL::bbox_3
+      (CGAL::make_transform_iterator_from_property_map (input.begin(), point_map),
+       CGAL::make_transform_iterator_from_property_map (input.end(), point_map));
+
+    std::size_t nb_x = std::size_t((bbox.xmax() - bbox.xmin()) / tile_size) + 1;
+    std::size_t nb_y = std::size_t((bbox.ymax() - bbox.ymin()) / tile_size) + 1;
+
+    auto tile_coordinate = [&](double v, double vmin, std::size_t nb) -> std::size_t
+    {
+      return (std::min) (std::size_t((v - vmin) / tile_size), nb - 1);
+    };
+    auto tile_of = [&](const Point& p) -> std::size_t
+    {
+      return tile_coordinate (CGAL::to_double(p.x()), bbox.xmin(), nb_x) * nb_y
+        + tile_coordinate (CGAL::to_double(p.y()), bbox.ymin(), nb_y);
+    };
+
+    // Sort the indices of the points by tile
+    std::vector<std::size_t> tile_begin (nb_x * nb_y + 1, 0);
+    for (std::size_t s = 0; s < input.size(); ++ s)
+      ++ tile_begin[tile_of (get (point_map, *(input.begin() + s))) + 1];
+    for (std::size_t t = 0; t < nb_x * nb_y; ++ t)
+      tile_begin[t + 1] += tile_begin[t];
+
+    std::vector<std::size_t> tile_indices (input.size());
+    {
+      std::vector<std::size_t> cursor (tile_begin.begin(), tile_begin.end() - 1);
+      for (std::size_t s = 0; s < input.size(); ++ s)
+        tile_indices[cursor[tile_of (get (point_map, *(input.begin() + s)))] ++] = s;
+    }
+
+#ifdef CGAL_CLASSIFICATION_VERBOSE
+    std::cerr << "Number of tiles = " << nb_x * nb_y << std::endl;
+#endif
+
+    std::mutex output_mutex;
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t> (0, nb_x * nb_y),
+       [&](const std::size_t& t) -> bool
+       {
+         if (tile_begin[t] == tile_begin[t + 1])
+           return true;
+
+         const std::size_t tx = t / nb_y;
+         const std::size_t ty = t % nb_y;
+         const double xmin = bbox.xmin() + tx * tile_size - halo_size;
+         const double ymin = bbox.ymin() + ty * tile_size - halo_size;
+         const double xmax = bbox.xmin() + (tx + 1) * tile_size + halo_size;
+         const double ymax = bbox.ymin() + (ty + 1) * tile_size + halo_size;
+
+         std::vector<Point> points;
+         points.reserve (tile_begin[t + 1] - tile_begin[t]);
+         for (std::size_t i = tile_begin[t]; i < tile_begin[t + 1]; ++ i)
+           points.push_back (get (point_map, *(input.begin() + tile_indices[i])));
+
+         // The halo is smaller than a tile, so it only covers the neighboring tiles
+         if (halo_size > 0.)
+           for (std::size_t nx = (tx == 0 ? 0 : tx - 1); nx <= (std::min) (tx + 1, nb_x - 1); ++ nx)
+             for (std::size_t ny = (ty == 0 ? 0 : ty - 1); ny <= (std::min) (ty + 1, nb_y - 1); ++ ny)
+             {
+               const std::size_t n = nx * nb_y + ny;
+               if (n == t)
+                 continue;
+               for (std::size_t i = tile_begin[n]; i < tile_begin[n + 1]; ++ i)
+               {
+                 const Point& p = get (point_map, *(input.begin() + tile_indices[i]));
+                 const double x = CGAL::to_double (p.x());
+                 const double y = CGAL::to_double (p.y());
+                 if (xmin <= x && x <= xmax && ymin <= y && y <= ymax)
+                   points.push_back (p);
+               }
+             }
+
+         std::vector<int> label_indices (points.size(), -1);
+         tile_classifier (points, label_indices);
+
+         std::lock_guard<std::mutex> lock (output_mutex);
+         for (std::size_t i = tile_begin[t]; i < tile_begin[t + 1]; ++ i)
+           *output ++ = std::make_pair (tile_indices[i], label_indices[i - tile_begin[t]]);
+
+         return true;
+       });
+
+    return output;
+  }
 
 }
 
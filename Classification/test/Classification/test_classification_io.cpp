@@ -3,6 +3,7 @@
                               // converts 64 to 32 bits integers
 #endif
 
+#include <cmath>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
@@ -37,6 +38,15 @@ typedef Classification::Local_eigen_analysis
 typedef Classification::Feature::Distance_to_plane<Point_set, Point_map>      Distance_to_plane;
 typedef Classification::Feature::Elevation<Kernel, Point_set, Point_map>      Elevation;
 
+// Feature that only depends on the group (index modulo 4) of the item, so
+// that the items of a group have the same feature vector
+class Group_feature : public Classification::Feature_base
+{
+public:
+  Group_feature() { this->set_name ("group"); }
+  float value (std::size_t index) { return float(index % 4); }
+};
+
 int main (int, char**)
 {
   Point_set points;
@@ -100,5 +110,54 @@ int main (int, char**)
   assert (label_indices == label_indices_2);
   assert (label_indices == label_indices_3);
 
+  // classify() evaluates the forest by blocks of items: check that it
+  // gives the same result as the evaluation of each item
+  std::vector<std::size_t> label_indices_4 (points.size());
+  Classification::classify<CGAL::Parallel_if_available_tag> (points, labels, classifier, label_indices_4);
+  assert (label_indices == label_indices_4);
+
+  std::vector<float> values;
+  for (std::size_t i = 0; i < points.size(); ++ i)
+  {
+    classifier (i, values);
+    std::size_t best = 0;
+    for (std::size_t k = 1; k < labels.size(); ++ k)
+      if (values[best] < values[k])
+        best = k;
+    assert (label_indices[i] == best);
+  }
+
+  // Items with the same feature vector but different labels cannot be
+  // separated: the nodes holding them must vote with their distribution
+  Feature_set group_features;
+  group_features.add<Group_feature>();
+  std::vector<int> group_training_set (points.size());
+  for (std::size_t i = 0; i < points.size(); ++ i)
+    group_training_set[i] = (i % 4 == 0 ? int((i / 4) % 2) : int(i % 4) - 1);
+
+  Classifier group_classifier (labels, group_features);
+  group_classifier.train (group_training_set);
+
+  std::vector<std::size_t> group_label_indices (points.size());
+  Classification::classify<CGAL::Sequential_tag> (points, labels, group_classifier, group_label_indices);
+  for (std::size_t i = 0; i < points.size(); ++ i)
+  {
+    group_classifier (i, values);
+    float sum = 0.f;
+    std::size_t best = 0;
+    for (std::size_t k = 0; k < labels.size(); ++ k)
+    {
+      sum += values[k];
+      if (values[best] < values[k])
+        best = k;
+    }
+    assert (std::abs (sum - 1.f) < 1e-4f);
+    assert (group_label_indices[i] == best);
+    if (i % 4 == 0)
+      assert (values[2] == 0.f && group_label_indices[i] != 2);
+    else
+      assert (group_label_indices[i] == i % 4 - 1);
+  }
+
   return EXIT_SUCCESS;
 }
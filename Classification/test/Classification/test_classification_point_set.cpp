@@ -93,6 +93,21 @@ int main (int, char**)
   assert (generator.number_of_scales() == 5);
   assert (features.size() == 59);
 
+  // Scales computed sequentially or concurrently are identical
+  typedef Classification::Point_set_feature_generator<Kernel, Point_set, Point_map,
+                                                      CGAL::Sequential_tag> Sequential_feature_generator;
+  typedef Classification::Point_set_feature_generator<Kernel, Point_set, Point_map,
+                                                      CGAL::Parallel_if_available_tag> Parallel_feature_generator;
+  Sequential_feature_generator seq_generator (pts, pts.point_map(), 3, generator.grid_resolution());
+  Parallel_feature_generator par_generator (pts, pts.point_map(), 3, generator.grid_resolution());
+  for (std::size_t i = 0; i < 3; ++ i)
+  {
+    assert (seq_generator.grid_resolution(i) == par_generator.grid_resolution(i));
+    assert (seq_generator.grid(i).width() == par_generator.grid(i).width());
+    for (std::size_t j = 0; j < pts.size(); ++ j)
+      assert (seq_generator.eigen(i).eigenvalue(j) == par_generator.eigen(i).eigenvalue(j));
+  }
+
   Label_set labels;
 
   std::vector<int> training_set (pts.size(), -1);
@@ -129,6 +144,23 @@ int main (int, char**)
      generator.neighborhood().k_neighbor_query(12),
      0.2f, 10, label_indices);
 
+  // Subdivisions are independent: the parallel graph cut gives the
+  // same result, and dense subdivisions are refined without losing items
+  std::vector<int> graphcut_label_indices(pts.size(), -1);
+  Classification::classify_with_graphcut<CGAL::Parallel_if_available_tag>
+    (pts, pts.point_map(), labels, classifier,
+     generator.neighborhood().k_neighbor_query(12),
+     0.2f, 10, graphcut_label_indices);
+  assert (graphcut_label_indices == label_indices);
+
+  std::fill (graphcut_label_indices.begin(), graphcut_label_indices.end(), -1);
+  Classification::classify_with_graphcut<CGAL::Parallel_if_available_tag>
+    (pts, pts.point_map(), labels, classifier,
+     generator.neighborhood().k_neighbor_query(12),
+     0.2f, 200, graphcut_label_indices);
+  for (int l : graphcut_label_indices)
+    assert (l >= 0 && std::size_t(l) < labels.size());
+
 #ifdef CGAL_LINKED_WITH_TBB
   Classification::classify<CGAL::Sequential_tag>
     (pts, labels, classifier, label_indices);
@@ -146,5 +178,53 @@ int main (int, char**)
 
   Classification::Evaluation evaluation (labels, training_set, label_indices);
 
+  // Tiled classification, using point based features only
+  typedef std::vector<Point> Tile;
+  typedef CGAL::Identity_property_map<Point> Tile_point_map;
+  typedef Classification::Point_set_feature_generator<Kernel, Tile, Tile_point_map> Tile_feature_generator;
+
+  Feature_set point_features;
+  generator.generate_point_based_features(point_features);
+  Classifier point_classifier (labels, point_features);
+  point_classifier.train<CGAL::Sequential_tag> (training_set, 100);
+
+  auto classify_tile = [&](const Tile& points, std::vector<int>& tile_label_indices)
+  {
+    Tile_feature_generator tile_generator (points, Tile_point_map(), generator.number_of_scales(),
+                                           generator.grid_resolution());
+    Feature_set tile_features;
+    tile_generator.generate_point_based_features(tile_features);
+    Classifier tile_classifier (point_classifier, tile_features);
+    Classification::classify<CGAL::Sequential_tag> (points, labels, tile_classifier, tile_label_indices);
+  };
+
+  // a single tile reproduces the classification of the whole point set
+  std::vector<int> point_label_indices (pts.size(), -1);
+  Classification::classify<CGAL::Sequential_tag>
+    (pts, labels, point_classifier, point_label_indices);
+
+  std::vector<std::pair<std::size_t, int> > tiled_labels;
+  Classification::classify_by_tiles<CGAL::Sequential_tag>
+    (pts, pts.point_map(), 2., 0., classify_tile, std::back_inserter (tiled_labels));
+  assert (tiled_labels.size() == pts.size());
+  for (std::size_t i = 0; i < tiled_labels.size(); ++ i)
+  {
+    assert (tiled_labels[i].first == i);
+    assert (tiled_labels[i].second == point_label_indices[i]);
+  }
+
+  // each point is classified exactly once
+  tiled_labels.clear();
+  Classification::classify_by_tiles<CGAL::Parallel_if_available_tag>
+    (pts, pts.point_map(), 0.5, 0.1, classify_tile, std::back_inserter (tiled_labels));
+  assert (tiled_labels.size() == pts.size());
+  std::vector<bool> classified (pts.size(), false);
+  for (const std::pair<std::size_t, int>& tl : tiled_labels)
+  {
+    assert (!classified[tl.first]);
+    classified[tl.first] = true;
+    assert (tl.second >= 0 && tl.second < int(labels.size()));
+  }
+
   return EXIT_SUCCESS;
 }
@@ -26,6 +26,8 @@
 #include <CGAL/squared_distance_3.h>
 #include <CGAL/number_utils.h>
 #include <CGAL/Default.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
 
 #ifdef CGAL_EIGEN3_ENABLED
 #include <CGAL/Eigen_solver_traits.h>
@@ -33,6 +35,8 @@
 
 #include <CGAL/Weights/utils.h>
 #include <boost/range/has_range_iterator.hpp>
+#include <boost/range/irange.hpp>
+#include <boost/range/value_type.hpp>
 
 #include <vector>
 #include <set>
@@ -240,20 +244,26 @@ private:
 
   void
   update_kronecker_delta()
+  {
+    kronecker_delta(sources(), m_kronecker);
+  }
+
+  void
+  kronecker_delta(const Vertex_const_range& source_set, Matrix& kronecker) const
   {
     //currently just working with a single vertex in source set, add the first one for now
     Index i;
     Matrix K(static_cast<int>(num_vertices(tm)), 1);
-    if(sources().empty()) {
+    if(source_set.empty()) {
       i = 0;
       K.set_coef(i,0, 1, true);
     } else {
-      for(vertex_descriptor vd : sources()){
+      for(vertex_descriptor vd : source_set){
         i = get(vertex_id_map, vd);
         K.set_coef(i,0, 1, true);
       }
     }
-    m_kronecker.swap(K);
+    kronecker.swap(K);
   }
 
   const Matrix&
@@ -286,14 +296,20 @@ private:
 
   void
   compute_unit_gradient()
+  {
+    compute_unit_gradient(m_solved_u, m_X);
+  }
+
+  void
+  compute_unit_gradient(const Vector& solved_u, std::vector<Vector_3>& X) const
   {
     typename Traits::Construct_vector_3 construct_vector = Traits().construct_vector_3_object();
     typename Traits::Construct_sum_of_vectors_3 sum = Traits().construct_sum_of_vectors_3_object();
     typename Traits::Compute_scalar_product_3 scalar_product = Traits().compute_scalar_product_3_object();
     typename Traits::Construct_cross_product_vector_3 cross_product = Traits().construct_cross_product_vector_3_object();
     typename Traits::Construct_scaled_vector_3 scale = Traits().construct_scaled_vector_3_object();
-    if(m_X.empty()){
-      m_X.resize(num_faces(tm));
+    if(X.empty()){
+      X.resize(num_faces(tm));
     }
     CGAL::Vertex_around_face_iterator<TriangleMesh> vbegin, vend, vmiddle;
     for(face_descriptor f : faces(tm)) {
@@ -323,9 +339,9 @@ private:
       double N_cross = (CGAL::sqrt(to_double(scalar_product(cross,cross))));
       Vector_3 unit_cross = scale(cross, 1./N_cross);
       double area_face = N_cross * (1./2);
-      double u_i = CGAL::abs(m_solved_u(i));
-      double u_j = CGAL::abs(m_solved_u(j));
-      double u_k = CGAL::abs(m_solved_u(k));
+      double u_i = CGAL::abs(solved_u(i));
+      double u_j = CGAL::abs(solved_u(j));
+      double u_k = CGAL::abs(solved_u(k));
       double r_Mag = 1./(std::max)((std::max)(u_i, u_j),u_k);
       /* normalize heat values so that they have roughly unit magnitude */
       if(!std::isinf(r_Mag)) {
@@ -338,12 +354,18 @@ private:
       edge_sums = sum(edge_sums, scale(cross_product(unit_cross, construct_vector(p_k,p_i)), u_j));
       edge_sums = scale(edge_sums, (1./area_face));
       double e_magnitude = CGAL::sqrt(to_double(scalar_product(edge_sums,edge_sums)));
-      m_X[face_i] = scale(edge_sums,(1./e_magnitude));
+      X[face_i] = scale(edge_sums,(1./e_magnitude));
     }
   }
 
   void
   compute_divergence()
+  {
+    compute_divergence(m_X, m_index_divergence);
+  }
+
+  void
+  compute_divergence(const std::vector<Vector_3>& X, Matrix& index_divergence) const
   {
     typename Traits::Compute_scalar_product_3 scalar_product = Traits().compute_scalar_product_3_object();
     typename Traits::Construct_vector_3 construct_vector = Traits().construct_vector_3_object();
@@ -374,7 +396,7 @@ private:
       const FT cotan_j = CGAL::Weights::cotangent(p_k, p_j, p_i, traits);
       const FT cotan_k = CGAL::Weights::cotangent(p_j, p_k, p_i, traits);
 
-      const Vector_3& a = m_X[face_i];
+      const Vector_3& a = X[face_i];
       const double i_entry = (CGAL::to_double(scalar_product(a, v_ij) * cotan_k)) +
                              (CGAL::to_double(scalar_product(a, v_ik) * cotan_j));
       const double j_entry = (CGAL::to_double(scalar_product(a, v_jk) * cotan_i)) +
@@ -386,15 +408,21 @@ private:
       indexD.add_coef(j, 0, (1./2)*j_entry);
       indexD.add_coef(k, 0, (1./2)*k_entry);
     }
-    indexD.swap(m_index_divergence);
+    indexD.swap(index_divergence);
   }
 
   // modifies m_solved_phi
   void
   value_at_source_set(const Vector& phi)
+  {
+    value_at_source_set(phi, sources(), m_solved_phi);
+  }
+
+  void
+  value_at_source_set(const Vector& phi, const Vertex_const_range& source_set, Vector& solved_phi) const
   {
     Vector source_set_val(dimension);
-    if(sources().empty()) {
+    if(source_set.empty()) {
       for(int k = 0; k<dimension; k++) {
         source_set_val(k,0) = phi.coeff(0,0);
       }
@@ -404,7 +432,7 @@ private:
         double min_val = (std::numeric_limits<double>::max)();
         Index vd_index;
         //go through the distances to the sources and leave the minimum distance;
-        for(vertex_descriptor vd : sources()){
+        for(vertex_descriptor vd : source_set){
           vd_index = get(vertex_id_map, vd);
           double new_d = CGAL::abs(-phi.coeff(vd_index,0)+phi.coeff(i,0));
           if(phi.coeff(vd_index,0)==phi.coeff(i,0)) {
@@ -417,7 +445,7 @@ private:
         source_set_val(i,0) = min_val;
       }
     }
-    m_solved_phi.swap(source_set_val);
+    solved_phi.swap(source_set_val);
   }
 
   void
@@ -477,6 +505,60 @@ public:
     }
   }
 
+  /**
+   *  Fills the i-th distance property map of `vdms` with the distances to the i-th source set of `source_sets`.
+   *  The factorizations of `build()` are shared by all source sets, and the current source set is left unchanged.
+   **/
+  template<class ConcurrencyTag, class SourceSetRange, class VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    if(is_empty(tm)){
+      return;
+    }
+    std::vector<Vertex_const_range> source_set_vector;
+    for(const auto& source_set : source_sets){
+      source_set_vector.emplace_back();
+      for(const auto& vd : source_set){
+        source_set_vector.back().insert(v2v(vd));
+      }
+    }
+    CGAL_precondition(source_set_vector.size() <= static_cast<std::size_t>(std::distance(std::begin(vdms), std::end(vdms))));
+
+    // The solvers are only read after their factorization, so that the
+    // source sets can be processed independently.
+    CGAL::for_each<ConcurrencyTag>(
+      boost::irange<std::size_t>(0, source_set_vector.size()),
+      [&](const std::size_t s) -> bool
+      {
+        const Vertex_const_range& source_set = source_set_vector[s];
+        Matrix kronecker;
+        kronecker_delta(source_set, kronecker);
+        Vector solved_u;
+        if(! la.linear_solver(kronecker, solved_u)) {
+          // solving failed
+          CGAL_error_msg("Eigen Solving in cotan failed");
+        }
+        std::vector<Vector_3> X;
+        compute_unit_gradient(solved_u, X);
+        Matrix index_divergence;
+        compute_divergence(X, index_divergence);
+        Vector phi;
+        if(! la_cotan.linear_solver(index_divergence, phi)) {
+          // solving failed
+          CGAL_error_msg("Eigen Solving in solve_phi() failed");
+        }
+        Vector solved_phi;
+        value_at_source_set(phi, source_set, solved_phi);
+
+        auto vdm = *std::next(std::begin(vdms), s);
+        for(vertex_descriptor vd : vertices(tm)){
+          put(vdm, vd, solved_phi(get(vertex_id_map, vd), 0));
+        }
+        return true;
+      });
+  }
+
 private:
   void
   build()
@@ -631,6 +713,16 @@ struct Base_helper
         base().triangle_mesh(), Traits()));
     base().estimate_geodesic_distances(vdm);
   }
+
+  template <class ConcurrencyTag, class SourceSetRange, class VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    CGAL_assertion(
+      !CGAL::Heat_method_3::internal::has_degenerate_faces(
+        base().triangle_mesh(), Traits()));
+    base().template estimate_geodesic_distances<ConcurrencyTag>(source_sets, vdms);
+  }
 };
 
 template<class TriangleMesh,
@@ -690,6 +782,18 @@ struct Base_helper<TriangleMesh, Traits, Intrinsic_Delaunay, LA, VertexPointMap>
   {
     base().estimate_geodesic_distances(this->m_idt.vertex_distance_map(vdm));
   }
+
+  template <class ConcurrencyTag, class SourceSetRange, class VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    typedef typename boost::range_value<VertexDistanceMapRange>::type VertexDistanceMap;
+    std::vector<IDT_vertex_distance_property_map<Idt, VertexDistanceMap> > idt_vdms;
+    for(const VertexDistanceMap& vdm : vdms){
+      idt_vdms.push_back(this->m_idt.vertex_distance_map(vdm));
+    }
+    base().template estimate_geodesic_distances<ConcurrencyTag>(source_sets, idt_vdms);
+  }
 };
 
 } // namespace internal
@@ -885,6 +989,39 @@ public:
   {
     Base_helper::estimate_geodesic_distances(vdm);
   }
+
+  /**
+   * fills, for each source set of `source_sets`, the distance property map of `vdms` at the same position
+   * with the estimated geodesic distance of each vertex to the closest vertex of that source set.
+   * The preprocessing step is shared by all source sets, so that this is faster than calling
+   * `estimate_geodesic_distances(vdm)` once per source set, and the source sets are processed
+   * independently, in parallel if `ConcurrencyTag` is `Parallel_tag`.
+   * The source set of the class, handled by `add_source()` and `remove_source()`, is not modified.
+   *
+   * A dense distance matrix is obtained with one property map per column, and a larger set of
+   * sources can be processed in several calls, for example in tiles of a memory-mapped matrix.
+   *
+   * \tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+   *         `Parallel_tag`, and `Parallel_if_available_tag`. The default is `Sequential_tag`.
+   * \tparam SourceSetRange a model of the concept `ConstRange`, whose value type is a model of `ConstRange`
+   *         with value type `vertex_descriptor`
+   * \tparam VertexDistanceMapRange a model of the concept `ConstRange` with a random access iterator,
+   *         whose value type is a property map model of `WritablePropertyMap`
+   *         with `vertex_descriptor` as key type and `double` as value type.
+   * \param source_sets the source sets
+   * \param vdms the vertex distance maps to be filled, with at least as many elements as `source_sets`
+   * \pre If `Mode` is `Direct`, the support triangle mesh does not have any degenerate faces
+   * \pre If `ConcurrencyTag` is `Parallel_tag`, `LA::linear_solver()` can be called concurrently once the
+   *      matrix is factored, which is the case of `Eigen_solver_traits`, and the maps of `vdms` can be
+   *      written concurrently.
+   * \warning The key type is `double` even when used with an exact kernel.
+   **/
+  template <typename ConcurrencyTag = Sequential_tag, typename SourceSetRange, typename VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    Base_helper::template estimate_geodesic_distances<ConcurrencyTag>(source_sets, vdms);
+  }
 };
 
 #if defined(DOXYGEN_RUNNING) || defined(CGAL_EIGEN3_ENABLED)
@@ -0,0 +1,77 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Heat_method_3/Surface_mesh_geodesic_distances_3.h>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+
+typedef CGAL::Simple_cartesian<double>                       Kernel;
+typedef Kernel::Point_3                                      Point_3;
+typedef CGAL::Surface_mesh<Point_3>                          Surface_mesh;
+
+typedef boost::graph_traits<Surface_mesh>::vertex_descriptor vertex_descriptor;
+typedef Surface_mesh::Property_map<vertex_descriptor,double> Vertex_distance_map;
+
+
+// compares the distances to several source sets computed at once
+// with the distances to each source set computed separately
+template <typename Mode, typename ConcurrencyTag>
+void test(Surface_mesh& sm)
+{
+  typedef CGAL::Heat_method_3::Surface_mesh_geodesic_distances_3<Surface_mesh, Mode> Heat_method;
+
+  std::vector<std::vector<vertex_descriptor> > source_sets;
+  std::vector<vertex_descriptor> vds(vertices(sm).begin(), vertices(sm).end());
+  for(std::size_t i = 0; i < 10; ++i){
+    source_sets.push_back(std::vector<vertex_descriptor>(1, vds[(i * 37) % vds.size()]));
+  }
+  source_sets.push_back({vds[0], vds[vds.size() / 2]});
+
+  std::vector<Vertex_distance_map> vdms;
+  for(std::size_t i = 0; i < source_sets.size(); ++i){
+    vdms.push_back(sm.add_property_map<vertex_descriptor, double>("v:distance_" + std::to_string(i), 0).first);
+  }
+  Vertex_distance_map vertex_distance = sm.add_property_map<vertex_descriptor, double>("v:distance", 0).first;
+
+  Heat_method hm(sm);
+  hm.add_source(vds[1]);
+  hm.template estimate_geodesic_distances<ConcurrencyTag>(source_sets, vdms);
+  assert(hm.sources().size() == 1);
+
+  for(std::size_t i = 0; i < source_sets.size(); ++i){
+    hm.clear_sources();
+    hm.add_sources(source_sets[i]);
+    hm.estimate_geodesic_distances(vertex_distance);
+    for(vertex_descriptor vd : vertices(sm)){
+      assert(CGAL::abs(get(vdms[i], vd) - get(vertex_distance, vd)) < 1e-10);
+    }
+    for(vertex_descriptor vd : source_sets[i]){
+      assert(get(vdms[i], vd) == 0);
+    }
+  }
+
+  for(Vertex_distance_map& vdm : vdms){
+    sm.remove_property_map(vdm);
+  }
+  sm.remove_property_map(vertex_distance);
+}
+
+int main(int argc, char* argv[])
+{
+  //read in mesh
+  Surface_mesh sm;
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/larger_sphere.off");
+  std::ifstream in(filename);
+  in >> sm;
+
+  test<CGAL::Heat_method_3::Direct, CGAL::Sequential_tag>(sm);
+  test<CGAL::Heat_method_3::Intrinsic_Delaunay, CGAL::Sequential_tag>(sm);
+#ifdef CGAL_LINKED_WITH_TBB
+  test<CGAL::Heat_method_3::Direct, CGAL::Parallel_tag>(sm);
+  test<CGAL::Heat_method_3::Intrinsic_Delaunay, CGAL::Parallel_tag>(sm);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
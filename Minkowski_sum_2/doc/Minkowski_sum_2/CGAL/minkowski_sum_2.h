@@ -34,9 +34,18 @@ has many holes.
 
 - `Polygon_2`
 - `Polygon_with_holes_2`
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag` (the default), `Parallel_tag`, and
+`Parallel_if_available_tag`. With `Parallel_tag`, the convolution cycles of
+the pairs of boundary loops of `P` and `Q` are computed concurrently, and so
+are the tests that determine which faces of the arrangement of the
+convolution are holes of the sum. The arrangement itself is constructed
+sequentially.
 */
 
-template <typename Kernel, typename Container>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Kernel, typename Container>
 Polygon_with_holes_2<Kernel, Container>
 minkowski_sum_by_reduced_convolution_2(const PolygonType1<Kernel, Container>& P,
                                        const PolygonType2<Kernel, Container>& Q);
@@ -64,11 +64,16 @@ public:
       m_translating_tree.insert(it->edges_begin(), it->edges_end());
       ++it;
     }
+
+    // Build the trees now: the lazy build in the const queries is not safe
+    // when check_collision() is called from several threads
+    m_stationary_tree.build();
+    m_translating_tree.build();
   }
 
   // Returns true iff the polygons' boundaries intersect or one polygon is
   // completely inside of the other one. Q is translated by t.
-  bool check_collision(const Point_2 &t)
+  bool check_collision(const Point_2 &t) const
   {
     if (m_stationary_tree.do_intersect(m_translating_tree, t)) return true;
 
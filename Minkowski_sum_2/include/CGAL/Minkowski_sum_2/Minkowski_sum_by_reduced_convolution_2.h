@@ -18,12 +18,17 @@
 #include <CGAL/basic.h>
 #include <CGAL/Arrangement_with_history_2.h>
 #include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Minkowski_sum_2/AABB_collision_detector_2.h>
 #include <boost/functional/hash.hpp>
+#include <boost/range/irange.hpp>
 
 #include <queue>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace CGAL {
 
@@ -31,11 +36,22 @@ namespace CGAL {
 // and Robust 2D Minkowski Sum Using Reduced Convolution", IROS 2011.
 // This implementation is based on Alon Baram's 2013 master's thesis "Polygonal
 // Minkowski Sums via Convolution: Theory and Practice" at Tel-Aviv University.
-template <typename Kernel_, typename Container_>
+//
+// With ConcurrencyTag = Parallel_tag, the convolution cycles of the pairs of
+// boundary loops are generated concurrently, and so are the orientation and
+// collision tests that determine which faces of the arrangement are holes.
+template <typename Kernel_, typename Container_,
+          typename ConcurrencyTag_ = Sequential_tag>
 class Minkowski_sum_by_reduced_convolution_2 {
 private:
   typedef Kernel_ Kernel;
   typedef Container_ Container;
+  typedef ConcurrencyTag_ Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
 
   // Basic types:
   typedef CGAL::Polygon_2<Kernel, Container> Polygon_2;
@@ -132,7 +148,7 @@ private:
     // pgn1:
     const Polygon_with_holes_2 inversed_pgn1 =
       transform(Aff_transformation_2<Kernel>(SCALING, -1), pgn1);
-    AABB_collision_detector_2<Kernel, Container>
+    const AABB_collision_detector_2<Kernel, Container>
       collision_detector(pgn2, inversed_pgn1);
 
     // Compute the reduced convolution (see section 4.1 of Alon's master's
@@ -154,6 +170,7 @@ private:
 
     // Check for each face whether it is a hole in the M-sum. If it is, add it
     // to 'holes'. See chapter 3 of of Alon's master's thesis.
+    std::vector<Face_const_handle> candidates;
     for (auto fit = arr.faces_begin(); fit != arr.faces_end(); ++fit) {
       // Check whether the face is on the M-sum's border.
 
@@ -163,16 +180,32 @@ private:
       // If the face contains holes, it can't be on the Minkowski sum's border
       if (0 < fit->number_of_holes()) continue;
 
-      // The face needs to be orientable
-      if (! test_face_orientation(arr, fit)) continue;
-
-      // When the reversed polygon 1, translated by a point inside of this
-      // face, collides with polygon 2, this cannot be a hole
-      Point_2 inner_point = get_point_in_face(fit);
-      if (collision_detector.check_collision(inner_point)) continue;
-
-      add_face(fit, holes);
+      candidates.push_back(fit);
     }
+
+    // The remaining tests are independent for each face. Their results are
+    // gathered first, so that the holes are reported in the face order.
+    std::vector<char> is_hole(candidates.size(), 0);
+    CGAL::for_each<Concurrency_tag>
+      (boost::irange<std::size_t>(0, candidates.size()),
+       [&](std::size_t i) -> bool
+       {
+         Face_const_handle fh = candidates[i];
+
+         // The face needs to be orientable
+         if (! test_face_orientation(arr, fh)) return true;
+
+         // When the reversed polygon 1, translated by a point inside of this
+         // face, collides with polygon 2, this cannot be a hole
+         Point_2 inner_point = get_point_in_face(fh);
+         if (collision_detector.check_collision(inner_point)) return true;
+
+         is_hole[i] = 1;
+         return true;
+       });
+
+    for (std::size_t i = 0; i < candidates.size(); ++i)
+      if (is_hole[i]) add_face(candidates[i], holes);
   }
 
   /*! \brief builds the reduced convolution for each pair of loops in the two
@@ -181,36 +214,30 @@ private:
   void build_reduced_convolution(const Polygon_with_holes_2& pgnwh1,
                                  const Polygon_with_holes_2& pgnwh2,
                                  Segment_list& reduced_convolution) const {
-    for (std::size_t x = 0; x < 1+pgnwh1.number_of_holes(); ++x) {
-      for (std::size_t y = 0; y < 1+pgnwh2.number_of_holes(); ++y) {
-        if ((x != 0) && (y != 0)) continue;
-        if (x == 0) {
-          const auto& pgn1 = pgnwh1.outer_boundary();
-          if (y == 0) {
-            const auto& pgn2 = pgnwh2.outer_boundary();
-            build_reduced_convolution(pgn1, pgn2, reduced_convolution);
-          }
-          else {
-            auto it2 = pgnwh2.holes_begin();
-            for (std::size_t count = 0; count < y-1; ++count) ++it2;
-            build_reduced_convolution(pgn1, *it2, reduced_convolution);
-          }
-        }
-        else {
-          auto it1 = pgnwh1.holes_begin();
-          for (std::size_t count = 0; count < x-1; ++count) ++it1;
-          if (y == 0) {
-            const auto& pgn2 = pgnwh2.outer_boundary();
-            build_reduced_convolution(*it1, pgn2, reduced_convolution);
-          }
-          else {
-            auto it2 = pgnwh2.holes_begin();
-            for (std::size_t count = 0; count < y-1; ++count) ++it2;
-            build_reduced_convolution(*it1, *it2, reduced_convolution);
-          }
-        }
-      }
-    }
+    // Collect the pairs of loops: the outer boundary of each polygon is
+    // paired with the outer boundary and the holes of the other one.
+    std::vector<std::pair<const Polygon_2*, const Polygon_2*>> loop_pairs;
+    const Polygon_2& outer1 = pgnwh1.outer_boundary();
+    const Polygon_2& outer2 = pgnwh2.outer_boundary();
+    loop_pairs.push_back(std::make_pair(&outer1, &outer2));
+    for (auto it2 = pgnwh2.holes_begin(); it2 != pgnwh2.holes_end(); ++it2)
+      loop_pairs.push_back(std::make_pair(&outer1, &*it2));
+    for (auto it1 = pgnwh1.holes_begin(); it1 != pgnwh1.holes_end(); ++it1)
+      loop_pairs.push_back(std::make_pair(&*it1, &outer2));
+
+    // The convolution cycles of the pairs are independent.
+    std::vector<Segment_list> convolutions(loop_pairs.size());
+    CGAL::for_each<Concurrency_tag>
+      (boost::irange<std::size_t>(0, loop_pairs.size()),
+       [&](std::size_t i) -> bool
+       {
+         build_reduced_convolution(*(loop_pairs[i].first),
+                                   *(loop_pairs[i].second), convolutions[i]);
+         return true;
+       });
+
+    for (Segment_list& convolution : convolutions)
+      reduced_convolution.splice(reduced_convolution.end(), convolution);
   }
 
   /*! \brief builds the reduced convolution using a fiber grid approach. For
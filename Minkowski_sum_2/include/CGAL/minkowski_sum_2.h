@@ -42,7 +42,8 @@ namespace CGAL {
  * \param[in] pgn2 The second polygon.
  * \pre Both `P` and `Q` are simple, counterclockwise-oriented polygons.
  */
-template <typename Kernel_, typename Container_>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Kernel_, typename Container_>
 Polygon_with_holes_2<Kernel_, Container_>
 minkowski_sum_by_reduced_convolution_2(const Polygon_2<Kernel_,
                                        Container_>& pgn1,
@@ -52,7 +53,8 @@ minkowski_sum_by_reduced_convolution_2(const Polygon_2<Kernel_,
   typedef Kernel_                                    Kernel;
   typedef Container_                                 Container;
 
-  Minkowski_sum_by_reduced_convolution_2<Kernel, Container> mink_sum;
+  Minkowski_sum_by_reduced_convolution_2<Kernel, Container, ConcurrencyTag>
+                                                            mink_sum;
   Polygon_2<Kernel, Container>                              sum_bound;
   std::list<Polygon_2<Kernel, Container> >                  sum_holes;
 
@@ -76,7 +78,8 @@ minkowski_sum_by_reduced_convolution_2(const Polygon_2<Kernel_,
  * \param[in] pgn1 The first polygon.
  * \param[in] pgn2 The second polygon.
  */
-template <typename Kernel_, typename Container_>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Kernel_, typename Container_>
 Polygon_with_holes_2<Kernel_, Container_>
 minkowski_sum_by_reduced_convolution_2
 (const Polygon_with_holes_2<Kernel_, Container_>& pgn1,
@@ -93,7 +96,8 @@ minkowski_sum_by_reduced_convolution_2
   hole_filter(pgn1, pgn2, filtered_pgn1);
   hole_filter(pgn2, pgn1, filtered_pgn2);
 
-  Minkowski_sum_by_reduced_convolution_2<Kernel, Container> mink_sum;
+  Minkowski_sum_by_reduced_convolution_2<Kernel, Container, ConcurrencyTag>
+                                                            mink_sum;
   Polygon_2<Kernel, Container>                              sum_bound;
   std::list<Polygon_2<Kernel, Container> >                  sum_holes;
 
@@ -116,7 +120,8 @@ minkowski_sum_by_reduced_convolution_2
  * \param[in] pgn1 The simple polygon.
  * \param[in] pgn2 The polygon with holes.
  */
-template <typename Kernel_, typename Container_>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Kernel_, typename Container_>
 Polygon_with_holes_2<Kernel_, Container_>
 minkowski_sum_by_reduced_convolution_2
 (const Polygon_2<Kernel_, Container_>& pgn1,
@@ -128,7 +133,8 @@ minkowski_sum_by_reduced_convolution_2
   Hole_filter_2<Kernel, Container> hole_filter;
   Polygon_with_holes_2<Kernel, Container> filtered_pgn2;
   hole_filter(pgn2, pgn1, filtered_pgn2);
-  Minkowski_sum_by_reduced_convolution_2<Kernel, Container> mink_sum;
+  Minkowski_sum_by_reduced_convolution_2<Kernel, Container, ConcurrencyTag>
+                                                            mink_sum;
   Polygon_2<Kernel, Container>                              sum_bound;
   std::list<Polygon_2<Kernel, Container> >                  sum_holes;
   mink_sum(pgn1, filtered_pgn2, sum_bound, std::back_inserter(sum_holes));
@@ -148,12 +154,13 @@ minkowski_sum_by_reduced_convolution_2
  * \param[in] pgn1 The polygon with holes.
  * \param[in] pgn2 The simple polygon.
  */
-template <typename Kernel_, typename Container_>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Kernel_, typename Container_>
 Polygon_with_holes_2<Kernel_, Container_>
 minkowski_sum_by_reduced_convolution_2
 (const Polygon_with_holes_2<Kernel_, Container_>& pgn1,
  const Polygon_2<Kernel_, Container_>& pgn2)
-{ return minkowski_sum_by_reduced_convolution_2(pgn2, pgn1); }
+{ return minkowski_sum_by_reduced_convolution_2<ConcurrencyTag>(pgn2, pgn1); }
 
 /*!
  * Compute the Minkowski sum of two simple polygons using the (full)
@@ -24,6 +24,7 @@ bool are_equal(const Polygon_with_holes_2& ph1,
 
 typedef enum {
   REDUCED_CONVOLUTION,
+  PARALLEL_REDUCED_CONVOLUTION,
   VERTICAL_DECOMPOSITION,
   TRIANGULATION_DECOMPOSITION,
   VERTICAL_AND_ANGLE_BISECTOR_DECOMPOSITION,
@@ -33,6 +34,7 @@ typedef enum {
 
 static const char* strategy_names[] = {
   "reduced convolution",
+  "parallel reduced convolution",
   "vertical decomposition",
   "constrained triangulation decomposition",
   "vertical and angle bisector decomposition",
@@ -48,6 +50,10 @@ Polygon_with_holes_2 compute_minkowski_sum_2(Polygon_with_holes_2& p,
    case REDUCED_CONVOLUTION:
      return CGAL::minkowski_sum_by_reduced_convolution_2(p, q);
 
+   case PARALLEL_REDUCED_CONVOLUTION:
+     return CGAL::minkowski_sum_by_reduced_convolution_2
+       <CGAL::Parallel_if_available_tag>(p, q);
+
    case VERTICAL_DECOMPOSITION:
     {
      CGAL::Polygon_vertical_decomposition_2<Kernel> decomp;
@@ -158,6 +164,7 @@ int main(int argc, char* argv[])
       for (std::size_t j = 1; j < strlen(argv[i]); ++j) {
         switch (argv[i][j]) {
          case 'r': strategies.push_back(REDUCED_CONVOLUTION); break;
+         case 'p': strategies.push_back(PARALLEL_REDUCED_CONVOLUTION); break;
          case 'v': strategies.push_back(VERTICAL_DECOMPOSITION); break;
          case 't': strategies.push_back(TRIANGULATION_DECOMPOSITION); break;
          case 'w':
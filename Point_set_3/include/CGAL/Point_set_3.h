@@ -29,7 +29,6 @@
 #include <algorithm>
 #include <iterator>
 #include <sstream>
-#include <stack>
 #include <utility>
 #include <vector>
 
@@ -438,8 +437,11 @@ public:
         -- m_nb_removed;
         iterator out = m_indices.end() - m_nb_removed - 1;
         Index idx = *out;
-        m_base.reset(*out);
-        *out = idx;
+        // Resetting the properties of `idx` also resets the entry of
+        // the index map stored at position `idx`, which must be kept
+        Index idx_at_idx = m_indices[idx];
+        m_base.reset(idx);
+        m_indices[idx] = idx_at_idx;
         return out;
       }
   }
@@ -463,7 +465,7 @@ public:
   iterator insert (const Point& p)
   {
     iterator out = insert();
-    m_points[size()-1] = p;
+    m_points[*out] = p;
     return out;
   }
 
@@ -491,7 +493,7 @@ public:
   iterator insert (const Point& p, const Vector& n)
   {
     iterator out = insert (p);
-    normal_map()[size()-1] = n;
+    normal_map()[*out] = n;
     return out;
   }
 
@@ -522,8 +524,9 @@ public:
   {
     iterator out = insert();
     Index new_idx = *out;
+    Index idx_at_new_idx = m_indices[new_idx];
     m_base.transfer(other.base(), idx, new_idx);
-    *out = new_idx; // Do not copy index from other point set
+    m_indices[new_idx] = idx_at_new_idx; // Do not copy index from other point set
     return out;
   }
 
@@ -604,7 +607,6 @@ public:
         while (source != last // All elements have been moved
                && dest != last - 1) // All elements are at the end of the container
           {
-            std::cerr << "Swapping " << *source << " and " << *dest << std::endl;
             std::swap (*(source ++), *(dest --));
           }
       }
@@ -713,23 +715,22 @@ public:
 
   /*!
     \brief erases from memory the elements marked as removed.
+
+    The remaining elements keep their order and get the indices `0` to
+    `size()-1`, in time linear in the number of elements.
+
+    \note All iterators, pointers, references, and indices related to the
+    container are invalidated.
   */
   void collect_garbage ()
   {
-    // Indices indicate where to get the properties
-    std::vector<std::size_t> indices (m_base.size());
-    for (std::size_t i = 0; i < m_base.size(); ++ i)
-      indices[m_indices[i]] = i;
+    // The properties of the elements that are not removed are gathered
+    // in the order of iteration, in linear time
+    std::vector<std::size_t> order (m_indices.begin(), m_indices.end() - m_nb_removed);
+    m_base.gather (order);
 
-    // Indices now indicate where to put the properties
     for (std::size_t i = 0; i < m_base.size(); ++ i)
-      m_indices[i] = indices[i];
-
-    // Sorting based on the indices reorders the point set correctly
-    quick_sort_on_indices ((std::ptrdiff_t)0, (std::ptrdiff_t)(m_base.size() - 1));
-
-    m_base.resize (size ());
-    m_base.shrink_to_fit ();
+      m_indices[i] = i;
     m_nb_removed = 0;
   }
 
@@ -1238,47 +1239,6 @@ public:
 
   /// @}
 
-
-private:
-  /// \cond SKIP_IN_MANUAL
-  void quick_sort_on_indices (std::ptrdiff_t begin, std::ptrdiff_t end)
-  {
-    std::stack<std::pair<std::ptrdiff_t, std::ptrdiff_t> >
-      todo;
-    todo.push (std::make_pair (begin, end));
-
-    while (!(todo.empty()))
-      {
-        std::pair<std::ptrdiff_t, std::ptrdiff_t>
-          current = todo.top();
-        todo.pop();
-
-        if (current.first < current.second)
-          {
-            std::ptrdiff_t p = current.first + (rand() % (current.second - current.first));
-            p = quick_sort_partition (current.first, current.second, p);
-            todo.push (std::make_pair (current.first, p-1));
-            todo.push (std::make_pair (p+1, current.second));
-          }
-      }
-  }
-
-  std::ptrdiff_t quick_sort_partition (std::ptrdiff_t begin, std::ptrdiff_t end, std::ptrdiff_t p)
-  {
-    m_base.swap (p, end);
-    std::ptrdiff_t j = begin;
-    for (std::ptrdiff_t i = begin; i < end; ++ i)
-      if (m_indices[i] <= m_indices[end])
-        {
-          m_base.swap (i, j);
-          j ++;
-        }
-    m_base.swap (end, j);
-    return j;
-  }
-  /// \endcond
-
-
 }; // end of class Point_set_3
 
 /*!
@@ -71,8 +71,12 @@ int main (int, char**)
   }
 
   test (point_set.has_garbage(), "point set should have garbage.");
+  std::vector<Point> kept (point_set.points().begin(), point_set.points().end());
   point_set.collect_garbage();
   test (!(point_set.has_garbage()), "point set shouldn't have garbage.");
+  test (kept.size() == point_set.size()
+        && std::equal (kept.begin(), kept.end(), point_set.points().begin()),
+        "collecting garbage should keep the remaining points in order.");
 
   point_set.remove (*(point_set.begin()));
 
@@ -80,6 +84,17 @@ int main (int, char**)
   point_set.collect_garbage();
   test (!(point_set.has_garbage()), "point set shouldn't have garbage.");
 
+  // Inserting after a removal reuses the removed element
+  point_set.remove (*(point_set.begin()));
+  Point_set::iterator inserted = point_set.insert (Point (1, 2, 3), Vector (4, 5, 6));
+  test (!(point_set.has_garbage()), "point set shouldn't have garbage.");
+  test (point_set.point (*inserted) == Point (1, 2, 3), "inserted point is incorrect.");
+  test (point_set.normal (*inserted) == Vector (4, 5, 6), "inserted normal is incorrect.");
+  bool indices_okay = true;
+  for (Point_set::Index idx : point_set)
+    indices_okay = indices_okay && std::size_t(idx) < point_set.size();
+  test (indices_okay, "insertion after removal should keep indices valid.");
+
   test (!(point_set.has_property_map<Color> ("color")), "point set shouldn't have colors.");
   Point_set::Property_map<Color> color_prop;
   bool garbage;
@@ -40,10 +40,14 @@
 
 #ifdef CGAL_LINKED_WITH_TBB
 #include <tbb/parallel_reduce.h>
+#include <tbb/parallel_for_each.h>
 #include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
 #endif // CGAL_LINKED_WITH_TBB
 
 #include <any>
+#include <atomic>
+#include <mutex>
 
 #include <unordered_set>
 #include <algorithm>
@@ -1424,7 +1428,200 @@ preprocess_bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm
   return std::make_pair(infinity_value, rebuild);
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+
+// Parallel version of the subdivision step (Section 5.1 in the paper).
+// All the candidates are refined concurrently. The global lower bound is shared by all threads
+// and is used to discard candidates and to stop the TM2 traversals early. A candidate is not
+// subdivided anymore once its upper bound is within `error_bound` of the current global lower bound:
+// since the global lower bound only increases, the final upper bound is within `error_bound`
+// of the returned lower bound.
+// Returns `true` if the computation was stopped because the distance is larger than `sq_distance_bound`.
 template <class Kernel,
+          class TriangleMesh1,
+          class TriangleMesh2,
+          class VPM2,
+          class TM2Tree,
+          class CandidateQueue>
+bool parallel_bounded_error_subdivision(const TriangleMesh2& tm2,
+                                        const VPM2 vpm2,
+                                        const TM2Tree& tm2_tree,
+                                        const typename Kernel::FT error_bound,
+                                        const typename Kernel::FT sq_distance_bound,
+                                        const typename Kernel::FT infinity_value,
+                                        CandidateQueue& candidate_triangles,
+                                        Global_bounds<Kernel,
+                                                      typename boost::graph_traits<TriangleMesh1>::face_descriptor,
+                                                      typename boost::graph_traits<TriangleMesh2>::face_descriptor>& global_bounds)
+{
+  using FT = typename Kernel::FT;
+  using Point_3 = typename Kernel::Point_3;
+  using Triangle_3 = typename Kernel::Triangle_3;
+
+  using Face_handle_1 = typename boost::graph_traits<TriangleMesh1>::face_descriptor;
+  using Face_handle_2 = typename boost::graph_traits<TriangleMesh2>::face_descriptor;
+
+  using TM2_hd_traits = Hausdorff_primitive_traits_tm2<Triangle_3, Kernel, TriangleMesh1, TriangleMesh2, VPM2>;
+  using Candidate = Candidate_triangle<Kernel, Face_handle_1, Face_handle_2>;
+  using Bounds = Global_bounds<Kernel, Face_handle_1, Face_handle_2>;
+
+  // The upper bound of a candidate that is not subdivided anymore, with the faces realizing it.
+  struct Leaf_bound
+  {
+    FT upper = FT(-1);
+    Face_handle_1 tm1_face;
+    Face_handle_2 tm2_face;
+  };
+
+  auto midpoint = Kernel().construct_midpoint_3_object();
+
+  // Candidates with the largest upper bounds are processed first.
+  std::vector<Candidate> initial_candidates;
+  initial_candidates.reserve(candidate_triangles.size());
+  while(!candidate_triangles.empty())
+  {
+    initial_candidates.push_back(candidate_triangles.top());
+    candidate_triangles.pop();
+  }
+
+  std::mutex bounds_mutex; // protects `global_bounds`
+  std::atomic<bool> stop(false);
+  tbb::enumerable_thread_specific<Leaf_bound> leaf_bounds;
+
+  // Returns a copy of the global bounds that can be used by a single thread.
+  auto current_bounds = [&]() -> Bounds
+  {
+    std::lock_guard<std::mutex> lock(bounds_mutex);
+    return global_bounds;
+  };
+
+  auto update_lower_bound = [&](const FT lower, const Face_handle_1 tm1_face, const Face_handle_2 tm2_face)
+  {
+    std::lock_guard<std::mutex> lock(bounds_mutex);
+    if(lower > global_bounds.lower)
+    {
+      global_bounds.lower = lower;
+      global_bounds.lpair.first = tm1_face;
+      global_bounds.lpair.second = tm2_face;
+    }
+  };
+
+  tbb::parallel_for_each(initial_candidates.begin(), initial_candidates.end(),
+                         [&](const Candidate& triangle_and_bounds, tbb::feeder<Candidate>& feeder)
+  {
+    if(stop.load(std::memory_order_relaxed))
+      return;
+
+    const Bounds bounds_snapshot = current_bounds();
+
+    // Check if we can early quit.
+    if(is_positive(sq_distance_bound) && sq_distance_bound <= bounds_snapshot.lower)
+    {
+      stop = true;
+      return;
+    }
+
+    const auto& triangle_bounds = triangle_and_bounds.bounds;
+    CGAL_assertion(triangle_bounds.lower >= FT(0));
+    CGAL_assertion(triangle_bounds.upper >= triangle_bounds.lower);
+
+    // Cannot contribute to the Hausdorff distance anymore.
+    if(triangle_bounds.upper < bounds_snapshot.lower)
+      return;
+
+    // Bounds are tight enough.
+    const FT lower = (CGAL::max)(triangle_bounds.lower, bounds_snapshot.lower);
+    if(CGAL::approximate_sqrt(triangle_bounds.upper) - CGAL::approximate_sqrt(lower) <= error_bound)
+    {
+      Leaf_bound& leaf = leaf_bounds.local();
+      if(triangle_bounds.upper > leaf.upper)
+      {
+        leaf.upper = triangle_bounds.upper;
+        leaf.tm1_face = triangle_and_bounds.tm1_face;
+        leaf.tm2_face = triangle_bounds.tm2_uface;
+      }
+      return;
+    }
+
+    const Triangle_3& triangle_for_subdivision = triangle_and_bounds.triangle;
+    const Point_3& v0 = triangle_for_subdivision.vertex(0);
+    const Point_3& v1 = triangle_for_subdivision.vertex(1);
+    const Point_3& v2 = triangle_for_subdivision.vertex(2);
+
+    // Stopping condition: All three vertices of the triangle are projected onto the same triangle in TM2.
+    const auto closest_triangle_v0 = tm2_tree.closest_point_and_primitive(v0);
+    const auto closest_triangle_v1 = tm2_tree.closest_point_and_primitive(v1);
+    const auto closest_triangle_v2 = tm2_tree.closest_point_and_primitive(v2);
+
+    if((closest_triangle_v0.second == closest_triangle_v1.second) &&
+       (closest_triangle_v1.second == closest_triangle_v2.second))
+    {
+      // The upper bound of this triangle is its actual Hausdorff distance to the second mesh.
+      update_lower_bound(triangle_bounds.upper, triangle_and_bounds.tm1_face, triangle_bounds.tm2_uface);
+      return;
+    }
+
+    // Subdivide the triangle into four smaller triangles.
+    const Point_3 v01 = midpoint(v0, v1);
+    const Point_3 v02 = midpoint(v0, v2);
+    const Point_3 v12 = midpoint(v1, v2);
+    const std::array<Triangle_3, 4> sub_triangles = { Triangle_3(v0, v01, v02), Triangle_3(v1 , v01, v12),
+                                                      Triangle_3(v2, v02, v12), Triangle_3(v01, v02, v12) };
+
+    for(std::size_t i=0; i<4; ++i)
+    {
+      // See the sequential version for the initialization of the local bounds.
+      Local_bounds<Kernel, Face_handle_1, Face_handle_2> bounds(triangle_bounds.upper);
+      bounds.tm2_uface = triangle_bounds.tm2_uface;
+
+      const Bbox_3 sub_t1_bbox = sub_triangles[i].bbox();
+      TM2_hd_traits traversal_traits_tm2(sub_t1_bbox, tm2, vpm2, bounds, bounds_snapshot, infinity_value);
+      tm2_tree.traversal_with_priority(sub_triangles[i], traversal_traits_tm2);
+
+      const auto& sub_triangle_bounds = traversal_traits_tm2.get_local_bounds();
+      CGAL_assertion(sub_triangle_bounds.lower >= FT(0));
+      CGAL_assertion(sub_triangle_bounds.upper >= sub_triangle_bounds.lower);
+
+      if(sub_triangle_bounds.lower > bounds_snapshot.lower)
+        update_lower_bound(sub_triangle_bounds.lower, triangle_and_bounds.tm1_face, sub_triangle_bounds.tm2_lface);
+
+      feeder.add(Candidate(sub_triangles[i], sub_triangle_bounds, triangle_and_bounds.tm1_face));
+    }
+  });
+
+  if(stop)
+  {
+    // The bounds are not refined anymore, only the lower bound is meaningful.
+    global_bounds.upper = global_bounds.lower;
+    global_bounds.upair = global_bounds.lpair;
+    return true;
+  }
+
+  // The global upper bound is the largest upper bound of the candidates that were not discarded.
+  Leaf_bound max_leaf;
+  for(const Leaf_bound& leaf : leaf_bounds)
+    if(leaf.upper > max_leaf.upper)
+      max_leaf = leaf;
+
+  if(max_leaf.upper < global_bounds.lower)
+  {
+    global_bounds.upper = global_bounds.lower;
+    global_bounds.upair = global_bounds.lpair;
+  }
+  else
+  {
+    global_bounds.upper = max_leaf.upper;
+    global_bounds.upair.first = max_leaf.tm1_face;
+    global_bounds.upair.second = max_leaf.tm2_face;
+  }
+
+  return false;
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+template <class Concurrency_tag,
+          class Kernel,
           class TriangleMesh1,
           class TriangleMesh2,
           class VPM1,
@@ -1530,6 +1727,25 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
   std::size_t explored_candidates_count = 0;
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+  // The parallel version refines all candidates and leaves the queue empty.
+  if(std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value)
+  {
+    const bool early_quit = parallel_bounded_error_subdivision<Kernel, TriangleMesh1>(
+                              tm2, vpm2, tm2_tree, error_bound, sq_distance_bound, infinity_value,
+                              candidate_triangles, global_bounds);
+    if(early_quit)
+    {
+#ifdef CGAL_HAUSDORFF_DEBUG
+      std::cout << "Quitting early with lower bound: " << global_bounds.lower << std::endl;
+#endif
+      *out++ = global_bounds.lpair;
+      *out++ = global_bounds.upair;
+      return global_bounds.lower;
+    }
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
   // See Section 5.1 in the paper.
   while(!candidate_triangles.empty())
   {
@@ -1950,7 +2166,7 @@ struct Bounded_error_squared_distance_computation
 
       // TODO: add distance_bound (now it is FT(-1)) in case we use parallel
       // for checking if two meshes are close.
-      const FT sqd = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+      const FT sqd = bounded_error_squared_Hausdorff_distance_impl<Sequential_tag, Kernel>(
                        tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
                        error_bound, sq_initial_bound, FT(-1) /*sq_distance_bound*/, infinity_value,
                        stub);
@@ -1996,9 +2212,9 @@ bounded_error_squared_one_sided_Hausdorff_distance_impl(const TriangleMesh1& tm1
                                                         const NamedParameters2& np2,
                                                         OutputIterator& out)
 {
-#if !defined(CGAL_LINKED_WITH_TBB) || !defined(CGAL_METIS_ENABLED)
+#if !defined(CGAL_LINKED_WITH_TBB)
   static_assert(!std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value,
-                                      "Parallel_tag is enabled but at least TBB or METIS is unavailable.");
+                "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
   using FT = typename Kernel::FT;
@@ -2231,7 +2447,7 @@ bounded_error_squared_one_sided_Hausdorff_distance_impl(const TriangleMesh1& tm1
 #ifdef CGAL_HAUSDORFF_DEBUG
     std::cout << "* executing sequential version" << std::endl;
 #endif
-    sq_hdist = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_hdist = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
                  error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out);
   }
@@ -2271,9 +2487,9 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
                                                         OutputIterator1& out1,
                                                         OutputIterator2& out2)
 {
-#if !defined(CGAL_LINKED_WITH_TBB) || !defined(CGAL_METIS_ENABLED)
+#if !defined(CGAL_LINKED_WITH_TBB)
   static_assert(!std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value,
-                "Parallel_tag is enabled but at least TBB or METIS is unavailable.");
+                "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
   // Optimized version.
@@ -2332,7 +2548,7 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
 
   if(!compare_meshes || (compare_meshes && tm1_only.size() > 0))
   {
-    sq_dista = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_dista = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
                  error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out1);
   }
@@ -2356,7 +2572,7 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
 
   if(!compare_meshes || (compare_meshes && tm2_only.size() > 0))
   {
-    sq_distb = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_distb = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm2, tm1, vpm2, vpm1, tm2_tree, tm1_tree,
                  error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out2);
   }
@@ -2462,10 +2678,13 @@ bounded_error_squared_Hausdorff_distance_naive_impl(const TriangleMesh1& tm1,
  * returns an estimate on the Hausdorff distance from `tm1` to `tm2` that
  * is at most `error_bound` away from the actual Hausdorff distance from `tm1` to `tm2`.
  *
+ * With `Parallel_tag`, the candidate triangles of `tm1` that remain after the culling step
+ * are subdivided concurrently. The threads share the global lower bound, which is used
+ * to discard candidates, so the estimate may slightly differ from the sequential one,
+ * but it is also at most `error_bound` away from the actual Hausdorff distance.
+ *
  * @tparam Concurrency_tag enables sequential versus parallel algorithm.
- *                         Possible values are `Sequential_tag` and `Parallel_tag`.
- *                         Currently, the parallel version is not implemented and the
- *                         sequential version is always used whatever tag is chosen!
+ *                         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
  *
  * @tparam TriangleMesh1 a model of the concept `FaceListGraph`
  * @tparam TriangleMesh2 a model of the concept `FaceListGraph`
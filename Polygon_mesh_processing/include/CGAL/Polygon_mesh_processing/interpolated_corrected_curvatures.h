@@ -22,11 +22,20 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/property_map.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
 #include <Eigen/Eigenvalues>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <numeric>
 #include <queue>
+#include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 namespace CGAL {
 
@@ -701,7 +710,7 @@ void interpolated_corrected_curvatures_one_vertex(
 }
 
 
-template<typename PolygonMesh, class NamedParameters>
+template<typename ConcurrencyTag, typename PolygonMesh, class NamedParameters>
 class Interpolated_corrected_curvatures_computer
 {
   typedef typename GetGeomTraits<PolygonMesh, NamedParameters>::type GT;
@@ -716,6 +725,7 @@ class Interpolated_corrected_curvatures_computer
   typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
 
   typedef typename GetVertexPointMap<PolygonMesh, NamedParameters>::const_type Vertex_position_map;
+  typedef typename GetInitializedFaceIndexMap<PolygonMesh, NamedParameters>::const_type Face_index_map;
 
   typedef dynamic_vertex_property_t<Vector_3> Vector_map_tag;
   typedef typename boost::property_map<PolygonMesh, Vector_map_tag>::const_type Default_vector_map;
@@ -737,15 +747,27 @@ class Interpolated_corrected_curvatures_computer
     NamedParameters,
     Default_principal_map>::type Vertex_principal_curvatures_and_directions_map;
 
-  typedef typename boost::property_map<PolygonMesh,
-    CGAL::dynamic_face_property_t<FT>>::const_type Face_scalar_measure_map;
-  typedef typename boost::property_map<PolygonMesh,
-    CGAL::dynamic_face_property_t<std::array<FT, 3 * 3>>>::const_type Face_anisotropic_measure_map;
+  // scratch data of the ball expansion around a vertex, one per thread
+  struct Ball_expansion {
+    Ball_expansion(const std::size_t nb_faces) : visited(nb_faces, false) { }
+
+    std::vector<bool> visited;           // indexed by the face index
+    std::vector<face_descriptor> faces;  // visited faces, in BFS order
+    std::vector<Vector_3> x;             // points of the current face
+  };
+
+  // curvatures of a vertex, as stored in the output property maps
+  struct Vertex_curvatures {
+    FT mean_curvature = 0;
+    FT gaussian_curvature = 0;
+    Principal_curvatures_and_directions<GT> principal_curvatures_and_directions;
+  };
 
 private:
   const PolygonMesh& pmesh;
   Vertex_position_map vpm;
   Vertex_normal_map vnm;
+  Face_index_map fim;
   FT ball_radius;
   FT avg_edge_length;
 
@@ -757,15 +779,9 @@ private:
   Vertex_Gaussian_curvature_map gaussian_curvature_map;
   Vertex_principal_curvatures_and_directions_map principal_curvatures_and_directions_map;
 
-  Face_scalar_measure_map mu0_map, mu1_map, mu2_map;
-  Face_anisotropic_measure_map muXY_map;
-
-  void set_property_maps() {
-    mu0_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    mu1_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    mu2_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    muXY_map = get(CGAL::dynamic_face_property_t<std::array<FT, 3 * 3>>(), pmesh);
-  }
+  // measures of the faces, indexed by the face index, computed once and shared by all curvatures
+  std::vector<FT> mu0, mu1, mu2;
+  std::vector<std::array<FT, 3 * 3>> muXY;
 
   void set_named_params(const NamedParameters& np)
   {
@@ -815,7 +831,7 @@ public:
 
     if (is_mean_curvature_selected || is_Gaussian_curvature_selected || is_principal_curvatures_and_directions_selected)
     {
-      set_property_maps();
+      fim = CGAL::get_initialized_face_index_map(pmesh, np);
 
       compute_selected_curvatures();
     }
@@ -823,42 +839,56 @@ public:
 
 private:
 
-  // Computes the (selected) interpolated corrected measures for all faces
-  // and stores them in the property maps
-  void interpolated_corrected_selected_measures_all_faces()
+  // Computes the (selected) interpolated corrected measures of the face f
+  // and stores them at the index of f
+  void interpolated_corrected_selected_measures_one_face(face_descriptor f, std::vector<Vector_3>& x, std::vector<Vector_3>& u)
   {
-    std::vector<Vector_3> x;
-    std::vector<Vector_3> u;
-    // minimal number of vertices per face is 3
-    x.reserve(3);
-    u.reserve(3);
-
-    for (face_descriptor f : faces(pmesh))
+    for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
     {
-      for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
-      {
-        const Point_3& p = get(vpm, v);
-        x.push_back(Vector_3(p.x(), p.y(), p.z()));
-        u.push_back(get(vnm, v));
-      }
-      put(mu0_map, f, interpolated_corrected_area_measure_face<GT>(u, x));
+      const Point_3& p = get(vpm, v);
+      x.push_back(Vector_3(p.x(), p.y(), p.z()));
+      u.push_back(get(vnm, v));
+    }
 
-      if (is_mean_curvature_selected)
-        put(mu1_map, f, interpolated_corrected_mean_curvature_measure_face<GT>(u, x));
+    const std::size_t fi = get(fim, f);
+    mu0[fi] = interpolated_corrected_area_measure_face<GT>(u, x);
 
-      if (is_Gaussian_curvature_selected)
-        put(mu2_map, f, interpolated_corrected_Gaussian_curvature_measure_face<GT>(u));
+    if (is_mean_curvature_selected)
+      mu1[fi] = interpolated_corrected_mean_curvature_measure_face<GT>(u, x);
 
-      if (is_principal_curvatures_and_directions_selected)
-        put(muXY_map, f, interpolated_corrected_anisotropic_measure_face<GT>(u, x));
+    if (is_Gaussian_curvature_selected)
+      mu2[fi] = interpolated_corrected_Gaussian_curvature_measure_face<GT>(u);
 
-      x.clear();
-      u.clear();
+    if (is_principal_curvatures_and_directions_selected)
+      muXY[fi] = interpolated_corrected_anisotropic_measure_face<GT>(u, x);
+
+    x.clear();
+    u.clear();
+  }
+
+  // adds the measures of the face f, weighted by ratio
+  void add_measures(face_descriptor f, const FT ratio, Vertex_measures<GT>& vertex_measures) const
+  {
+    // only add the measures for the selected curvatures (area measure is always added)
+    const std::size_t fi = get(fim, f);
+    vertex_measures.area_measure += ratio * mu0[fi];
+
+    if (is_mean_curvature_selected)
+      vertex_measures.mean_curvature_measure += ratio * mu1[fi];
+
+    if (is_Gaussian_curvature_selected)
+      vertex_measures.gaussian_curvature_measure += ratio * mu2[fi];
+
+    if (is_principal_curvatures_and_directions_selected)
+    {
+      const std::array<FT, 3 * 3>& face_anisotropic_measure = muXY[fi];
+      for (std::size_t i = 0; i < 3 * 3; i++)
+        vertex_measures.anisotropic_measure[i] += ratio * face_anisotropic_measure[i];
     }
   }
 
   // expand the measures of the faces incident to v
-  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex_no_radius(vertex_descriptor v)
+  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex_no_radius(vertex_descriptor v) const
   {
     Vertex_measures<GT> vertex_measures;
 
@@ -867,35 +897,23 @@ private:
       if (f == boost::graph_traits<PolygonMesh>::null_face())
         continue;
 
-      // only add the measures for the selected curvatures (area measure is always added)
-      vertex_measures.area_measure += get(mu0_map, f);
-
-      if (is_mean_curvature_selected)
-        vertex_measures.mean_curvature_measure += get(mu1_map, f);
-
-      if (is_Gaussian_curvature_selected)
-        vertex_measures.gaussian_curvature_measure += get(mu2_map, f);
-
-      if (is_principal_curvatures_and_directions_selected)
-      {
-        const std::array<FT, 3 * 3> face_anisotropic_measure = get(muXY_map, f);
-        for (std::size_t i = 0; i < 3 * 3; i++)
-          vertex_measures.anisotropic_measure[i] += face_anisotropic_measure[i];
-      }
+      add_measures(f, FT(1), vertex_measures);
     }
 
     return vertex_measures;
   }
 
   // expand the measures of the faces inside the ball of radius r around v
-  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex(vertex_descriptor v)
+  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex(vertex_descriptor v, Ball_expansion& ball) const
   {
-    // the ball expansion is done using a BFS traversal from the vertex
-    std::queue<face_descriptor> bfs_queue;
-    std::unordered_set<face_descriptor> bfs_visited;
+    // the ball expansion is done using a BFS traversal from the vertex:
+    // the visited faces are stored in BFS order, the next face to process being at index `head`
+    std::vector<face_descriptor>& bfs_faces = ball.faces;
+    std::vector<Vector_3>& x = ball.x;
+    std::size_t head = 0;
 
     const Point_3& vp = get(vpm, v);
-    const Vector_3& c = Vector_3(vp.x(), vp.y(), vp.z());
+    const Vector_3 c(vp.x(), vp.y(), vp.z());
 
     Vertex_measures<GT> vertex_measures;
 
@@ -903,16 +921,14 @@ private:
     for (face_descriptor f : faces_around_target(halfedge(v, pmesh), pmesh)) {
       if (f != boost::graph_traits<PolygonMesh>::null_face())
       {
-        bfs_queue.push(f);
-        bfs_visited.insert(f);
+        bfs_faces.push_back(f);
+        ball.visited[get(fim, f)] = true;
       }
     }
-    while (!bfs_queue.empty()) {
-      face_descriptor fi = bfs_queue.front();
-      bfs_queue.pop();
+    while (head != bfs_faces.size()) {
+      face_descriptor fi = bfs_faces[head++];
 
       // looping over vertices in face to get point coordinates
-      std::vector<Vector_3> x;
       for (vertex_descriptor vi : vertices_around_face(halfedge(fi, pmesh), pmesh))
       {
         const Point_3& pi = get(vpm, vi);
@@ -921,74 +937,129 @@ private:
 
       // compute the inclusion ratio of the face in the ball
       const FT f_ratio = face_in_ball_ratio<GT>(x, ball_radius, c);
+      x.clear();
 
       // if the face is inside the ball, add the measures
-      // only add the measures for the selected curvatures (area measure is always added)
       if (!is_zero(f_ratio))
       {
-        vertex_measures.area_measure += f_ratio * get(mu0_map, fi);
-
-        if (is_mean_curvature_selected)
-          vertex_measures.mean_curvature_measure += f_ratio * get(mu1_map, fi);
-
-        if (is_Gaussian_curvature_selected)
-          vertex_measures.gaussian_curvature_measure += f_ratio * get(mu2_map, fi);
-
-        if (is_principal_curvatures_and_directions_selected)
-        {
-          const std::array<FT, 3 * 3> face_anisotropic_measure = get(muXY_map, fi);
-          for (std::size_t i = 0; i < 3 * 3; i++)
-            vertex_measures.anisotropic_measure[i] += f_ratio * face_anisotropic_measure[i];
-        }
+        add_measures(fi, f_ratio, vertex_measures);
 
         for (face_descriptor fj : faces_around_face(halfedge(fi, pmesh), pmesh))
         {
-          if (bfs_visited.find(fj) == bfs_visited.end() && fj != boost::graph_traits<PolygonMesh>::null_face())
+          if (fj != boost::graph_traits<PolygonMesh>::null_face() && !ball.visited[get(fim, fj)])
           {
-            bfs_queue.push(fj);
-            bfs_visited.insert(fj);
+            bfs_faces.push_back(fj);
+            ball.visited[get(fim, fj)] = true;
           }
         }
       }
     }
+
+    // reset the scratch data for the next vertex
+    for (face_descriptor f : bfs_faces)
+      ball.visited[get(fim, f)] = false;
+    bfs_faces.clear();
+
     return vertex_measures;
   }
 
-  void compute_selected_curvatures() {
-    interpolated_corrected_selected_measures_all_faces();
+  // computes the selected curvatures of v from the expanded measures
+  // if the area measure is zero, the curvature is set to zero
+  Vertex_curvatures curvatures_one_vertex(vertex_descriptor v, Ball_expansion& ball) const
+  {
+    // expand the computed measures (on faces) to the vertices
+    const Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
+      expand_interpolated_corrected_measure_vertex_no_radius(v) :
+      expand_interpolated_corrected_measure_vertex(v, ball);
+
+    Vertex_curvatures curvatures;
+    if (is_mean_curvature_selected && !is_zero(vertex_measures.area_measure))
+      curvatures.mean_curvature = 0.5 * vertex_measures.mean_curvature_measure / vertex_measures.area_measure;
+
+    if (is_Gaussian_curvature_selected && !is_zero(vertex_measures.area_measure))
+      curvatures.gaussian_curvature = vertex_measures.gaussian_curvature_measure / vertex_measures.area_measure;
+
+    if (is_principal_curvatures_and_directions_selected) {
+      // compute the principal curvatures and directions from the anisotropic measure
+      const Vector_3& v_normal = get(vnm, v);
+      curvatures.principal_curvatures_and_directions = principal_curvatures_and_directions_from_anisotropic_measures<GT>(
+        vertex_measures.anisotropic_measure,
+        vertex_measures.area_measure,
+        v_normal,
+        avg_edge_length
+        );
+    }
+    return curvatures;
+  }
 
-    for (vertex_descriptor v : vertices(pmesh))
-    {
-      // expand the computed measures (on faces) to the vertices
-      Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
-        expand_interpolated_corrected_measure_vertex_no_radius(v) :
-        expand_interpolated_corrected_measure_vertex(v);
-
-      // compute the selected curvatures from the expanded measures and store them in the property maps
-      // if the area measure is zero, the curvature is set to zero
-      if (is_mean_curvature_selected) {
-        !is_zero(vertex_measures.area_measure) ?
-          put(mean_curvature_map, v, 0.5 * vertex_measures.mean_curvature_measure / vertex_measures.area_measure) :
-          put(mean_curvature_map, v, 0);
-      }
+  // stores the selected curvatures of v in the property maps
+  void put_curvatures(vertex_descriptor v, const Vertex_curvatures& curvatures)
+  {
+    if (is_mean_curvature_selected)
+      put(mean_curvature_map, v, curvatures.mean_curvature);
 
-      if (is_Gaussian_curvature_selected) {
-        !is_zero(vertex_measures.area_measure) ?
-          put(gaussian_curvature_map, v, vertex_measures.gaussian_curvature_measure / vertex_measures.area_measure) :
-          put(gaussian_curvature_map, v, 0);
-      }
+    if (is_Gaussian_curvature_selected)
+      put(gaussian_curvature_map, v, curvatures.gaussian_curvature);
 
-      if (is_principal_curvatures_and_directions_selected) {
-        // compute the principal curvatures and directions from the anisotropic measure
-        const Vector_3& v_normal = get(vnm, v);
-        const Principal_curvatures_and_directions<GT> principal_curvatures_and_directions = principal_curvatures_and_directions_from_anisotropic_measures<GT>(
-          vertex_measures.anisotropic_measure,
-          vertex_measures.area_measure,
-          v_normal,
-          avg_edge_length
-          );
-        put(principal_curvatures_and_directions_map, v, principal_curvatures_and_directions);
-      }
+    if (is_principal_curvatures_and_directions_selected)
+      put(principal_curvatures_and_directions_map, v, curvatures.principal_curvatures_and_directions);
+  }
+
+  void compute_selected_curvatures() {
+    const std::size_t nb_faces = num_faces(pmesh);
+    mu0.resize(nb_faces);
+    if (is_mean_curvature_selected)
+      mu1.resize(nb_faces);
+    if (is_Gaussian_curvature_selected)
+      mu2.resize(nb_faces);
+    if (is_principal_curvatures_and_directions_selected)
+      muXY.resize(nb_faces);
+
+#if !defined(CGAL_LINKED_WITH_TBB)
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                               "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      // the measures of each face are written at the index of the face
+      const std::vector<face_descriptor> face_range(faces(pmesh).begin(), faces(pmesh).end());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, face_range.size()),
+        [&](const tbb::blocked_range<std::size_t>& r)
+        {
+          std::vector<Vector_3> x, u;
+          for (std::size_t i = r.begin(); i != r.end(); ++i)
+            interpolated_corrected_selected_measures_one_face(face_range[i], x, u);
+        });
+
+      // the curvatures are computed concurrently, and written in the (possibly not thread-safe)
+      // property maps afterwards
+      const std::vector<vertex_descriptor> vertex_range(vertices(pmesh).begin(), vertices(pmesh).end());
+      std::vector<Vertex_curvatures> curvatures(vertex_range.size());
+      tbb::enumerable_thread_specific<Ball_expansion> balls(nb_faces);
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertex_range.size()),
+        [&](const tbb::blocked_range<std::size_t>& r)
+        {
+          Ball_expansion& ball = balls.local();
+          for (std::size_t i = r.begin(); i != r.end(); ++i)
+            curvatures[i] = curvatures_one_vertex(vertex_range[i], ball);
+        });
+
+      for (std::size_t i = 0; i < vertex_range.size(); ++i)
+        put_curvatures(vertex_range[i], curvatures[i]);
+    }
+    else
+#endif
+    {
+      std::vector<Vector_3> x, u;
+      // minimal number of vertices per face is 3
+      x.reserve(3);
+      u.reserve(3);
+      for (face_descriptor f : faces(pmesh))
+        interpolated_corrected_selected_measures_one_face(f, x, u);
+
+      Ball_expansion ball(is_negative(ball_radius) ? 0 : nb_faces);
+      for (vertex_descriptor v : vertices(pmesh))
+        put_curvatures(v, curvatures_one_vertex(v, ball));
     }
   }
 };
@@ -1002,8 +1073,14 @@ private:
 * By providing mean, Gaussian and/or principal curvature and direction property maps as named parameters, the user
 * can choose which quantities to compute.
 *
+* The measures of each face are computed once and shared by all the selected curvatures.
+* With `Parallel_tag`, the faces and then the vertices are processed concurrently; the curvatures
+* are the same as with `Sequential_tag`, and are written in the property maps by a single thread.
+*
 * \note This function depends on the \eigen 3.1 (or later) library.
 *
+* @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+*                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 * @tparam PolygonMesh a model of `FaceListGraph`.
 * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters".
 *
@@ -1068,6 +1145,13 @@ private:
 *                     computed using `compute_vertex_normals()`.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{face_index_map}
+*     \cgalParamDescription{a property map associating to each face of `pmesh` a unique index between `0` and `num_faces(pmesh) - 1`}
+*     \cgalParamType{a class model of `ReadablePropertyMap` with `boost::graph_traits<PolygonMesh>::%face_descriptor`
+*                    as key type and `std::size_t` as value type}
+*     \cgalParamDefault{an automatically indexed internal map}
+*   \cgalParamNEnd
+*
 *   \cgalParamNBegin{geom_traits}
 *     \cgalParamDescription{an instance of a geometric traits class.}
 *     \cgalParamType{a class model of `Kernel`}
@@ -1078,12 +1162,13 @@ private:
 * \cgalNamedParamsEnd
 *
 */
-template<typename PolygonMesh,
+template<typename ConcurrencyTag = Sequential_tag,
+         typename PolygonMesh,
          typename  CGAL_NP_TEMPLATE_PARAMETERS>
 void interpolated_corrected_curvatures(const PolygonMesh& pmesh,
                                        const CGAL_NP_CLASS& np = parameters::default_values())
 {
-  internal::Interpolated_corrected_curvatures_computer<PolygonMesh, CGAL_NP_CLASS>(pmesh, np);
+  internal::Interpolated_corrected_curvatures_computer<ConcurrencyTag, PolygonMesh, CGAL_NP_CLASS>(pmesh, np);
 }
 
 /**
@@ -1027,7 +1027,7 @@ void test_realizing_triangles(const double error_bound,
   compute_realizing_triangles(mesh1, mesh2, error_bound, expected_f1, expected_f2, "2", save);
 }
 
-#if defined(CGAL_LINKED_WITH_TBB) && defined(CGAL_METIS_ENABLED) && defined(USE_PARALLEL_BEHD)
+#if defined(CGAL_LINKED_WITH_TBB)
 void test_parallel_version(const std::string& filepath,
                            const double error_bound)
 {
@@ -1069,9 +1069,30 @@ void test_parallel_version(const std::string& filepath,
   std::cout << "* dista seq = " << dista << std::endl;
   std::cout << "* distb par = " << distb << std::endl;
 
-  assert(dista == distb);
+  // Both are within the error bound of the actual distance, but the candidates
+  // are not refined in the same order.
+  assert(CGAL::abs(dista - distb) <= error_bound);
+
+  // Symmetric distance.
+  std::cout << " ---- symmetric distance ---- " << std::endl;
+
+  PMP::random_perturbation(mesh2, 0.01, CGAL::parameters::random_seed(0));
+
+  const double distc = PMP::bounded_error_symmetric_Hausdorff_distance<CGAL::Sequential_tag>(
+    mesh1, mesh2, error_bound);
+  const double distd = PMP::bounded_error_symmetric_Hausdorff_distance<CGAL::Parallel_tag>(
+    mesh1, mesh2, error_bound);
+
+  std::cout << "* distc seq = " << distc << std::endl;
+  std::cout << "* distd par = " << distd << std::endl;
+
+  assert(CGAL::abs(distc - distd) <= error_bound);
+
+  // Early quit.
+  assert(!PMP::is_Hausdorff_distance_larger<CGAL::Parallel_tag>(mesh1, mesh2, 2.0, error_bound));
+  assert(PMP::is_Hausdorff_distance_larger<CGAL::Parallel_tag>(mesh1, mesh2, 0.5, error_bound));
 }
-#endif // defined(CGAL_LINKED_WITH_TBB) && defined(CGAL_METIS_ENABLED)
+#endif // defined(CGAL_LINKED_WITH_TBB)
 
 void test_early_quit(const std::string& filepath,
                      const bool save = true)
@@ -1170,10 +1191,10 @@ int main(int argc, char** argv)
   // --- Test realizing triangles.
   test_realizing_triangles(error_bound);
 
-#if defined(CGAL_LINKED_WITH_TBB) && defined(CGAL_METIS_ENABLED) && defined(USE_PARALLEL_BEHD)
+#if defined(CGAL_LINKED_WITH_TBB)
   // --- Test parallelization.
   test_parallel_version(filepath, error_bound);
-#endif // defined(CGAL_LINKED_WITH_TBB) && defined(CGAL_METIS_ENABLED)
+#endif // defined(CGAL_LINKED_WITH_TBB)
 
   // --- Test early quit.
   test_early_quit(filepath);
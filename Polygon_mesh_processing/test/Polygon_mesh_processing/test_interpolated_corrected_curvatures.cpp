@@ -178,6 +178,57 @@ void test_average_curvatures(std::string mesh_path,
 
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+// the parallel version must compute exactly the same curvatures as the sequential one
+template <typename PolygonMesh>
+void test_parallel_curvatures(std::string mesh_path, Epic_kernel::FT expansion_radius)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
+  typedef PMP::Principal_curvatures_and_directions<Epic_kernel> Principal_curvatures;
+  typedef typename boost::property_map<PolygonMesh,
+    CGAL::dynamic_vertex_property_t<Epic_kernel::FT>>::type FT_map;
+  typedef typename boost::property_map<PolygonMesh,
+    CGAL::dynamic_vertex_property_t<Principal_curvatures>>::type Principal_map;
+
+  PolygonMesh pmesh;
+  if (!CGAL::IO::read_polygon_mesh(CGAL::data_file_path(mesh_path), pmesh) || faces(pmesh).size() == 0)
+  {
+    std::cerr << "Invalid input file." << std::endl;
+  }
+
+  FT_map seq_mean = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+    seq_gaussian = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+    par_mean = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+    par_gaussian = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh);
+  Principal_map seq_principal = get(CGAL::dynamic_vertex_property_t<Principal_curvatures>(), pmesh),
+    par_principal = get(CGAL::dynamic_vertex_property_t<Principal_curvatures>(), pmesh);
+
+  PMP::interpolated_corrected_curvatures<CGAL::Sequential_tag>(
+    pmesh,
+    CGAL::parameters::ball_radius(expansion_radius)
+    .vertex_mean_curvature_map(seq_mean)
+    .vertex_Gaussian_curvature_map(seq_gaussian)
+    .vertex_principal_curvatures_and_directions_map(seq_principal)
+  );
+  PMP::interpolated_corrected_curvatures<CGAL::Parallel_tag>(
+    pmesh,
+    CGAL::parameters::ball_radius(expansion_radius)
+    .vertex_mean_curvature_map(par_mean)
+    .vertex_Gaussian_curvature_map(par_gaussian)
+    .vertex_principal_curvatures_and_directions_map(par_principal)
+  );
+
+  for (vertex_descriptor v : vertices(pmesh)) {
+    assert(get(seq_mean, v) == get(par_mean, v));
+    assert(get(seq_gaussian, v) == get(par_gaussian, v));
+    assert(get(seq_principal, v).min_curvature == get(par_principal, v).min_curvature);
+    assert(get(seq_principal, v).max_curvature == get(par_principal, v).max_curvature);
+    assert(get(seq_principal, v).min_direction == get(par_principal, v).min_direction);
+    assert(get(seq_principal, v).max_direction == get(par_principal, v).max_direction);
+  }
+}
+#endif
+
 int main()
 {
   // testing on a simple sphere(r = 0.5), on both Polyhedron & SurfaceMesh:
@@ -227,4 +278,13 @@ int main()
 
   test_average_curvatures<SMesh>("meshes/cylinder.off", Average_test_info(0.5, 0, 0.5, 0), false, 6);
   test_average_curvatures<SMesh>("meshes/cylinder.off", Average_test_info(0.5, 0, 0.5, 0.5), false, 6);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // the parallel version, with and without ball expansion
+  test_parallel_curvatures<SMesh>("meshes/sphere966.off", -1);
+  test_parallel_curvatures<SMesh>("meshes/sphere966.off", 0);
+  test_parallel_curvatures<SMesh>("meshes/sphere966.off", 5);
+  test_parallel_curvatures<Polyhedron>("meshes/sphere966.off", 5);
+#endif
+
 }
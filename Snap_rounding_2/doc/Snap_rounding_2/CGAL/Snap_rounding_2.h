@@ -7,6 +7,11 @@ namespace CGAL {
 \tparam InputIterator must be an iterator with value type `Traits::Segment_2`.
 \tparam OutputContainer must be a container with a method `push_back(const OutputContainer::value_type& c)`,
 where `OutputContainer::value_type` must be a container with a method `push_back(const Traits::Point_2& p)`
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+With a parallel tag, the intersections of the input segments are computed by the
+parallel version of `compute_intersection_points()`, and the input segments are
+rerouted through their hot pixels concurrently. The output does not depend on the tag.
 
 \param begin,end The first two parameters denote the iterator range
 of the input segments.
@@ -35,7 +40,11 @@ pixel to the right of the pixel containing the origin, for example,
 will be `(w,0)`.
 
 \param number_of_kd_trees The seventh parameter is briefly described later on this page; for a
-detailed description see \cgalCite{cgal:hp-isr-02}.
+detailed description see \cgalCite{cgal:hp-isr-02}. It must be at least `1`.
+
+\param use_hot_pixel_grid The eighth parameter determines whether the hot pixels
+are stored in a hash grid instead of kd-trees, as described later on this page.
+If it is `true`, `number_of_kd_trees` is ignored.
 
 Snap Rounding (SR, for short) is a well known method for converting
 arbitrary-precision arrangements of segments into a fixed-precision
@@ -112,9 +121,17 @@ behavior), and there are inputs which benefit from using several
 kd-trees. Thus, the user can control the number of kd-trees
 with the parameter  `number_of_kd_trees`. Typically, but not
 always, one kd-tree (the default) is sufficient.
+
+Alternatively, setting `use_hot_pixel_grid` to `true` stores the hot pixels
+in a uniform grid of cells, each hot pixel being registered in the cells
+its square overlaps. A segment is then queried against the cells it
+crosses only, which avoids the large bounding boxes of long oblique
+segments, and is usually faster than the kd-trees when the hot pixels
+are evenly spread. The output is the same in both cases.
 */
 
-template < class Traits, class InputIterator, class OutputContainer >
+template < class Traits, class InputIterator, class OutputContainer,
+           class ConcurrencyTag = Sequential_tag >
 void
 snap_rounding_2(
 InputIterator begin,
@@ -123,7 +140,8 @@ OutputContainer& output_container,
 typename Traits::FT pixel_size,
 bool do_isr = true,
 bool int_output = true,
-unsigned int number_of_kd_trees = 1);
+unsigned int number_of_kd_trees = 1,
+bool use_hot_pixel_grid = false);
 
 } /* namespace CGAL */
 
@@ -24,11 +24,18 @@
 #include <CGAL/Surface_sweep_2_algorithms.h>
 #include <list>
 #include <set>
+#include <vector>
+#include <type_traits>
 #include <CGAL/Snap_rounding_kd_2.h>
+#include <CGAL/Snap_rounding_grid_2.h>
 #include <CGAL/utility.h>
 #include <CGAL/Iterator_project.h>
 #include <CGAL/function_objects.h>
 #include <CGAL/tss.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+
+#include <boost/range/irange.hpp>
 
 namespace CGAL {
 
@@ -102,6 +109,7 @@ public:
   bool intersect_right(const Segment_2 & seg, SEG_Direction seg_dir) const;
   bool intersect_bot(const Segment_2 & seg, SEG_Direction seg_dir) const;
   bool intersect_top(const Segment_2 & seg, SEG_Direction seg_dir) const;
+  bool may_intersect(const Segment_2 & seg) const;
   bool intersect(Segment_data & seg, SEG_Direction seg_dir) const;
   void set_direction(SEG_Direction inp_seg_dir) { direction() = inp_seg_dir; }
   SEG_Direction get_direction() const { return direction(); }
@@ -145,6 +153,7 @@ private:
   typedef CGAL::Hot_pixel<Traits_>                      Hot_pixel;
   typedef CGAL::Segment_data<Traits>                    Segment_data;
   typedef CGAL::Multiple_kd_tree<Traits,Hot_pixel *>    Multiple_kd_tree;
+  typedef CGAL::Hot_pixel_grid<Traits,Hot_pixel *>      Hot_pixel_grid;
   typedef std::list<Segment_data>                       Segment_data_list;
   typedef CGAL::Hot_pixel_dir_cmp<Traits>               Hot_pixel_dir_cmp;
   typedef std::set<Hot_pixel *, Hot_pixel_dir_cmp>      Hot_pixel_set;
@@ -158,38 +167,61 @@ public:
   typedef typename Traits::Point_2                      Point_2;
   typedef std::list<Point_2>                            Point_list;
 
+  template <class ConcurrencyTag = Sequential_tag>
   void find_hot_pixels_and_create_kd_trees(NT pixel_size,
                                            unsigned int number_of_kd_trees,
                                            Segment_data_list & seg_list,
                                            Multiple_kd_tree ** mul_kd_tree);
 
+  template <class ConcurrencyTag = Sequential_tag>
+  void find_hot_pixels_and_create_grid(NT pixel_size,
+                                       Segment_data_list & seg_list,
+                                       Hot_pixel_grid ** hot_pixel_grid);
+
+  // `Hot_pixel_index` is either `Multiple_kd_tree` or `Hot_pixel_grid`
+  template <class ConcurrencyTag = Sequential_tag, class Hot_pixel_index>
   void iterate(OutputContainer & output_container,
                NT pixel_size, bool int_output, bool do_isr,
                Segment_data_list & seg_list,
-               Multiple_kd_tree * mul_kd_tree);
+               Hot_pixel_index * hot_pixel_index);
 
 private:
+  typedef std::pair<Point_2, Hot_pixel *>               Point_hot_pixel_pair;
+
   Traits m_gt;
 
   static const int default_number_of_kd_trees = 1;
 
+  template <class ConcurrencyTag>
+  void find_hot_pixels(NT pixel_size,
+                       Segment_data_list & seg_list,
+                       std::list<Point_hot_pixel_pair> & hot_pixels_list);
+
+  template <class Hot_pixel_index>
   void find_intersected_hot_pixels(Segment_data & seg,
                                    Hot_pixel_set &hot_pixels_intersected_set,
                                    int &number_of_intersections,
                                    NT pixel_size,
-                                   Multiple_kd_tree * mul_kd_tree);
+                                   Hot_pixel_index * hot_pixel_index);
+
+  template <class Hot_pixel_index>
+  void snap_segment(Segment_data & seg,
+                    Polyline_type & seg_output,
+                    NT pixel_size, bool int_output, bool do_isr,
+                    Hot_pixel_index * hot_pixel_index);
 
   void reroute_sr(Hot_pixel_set & inp_hot_pixels_intersected_set,
                   Polyline_type & seg_output,
                   bool int_output);
 
+  template <class Hot_pixel_index>
   void reroute_isr(Hot_pixel_set & inp_hot_pixels_intersected_set,
                    Polyline_type & seg_output,
                    int number_of_intersections,
                    bool first_time,
                    NT pixel_size,
                    bool int_output,
-                   Multiple_kd_tree * mul_kd_tree);
+                   Hot_pixel_index * hot_pixel_index);
 };
 
 /*! Constructor */
@@ -461,6 +493,30 @@ bool Hot_pixel<Traits_>::intersect_top(const Segment_2 & seg,
   return(false);
 }
 
+// returns false if the segment misses the bounding box of the (closed)
+// pixel, in which case it intersects none of the pixel sides. This only uses
+// comparisons, and saves the constructions of intersect() for the many
+// candidates reported by the kd-trees or the grid that are not hit.
+template<class Traits_>
+bool Hot_pixel<Traits_>::may_intersect(const Segment_2 & seg) const
+{
+  typedef typename Traits_::Compare_x_2         Compare_x_2;
+  typedef typename Traits_::Compare_y_2         Compare_y_2;
+  typedef typename Traits_::Construct_vertex_2  Construct_vertex_2;
+
+  Compare_x_2 compare_x = m_gt.compare_x_2_object();
+  Compare_y_2 compare_y = m_gt.compare_y_2_object();
+  Construct_vertex_2 construct_vertex = m_gt.construct_vertex_2_object();
+
+  const Point_2 & src = construct_vertex(seg, 0);
+  const Point_2 & trg = construct_vertex(seg, 1);
+
+  return(! (compare_x(src, p_left) == SMALLER && compare_x(trg, p_left) == SMALLER) &&
+         ! (compare_x(src, p_right) == LARGER && compare_x(trg, p_right) == LARGER) &&
+         ! (compare_y(src, p_down) == SMALLER && compare_y(trg, p_down) == SMALLER) &&
+         ! (compare_y(src, p_up) == LARGER && compare_y(trg, p_up) == LARGER));
+}
+
 /*! */
 template<class Traits_>
 bool
@@ -468,6 +524,9 @@ Hot_pixel<Traits_>::intersect(Segment_data & seg, SEG_Direction my_seg_dir) cons
 {
   Segment_2 s = seg.segment();
 
+  if (! may_intersect(s))
+    return(false);
+
   return(intersect_bot(s,my_seg_dir) || intersect_left(s, my_seg_dir) ||
          intersect_right(s, my_seg_dir) || intersect_top(s, my_seg_dir));
 }
@@ -522,38 +581,35 @@ bool Hot_pixel_dir_cmp<Traits_>::operator ()(const Hot_pixel * h1,
 
 /*! */
 template<class Traits,class OutputContainer>
+template<class ConcurrencyTag>
 void Snap_rounding_2<Traits,OutputContainer>::
-find_hot_pixels_and_create_kd_trees(NT pixel_size,
-                                    unsigned int number_of_kd_trees,
-                                    std::list<Segment_data> & seg_list,
-                                    Multiple_kd_tree ** mul_kd_tree)
+find_hot_pixels(NT pixel_size,
+                std::list<Segment_data> & seg_list,
+                std::list<Point_hot_pixel_pair> & hot_pixels_list)
 {
-  typedef std::pair<Point_2, Hot_pixel *>               Point_hot_pixel_pair;
   typedef typename std::list<Segment_data>::iterator    Segment_data_iter;
-  typedef std::list<Segment_2>                          Segment_list;
+  typedef std::vector<Segment_2>                        Segment_vector;
   typedef typename std::list<Point_2>::const_iterator   Point_const_iter;
 
   typedef typename Traits::Construct_segment_2  Construct_segment_2;
   Construct_segment_2 construct_seg = m_gt.construct_segment_2_object();
 
   Hot_pixel * hp;
-  Segment_data_iter iter1;
-  Object result;
-  Point_2 p;
-  std::list<Point_hot_pixel_pair> hot_pixels_list;
-  Segment_list segments;
+  Segment_vector segments;
+  segments.reserve(seg_list.size());
 
-  if (seg_list.empty()) return;
-
-  for (iter1 = seg_list.begin(); iter1 != seg_list.end(); ++iter1) {
+  for (Segment_data_iter iter1 = seg_list.begin(); iter1 != seg_list.end();
+       ++iter1)
+  {
     segments.push_back(construct_seg(iter1->source(), iter1->target()));
   }
 
   // get intersection points (with endpoints)
   Point_list mypointlist;
 
-  CGAL::compute_intersection_points(segments.begin(), segments.end(),
-                             std::back_inserter(mypointlist), true, m_gt);
+  CGAL::compute_intersection_points<ConcurrencyTag>
+    (segments.begin(), segments.end(), std::back_inserter(mypointlist), true,
+     m_gt);
 
   for (Point_const_iter v_iter = mypointlist.begin();
        v_iter != mypointlist.end(); ++v_iter)
@@ -561,6 +617,28 @@ find_hot_pixels_and_create_kd_trees(NT pixel_size,
     hp = new Hot_pixel(*v_iter, pixel_size);
     hot_pixels_list.push_back(Point_hot_pixel_pair(hp->get_center(), hp));
   }
+}
+
+/*! */
+template<class Traits,class OutputContainer>
+template<class ConcurrencyTag>
+void Snap_rounding_2<Traits,OutputContainer>::
+find_hot_pixels_and_create_kd_trees(NT pixel_size,
+                                    unsigned int number_of_kd_trees,
+                                    std::list<Segment_data> & seg_list,
+                                    Multiple_kd_tree ** mul_kd_tree)
+{
+  typedef typename std::list<Segment_data>::iterator    Segment_data_iter;
+  typedef std::list<Segment_2>                          Segment_list;
+
+  typedef typename Traits::Construct_segment_2  Construct_segment_2;
+  Construct_segment_2 construct_seg = m_gt.construct_segment_2_object();
+
+  std::list<Point_hot_pixel_pair> hot_pixels_list;
+
+  if (seg_list.empty()) return;
+
+  find_hot_pixels<ConcurrencyTag>(pixel_size, seg_list, hot_pixels_list);
 
   // create kd multiple tree
   // create simple_list from seg_list
@@ -574,15 +652,33 @@ find_hot_pixels_and_create_kd_trees(NT pixel_size,
                                       simple_seg_list);
 }
 
+/*! */
+template<class Traits,class OutputContainer>
+template<class ConcurrencyTag>
+void Snap_rounding_2<Traits,OutputContainer>::
+find_hot_pixels_and_create_grid(NT pixel_size,
+                                std::list<Segment_data> & seg_list,
+                                Hot_pixel_grid ** hot_pixel_grid)
+{
+  std::list<Point_hot_pixel_pair> hot_pixels_list;
+
+  if (seg_list.empty()) return;
+
+  find_hot_pixels<ConcurrencyTag>(pixel_size, seg_list, hot_pixels_list);
+
+  *hot_pixel_grid = new Hot_pixel_grid(hot_pixels_list, pixel_size);
+}
+
 /*! */
 template<class Traits_,class OutputContainer>
+template<class Hot_pixel_index>
 void Snap_rounding_2<Traits_,OutputContainer>::
 find_intersected_hot_pixels(Segment_data & seg,
                             std::set<Hot_pixel *,
                             Hot_pixel_dir_cmp> & hot_pixels_intersected_set,
                             int &number_of_intersections,
                             NT pixel_size,
-                            Multiple_kd_tree * mul_kd_tree)
+                            Hot_pixel_index * hot_pixel_index)
 {
   typedef typename std::list<Hot_pixel *>::iterator     Hot_pixel_iter;
 
@@ -594,8 +690,9 @@ find_intersected_hot_pixels(Segment_data & seg,
   number_of_intersections = 0;
   std::list<Hot_pixel *> hot_pixels_list;
 
-  mul_kd_tree->get_intersecting_points(hot_pixels_list,
-                                       Segment_2(seg.segment()), pixel_size);
+  hot_pixel_index->get_intersecting_points(hot_pixels_list,
+                                           Segment_2(seg.segment()),
+                                           pixel_size);
 
   for (iter = hot_pixels_list.begin();iter != hot_pixels_list.end();++iter) {
     if ((*iter)->intersect(seg,seg_dir)) {
@@ -635,6 +732,7 @@ reroute_sr(std::set<Hot_pixel *, Hot_pixel_dir_cmp>
 
 /*! */
 template<class Traits_,class OutputContainer>
+template<class Hot_pixel_index>
 void Snap_rounding_2<Traits_,OutputContainer>::
 reroute_isr(std::set<Hot_pixel *, Hot_pixel_dir_cmp>
             & inp_hot_pixels_intersected_set,
@@ -643,7 +741,7 @@ reroute_isr(std::set<Hot_pixel *, Hot_pixel_dir_cmp>
             bool first_time,
             NT pixel_size,
             bool int_output,
-            Multiple_kd_tree * mul_kd_tree)
+            Hot_pixel_index * hot_pixel_index)
 {
   typedef std::set<Hot_pixel *, Hot_pixel_dir_cmp>      Hot_pixel_set;
   typedef typename std::set<Hot_pixel *, Hot_pixel_dir_cmp>::iterator
@@ -669,10 +767,10 @@ reroute_isr(std::set<Hot_pixel *, Hot_pixel_dir_cmp>
       seg.determine_direction(seg_dir);
       find_intersected_hot_pixels(seg, hot_pixels_intersected_set,
                                   number_of_intersections, pixel_size,
-                                  mul_kd_tree);
+                                  hot_pixel_index);
       reroute_isr(hot_pixels_intersected_set, seg_output,
                   number_of_intersections,false, pixel_size,
-                  int_output, mul_kd_tree);
+                  int_output, hot_pixel_index);
     }
   } else {
     // insert second hot pixel
@@ -684,69 +782,104 @@ reroute_isr(std::set<Hot_pixel *, Hot_pixel_dir_cmp>
 
 /*! */
 template<class Traits_, class OutputContainer>
+template<class Hot_pixel_index>
 void Snap_rounding_2<Traits_,OutputContainer>::
-iterate(OutputContainer & output_container,
-        NT pixel_size,
-        bool int_output, bool do_isr,
-        std::list<Segment_data> & seg_list,
-        Multiple_kd_tree * mul_kd_tree)
+snap_segment(Segment_data & seg,
+             Polyline_type & seg_output,
+             NT pixel_size,
+             bool int_output, bool do_isr,
+             Hot_pixel_index * hot_pixel_index)
 {
   typedef std::set<Hot_pixel *, Hot_pixel_dir_cmp>      Hot_pixel_set;
   typedef typename std::set<Hot_pixel *, Hot_pixel_dir_cmp>::iterator
     Hot_pixel_iter;
-  typedef typename std::list<Segment_data>::iterator    Segment_data_iter;
 
-  Polyline_type seg_output;
   Hot_pixel_set hot_pixels_intersected_set;
   Hot_pixel_iter hot_pixel_iter;
   int number_of_intersections;
   Hot_pixel * hp;
   SEG_Direction seg_dir;
 
+  seg.determine_direction(seg_dir);
+  find_intersected_hot_pixels(seg, hot_pixels_intersected_set,
+                              number_of_intersections, pixel_size,
+                              hot_pixel_index);
+  // hot_pixels_intersected_set must have at least two hot pixels when the
+  // segment is not in entirely inside a hot pixel enter first hot pixel
+  hot_pixel_iter = hot_pixels_intersected_set.begin();
+  if (hot_pixel_iter == hot_pixels_intersected_set.end()) {
+    // segment entirely inside a pixel
+    hp = new Hot_pixel(seg.source(), pixel_size);
+    seg_output.push_back(hp->get_center(int_output));
+    delete hp;
+  } else {
+    seg_output.push_back((*hot_pixel_iter)->get_center(int_output));
+    if (number_of_intersections > 1) {
+      // segments that have at most one intersecting hot pixel are
+      // done(it was inserted)
+      if (do_isr)
+        reroute_isr(hot_pixels_intersected_set, seg_output,
+                    number_of_intersections, true,pixel_size,
+                    int_output, hot_pixel_index);
+      else
+        reroute_sr(hot_pixels_intersected_set, seg_output, int_output);
+    }
+  }
+}
+
+/*! */
+template<class Traits_, class OutputContainer>
+template<class ConcurrencyTag, class Hot_pixel_index>
+void Snap_rounding_2<Traits_,OutputContainer>::
+iterate(OutputContainer & output_container,
+        NT pixel_size,
+        bool int_output, bool do_isr,
+        std::list<Segment_data> & seg_list,
+        Hot_pixel_index * hot_pixel_index)
+{
+  typedef typename std::list<Segment_data>::iterator    Segment_data_iter;
+
+  // The segments are rerouted independently: the hot pixels are only read
+  // (the direction used to sort them is thread local), and the polylines are
+  // output in the order of the input segments.
+  std::vector<Segment_data *> segments;
+  segments.reserve(seg_list.size());
   for (Segment_data_iter iter = seg_list.begin(); iter != seg_list.end();
        ++iter)
-  {
-    seg_output.clear();
-    iter->determine_direction(seg_dir);
-    find_intersected_hot_pixels(*iter, hot_pixels_intersected_set,
-                                number_of_intersections, pixel_size,
-                                mul_kd_tree);
-    // hot_pixels_intersected_set must have at least two hot pixels when the
-    // segment is not in entirely inside a hot pixel enter first hot pixel
-    hot_pixel_iter = hot_pixels_intersected_set.begin();
-    if (hot_pixel_iter == hot_pixels_intersected_set.end()) {
-      // segment entirely inside a pixel
-      hp = new Hot_pixel(iter->source(), pixel_size);
-      seg_output.push_back(hp->get_center(int_output));
-      delete hp;
-    } else {
-      seg_output.push_back((*hot_pixel_iter)->get_center(int_output));
-      if (number_of_intersections > 1) {
-        // segments that have at most one intersecting hot pixel are
-        // done(it was inserted)
-        if (do_isr)
-          reroute_isr(hot_pixels_intersected_set, seg_output,
-                      number_of_intersections, true,pixel_size,
-                      int_output, mul_kd_tree);
-        else
-          reroute_sr(hot_pixels_intersected_set, seg_output, int_output);
-      }
-    }
+    segments.push_back(&*iter);
 
-    output_container.push_back(seg_output);
-  }
+  std::vector<Polyline_type> seg_outputs(segments.size());
+
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, segments.size()),
+                                 [&](std::size_t i) -> bool
+                                 {
+                                   snap_segment(*segments[i], seg_outputs[i],
+                                                pixel_size, int_output, do_isr,
+                                                hot_pixel_index);
+                                   return true;
+                                 });
+
+  for (std::size_t i = 0; i < seg_outputs.size(); ++i)
+    output_container.push_back(std::move(seg_outputs[i]));
 }
 
 /*! */
-template<class Traits, class InputIterator, class OutputContainer>
+template<class Traits, class InputIterator, class OutputContainer,
+         class ConcurrencyTag = Sequential_tag>
 void snap_rounding_2(InputIterator begin,
                      InputIterator end,
                      OutputContainer & output_container,
                      typename Traits::NT pixel_size,
                      bool do_isr = true,
                      bool int_output = true,
-                     unsigned int number_of_kd_trees = 1)
+                     unsigned int number_of_kd_trees = 1,
+                     bool use_hot_pixel_grid = false)
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 #ifdef CGAL_SR_DEBUG
   number_of_false_hp = 0;
 #endif
@@ -754,10 +887,10 @@ void snap_rounding_2(InputIterator begin,
   typedef CGAL::Hot_pixel<Traits>                     Hot_pixel;
   typedef CGAL::Segment_data<Traits>                  Segment_data;
   typedef CGAL::Multiple_kd_tree<Traits,Hot_pixel *>  Multiple_kd_tree;
+  typedef CGAL::Hot_pixel_grid<Traits,Hot_pixel *>    Hot_pixel_grid;
   typedef std::list<Segment_data>                     Segment_data_list;
 
   Segment_data_list seg_list;
-  Multiple_kd_tree * mul_kd_tree = nullptr;
 
   output_container.clear();
   // copy segments list
@@ -768,14 +901,26 @@ void snap_rounding_2(InputIterator begin,
 
   Snap_rounding_2<Traits,OutputContainer> s;
 
-  s.find_hot_pixels_and_create_kd_trees(pixel_size, number_of_kd_trees,
-                                        seg_list, &mul_kd_tree);
-  s.iterate(output_container, pixel_size, int_output, do_isr,seg_list,
-            mul_kd_tree);
-
-  // hope that find_hot_pixels_and_create_kd_trees does not suddenly
-  // new up an array of multiple kd_tree
-  delete mul_kd_tree;
+  if (use_hot_pixel_grid) {
+    Hot_pixel_grid * hot_pixel_grid = nullptr;
+    s.template find_hot_pixels_and_create_grid<ConcurrencyTag>
+      (pixel_size, seg_list, &hot_pixel_grid);
+    s.template iterate<ConcurrencyTag>(output_container, pixel_size,
+                                       int_output, do_isr, seg_list,
+                                       hot_pixel_grid);
+    delete hot_pixel_grid;
+  } else {
+    Multiple_kd_tree * mul_kd_tree = nullptr;
+    s.template find_hot_pixels_and_create_kd_trees<ConcurrencyTag>
+      (pixel_size, number_of_kd_trees, seg_list, &mul_kd_tree);
+    s.template iterate<ConcurrencyTag>(output_container, pixel_size,
+                                       int_output, do_isr, seg_list,
+                                       mul_kd_tree);
+
+    // hope that find_hot_pixels_and_create_kd_trees does not suddenly
+    // new up an array of multiple kd_tree
+    delete mul_kd_tree;
+  }
 
 #ifdef CGAL_SR_DEBUG
   std::cout << "Overall number of false hot pixels in all the queries : "
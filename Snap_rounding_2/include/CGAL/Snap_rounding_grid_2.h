@@ -0,0 +1,198 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_SNAP_ROUNDING_GRID_2_H
+#define CGAL_SNAP_ROUNDING_GRID_2_H
+
+#include <CGAL/license/Snap_rounding_2.h>
+
+
+#include <list>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+#include <CGAL/basic.h>
+#include <CGAL/assertions.h>
+
+namespace CGAL {
+
+/////////////////////
+/////////////////////
+//Hot_pixel_grid
+//
+// A hash grid of hot pixels, an alternative to Multiple_kd_tree with the same
+// query. Each hot pixel is registered in all the grid cells its square
+// overlaps, and a query collects the hot pixels of the cells that a segment
+// crosses. The cells are located with doubles, enlarged by a margin that
+// covers the conversion and interpolation errors, so the query reports (at
+// least) all the hot pixels that the segment intersects; the caller filters
+// them with exact predicates.
+/////////////////////
+
+template<class Traits_, class SAVED_OBJECT>
+class Hot_pixel_grid {
+  static_assert(std::is_pointer<SAVED_OBJECT>::value, "SAVED_OBJECT is not a pointer.");
+private:
+  typedef Traits_                                       Traits;
+  typedef typename Traits::FT                           NT;
+  typedef typename Traits::Segment_2                    Segment_2;
+  typedef typename Traits::Point_2                      Point_2;
+
+  typedef std::pair<Point_2, SAVED_OBJECT>              Point_saved_pair;
+  typedef std::list<Point_saved_pair>                   Point_saved_pair_list;
+  typedef typename Point_saved_pair_list::iterator      Point_saved_pair_iter;
+
+  typedef std::pair<std::ptrdiff_t, std::ptrdiff_t>     Cell;
+  typedef std::unordered_map<Cell, std::vector<SAVED_OBJECT>,
+                             boost::hash<Cell> >        Cell_map;
+
+private:
+  Traits m_gt;
+  Point_saved_pair_list input_points_list;
+  double cell_size;
+  double margin;
+  Cell_map cells;
+
+  /*! */
+  std::ptrdiff_t cell_coordinate(double x) const
+  {
+    return static_cast<std::ptrdiff_t>(std::floor(x / cell_size));
+  }
+
+  /*! */
+  void to_double(const Point_2 & p, double & x, double & y) const
+  {
+    typename Traits::To_double to_dbl;
+    x = to_dbl(p.x());
+    y = to_dbl(p.y());
+  }
+
+public:
+
+  /*! */
+  Hot_pixel_grid(const Point_saved_pair_list & inp_points_list,
+                 NT pixel_size) :
+    input_points_list(inp_points_list)
+  {
+    CGAL_precondition(! input_points_list.empty());
+
+    typename Traits::To_double to_dbl;
+    const double pixel = to_dbl(pixel_size);
+
+    double xmin, ymin, xmax, ymax;
+    to_double(input_points_list.front().first, xmin, ymin);
+    xmax = xmin;
+    ymax = ymin;
+    for (Point_saved_pair_iter iter = input_points_list.begin();
+         iter != input_points_list.end(); ++iter)
+    {
+      double x, y;
+      to_double(iter->first, x, y);
+      xmin = (std::min)(xmin, x);
+      xmax = (std::max)(xmax, x);
+      ymin = (std::min)(ymin, y);
+      ymax = (std::max)(ymax, y);
+    }
+
+    // about one hot pixel per cell, but no cell smaller than a pixel
+    const double area = (xmax - xmin + pixel) * (ymax - ymin + pixel);
+    cell_size = (std::max)(pixel,
+                           std::sqrt(area / double(input_points_list.size())));
+
+    const double max_abs = (std::max)((std::max)(std::abs(xmin), std::abs(xmax)),
+                                      (std::max)(std::abs(ymin), std::abs(ymax)));
+    margin = 1e-6 * cell_size + 1e-10 * max_abs;
+
+    const double half_pixel = pixel / 2 + margin;
+    for (Point_saved_pair_iter iter = input_points_list.begin();
+         iter != input_points_list.end(); ++iter)
+    {
+      double x, y;
+      to_double(iter->first, x, y);
+      const std::ptrdiff_t i_max = cell_coordinate(x + half_pixel);
+      const std::ptrdiff_t j_max = cell_coordinate(y + half_pixel);
+      for (std::ptrdiff_t i = cell_coordinate(x - half_pixel); i <= i_max; ++i)
+        for (std::ptrdiff_t j = cell_coordinate(y - half_pixel); j <= j_max; ++j)
+          cells[Cell(i, j)].push_back(iter->second);
+    }
+  }
+
+  ~Hot_pixel_grid()
+  {
+    //delete all the points.
+    for(Point_saved_pair_iter it = input_points_list.begin();
+        it != input_points_list.end(); ++it) {
+      delete (it->second);
+    }
+  }
+
+  /*! */
+  void get_intersecting_points(std::list<SAVED_OBJECT> & result_list,
+                               const Segment_2 & s, NT /* unit_square */) const
+  {
+    typedef typename Traits::Construct_vertex_2  Construct_vertex_2;
+    Construct_vertex_2 construct_vertex = m_gt.construct_vertex_2_object();
+
+    double x0, y0, x1, y1;
+    to_double(construct_vertex(s, 0), x0, y0);
+    to_double(construct_vertex(s, 1), x1, y1);
+    if (x1 < x0) {
+      std::swap(x0, x1);
+      std::swap(y0, y1);
+    }
+    const double y_lo = (std::min)(y0, y1) - margin;
+    const double y_hi = (std::max)(y0, y1) + margin;
+    const double dx = x1 - x0;
+
+    std::vector<SAVED_OBJECT> found;
+
+    // walk the columns of cells crossed by the segment
+    const std::ptrdiff_t i_max = cell_coordinate(x1 + margin);
+    for (std::ptrdiff_t i = cell_coordinate(x0 - margin); i <= i_max; ++i)
+    {
+      double ya = y_lo, yb = y_hi;
+      if (dx > 0) {
+        // y-range of the segment over the x-range of the column
+        const double xa = (std::max)(x0, i * cell_size - margin);
+        const double xb = (std::min)(x1, (i + 1) * cell_size + margin);
+        ya = y0 + (xa - x0) / dx * (y1 - y0);
+        yb = y0 + (xb - x0) / dx * (y1 - y0);
+        if (yb < ya) std::swap(ya, yb);
+        ya = (std::max)(y_lo, ya - margin);
+        yb = (std::min)(y_hi, yb + margin);
+      }
+
+      const std::ptrdiff_t j_max = cell_coordinate(yb);
+      for (std::ptrdiff_t j = cell_coordinate(ya); j <= j_max; ++j) {
+        typename Cell_map::const_iterator c = cells.find(Cell(i, j));
+        if (c != cells.end())
+          found.insert(found.end(), c->second.begin(), c->second.end());
+      }
+    }
+
+    // a hot pixel may be registered in several of the crossed cells
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+
+    CGAL_assertion(result_list.empty());
+    result_list.insert(result_list.end(), found.begin(), found.end());
+  }
+};
+
+} //namespace CGAL
+
+#endif
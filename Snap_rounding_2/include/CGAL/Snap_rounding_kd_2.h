@@ -164,8 +164,9 @@ private:
     typename Traits::To_double to_dbl;
     int tranc_angle = int(to_dbl(angle) * rad_to_deg);
 
-    NT cosine_val = angle_to_sines_appr[90 - tranc_angle],
-       sine_val = angle_to_sines_appr[tranc_angle];
+    // at() rather than operator[], which is not safe to call concurrently
+    NT cosine_val = angle_to_sines_appr.at(90 - tranc_angle),
+       sine_val = angle_to_sines_appr.at(tranc_angle);
 
     Transformation_2 rotate(ROTATION, sine_val, cosine_val);
     p = rotate(p);
@@ -50,6 +50,32 @@ bool read_data(int argc, char *argv[], Number_Type &prec, Seg_list &seg_list)
   return true;
 }
 
+// Snap round with the given kd-trees or with the hash grid of hot pixels (and
+// possibly in parallel), and check that the output is the reference one.
+template <class ConcurrencyTag>
+bool same_output(const Seg_list& seg_list, Number_Type prec, bool do_isr,
+                 const Point_list_list& kd_output,
+                 unsigned int number_of_kd_trees, bool use_hot_pixel_grid)
+{
+  Point_list_list output_list;
+  CGAL::snap_rounding_2<Sr_traits, Seg_list::const_iterator,
+                        Point_list_list, ConcurrencyTag>(seg_list.begin(),
+                                                         seg_list.end(),
+                                                         output_list,
+                                                         prec, do_isr, false,
+                                                         number_of_kd_trees,
+                                                         use_hot_pixel_grid);
+  if (output_list != kd_output) {
+    if (use_hot_pixel_grid)
+      std::cerr << "Different output with the hot pixel grid" << std::endl;
+    else
+      std::cerr << "Different output with " << number_of_kd_trees
+                << " kd-trees" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 void print_out(std::ostream& out,
                Point_list_list::iterator begin_iter,
                Point_list_list::iterator end_iter)
@@ -92,6 +118,15 @@ int main(int argc,char *argv[])
   out << std::endl << "the output" << std::endl;
   print_out(out, output_list.begin(),output_list.end());
 
+  bool ok = same_output<CGAL::Sequential_tag>(seg_list, prec, true,
+                                              output_list, 1, true);
+#ifdef CGAL_LINKED_WITH_TBB
+  ok = ok && same_output<CGAL::Parallel_tag>(seg_list, prec, true,
+                                             output_list, 3, false);
+  ok = ok && same_output<CGAL::Parallel_tag>(seg_list, prec, true,
+                                             output_list, 1, true);
+#endif
+
   out << std::endl << "testing sr" << std::endl;
   output_list.clear();
   CGAL::snap_rounding_2<Sr_traits, Seg_list::const_iterator,
@@ -101,5 +136,12 @@ int main(int argc,char *argv[])
                                          prec, false, false, 3);
   print_out(out, output_list.begin(),output_list.end());
 
-  return(0);
+  ok = ok && same_output<CGAL::Sequential_tag>(seg_list, prec, false,
+                                               output_list, 1, true);
+#ifdef CGAL_LINKED_WITH_TBB
+  ok = ok && same_output<CGAL::Parallel_tag>(seg_list, prec, false,
+                                             output_list, 1, true);
+#endif
+
+  return(ok ? 0 : 1);
 }
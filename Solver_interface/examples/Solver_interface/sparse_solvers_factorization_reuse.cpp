@@ -0,0 +1,66 @@
+#include <CGAL/Eigen_solver_traits.h>
+#include <CGAL/Eigen_matrix.h>
+#include <CGAL/Timer.h>
+
+#include <iostream>
+
+typedef CGAL::Eigen_sparse_matrix<double>::EigenType                  EigenMatrix;
+typedef CGAL::Eigen_solver_traits<Eigen::SimplicialLDLT<EigenMatrix> > Eigen_solver;
+typedef Eigen_solver::NT                                               FT;
+typedef Eigen_solver::Matrix                                           Eigen_matrix;
+typedef Eigen_solver::Vector                                           Eigen_vector;
+
+// Fills the matrix (weight * I + L), where L is the Laplacian of a grid of n x n nodes.
+// All the matrices share the same sparsity pattern.
+void fill_shifted_laplacian(std::size_t n, FT weight, Eigen_matrix& A)
+{
+  for(std::size_t i=0; i<n; ++i)
+  {
+    for(std::size_t j=0; j<n; ++j)
+    {
+      const std::size_t v = i * n + j;
+      FT diagonal = weight;
+      if(i + 1 < n) { A.set_coef(v, v + n, -1, true); diagonal += 1; }
+      if(i > 0)     { A.set_coef(v, v - n, -1, true); diagonal += 1; }
+      if(j + 1 < n) { A.set_coef(v, v + 1, -1, true); diagonal += 1; }
+      if(j > 0)     { A.set_coef(v, v - 1, -1, true); diagonal += 1; }
+      A.set_coef(v, v, diagonal, true);
+    }
+  }
+}
+
+int main(void)
+{
+  const std::size_t n = 300;
+  const std::size_t degree = n * n;
+
+  Eigen_vector B(degree);
+  for(std::size_t i=0; i<degree; ++i)
+    B.set(i, 1);
+
+  // The solver analyzes the pattern of the first matrix only: the following
+  // systems, which have the same pattern, only require a numerical factorization.
+  Eigen_solver solver;
+  CGAL::Timer timer;
+  for(int step=1; step<=5; ++step)
+  {
+    timer.reset();
+    timer.start();
+
+    Eigen_matrix A(degree, degree);
+    fill_shifted_laplacian(n, FT(step), A);
+
+    Eigen_vector X(degree);
+    FT d;
+    if(!(solver.linear_solver(A, B, X, d)))
+    {
+      std::cerr << "Error: linear solver failed" << std::endl;
+      return -1;
+    }
+
+    timer.stop();
+    std::cout << "System #" << step << " solved in " << timer.time() << " s" << std::endl;
+  }
+
+  return 0;
+}
@@ -29,7 +29,9 @@
 
 #include <CGAL/Eigen_matrix.h>
 #include <CGAL/Eigen_vector.h>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace CGAL {
 namespace internal {
@@ -60,6 +62,60 @@ struct Get_eigen_matrix< ::Eigen::SparseLU<EigenMatrix, EigenOrdering >, FT>
   typedef Eigen_sparse_matrix<FT>             type;
 };
 #endif
+
+// Sparsity pattern of the last matrix analyzed by a sparse solver, used to skip
+// the symbolic analysis (ordering, elimination tree, ...) of the next matrices
+// as long as their pattern does not change.
+template <class EigenMatrix>
+class Eigen_sparsity_pattern
+{
+#if EIGEN_VERSION_AT_LEAST(3, 3, 0)
+  typedef typename EigenMatrix::StorageIndex                StorageIndex;
+#else
+  typedef typename EigenMatrix::Index                       StorageIndex;
+#endif
+
+public:
+  Eigen_sparsity_pattern() : m_rows(-1), m_cols(-1) { }
+
+  void clear()
+  {
+    m_rows = m_cols = -1;
+    m_outer.clear();
+    m_inner.clear();
+  }
+
+  // only compressed matrices are compared, other matrices are always analyzed
+  bool is_pattern_of(const EigenMatrix& M) const
+  {
+    if(m_rows < 0 || !M.isCompressed() || M.rows() != m_rows || M.cols() != m_cols ||
+       M.nonZeros() != static_cast<std::ptrdiff_t>(m_inner.size()))
+      return false;
+
+    return std::equal(m_outer.begin(), m_outer.end(), M.outerIndexPtr()) &&
+           std::equal(m_inner.begin(), m_inner.end(), M.innerIndexPtr());
+  }
+
+  void assign(const EigenMatrix& M)
+  {
+    if(!M.isCompressed())
+    {
+      clear();
+      return;
+    }
+
+    m_rows = M.rows();
+    m_cols = M.cols();
+    m_outer.assign(M.outerIndexPtr(), M.outerIndexPtr() + M.outerSize() + 1);
+    m_inner.assign(M.innerIndexPtr(), M.innerIndexPtr() + M.nonZeros());
+  }
+
+private:
+  std::ptrdiff_t m_rows, m_cols;
+  std::vector<StorageIndex> m_outer;
+  std::vector<StorageIndex> m_inner;
+};
+
 } //internal
 
 /*!
@@ -72,6 +128,16 @@ The class `Eigen_solver_traits` provides an interface to the sparse solvers of \
 
 \tparam EigenSolverT A sparse solver of \ref thirdpartyEigen "Eigen". The default solver is the iterative bi-conjugate gradient stabilized solver  `Eigen::BiCGSTAB` for `double`.
 
+The symbolic analysis of a matrix (fill-reducing ordering, elimination tree, ...) is kept
+from one factorization to the next: when a new matrix has the same sparsity pattern
+as the previously factorized one, only its numerical factorization is computed.
+Copies of a traits object share the same solver, hence the same analysis.
+
+Sparse direct solvers of external libraries that are wrapped by \ref thirdpartyEigen "Eigen",
+for example the supernodal Cholesky factorization `Eigen::CholmodSupernodalLLT` of CHOLMOD
+or `Eigen::PardisoLLT` of the Intel MKL, factorize with several threads and can be used
+as `EigenSolverT`, their libraries being then required.
+
 \sa `CGAL::Eigen_sparse_matrix<T>`
 \sa `CGAL::Eigen_sparse_symmetric_matrix<T>`
 \sa `CGAL::Eigen_vector<T>`
@@ -94,6 +160,9 @@ typedef CGAL::Eigen_solver_traits< Eigen::ConjugateGradient<EigenMatrix> > Itera
 //direct symmetric solver
 typedef CGAL::Eigen_solver_traits< Eigen::SimplicialCholesky<EigenMatrix> > Direct_symmetric_solver;
 
+//multithreaded supernodal direct symmetric solver (requires CHOLMOD and `#include <Eigen/CholmodSupport>`)
+typedef CGAL::Eigen_solver_traits< Eigen::CholmodSupernodalLLT<EigenMatrix> > Supernodal_symmetric_solver;
+
 \endcode
 */
 template<class EigenSolverT = Eigen::BiCGSTAB<Eigen_sparse_matrix<double>::EigenType> >
@@ -126,7 +195,12 @@ public:
   // Public operations
 public:
   /// Constructor
-  Eigen_solver_traits() : m_mat(nullptr), m_solver_sptr(new EigenSolverT) { }
+  Eigen_solver_traits()
+    : m_mat(nullptr),
+      m_solver_sptr(new EigenSolverT),
+      m_pattern_sptr(new internal::Eigen_sparsity_pattern<typename Matrix::EigenType>),
+      m_normal_mat_sptr(new typename Matrix::EigenType)
+  { }
 
   /// \name Operations
   /// @{
@@ -146,7 +220,7 @@ public:
   {
     D = 1; // Eigen does not support homogeneous coordinates
 
-    m_solver_sptr->compute(A.eigen_object());
+    compute(A.eigen_object());
 
     if(m_solver_sptr->info() != Eigen::Success)
       return false;
@@ -166,7 +240,7 @@ public:
     D = 1;
 
     m_mat = &A.eigen_object();
-    solver().compute(*m_mat);
+    compute(*m_mat);
     return solver().info() == Eigen::Success;
   }
 
@@ -199,7 +273,10 @@ public:
   {
     typename Matrix::EigenType At = A.eigen_object().transpose();
     m_mat = &A.eigen_object();
-    solver().compute(At * A.eigen_object());
+    // kept alive, as iterative solvers refer to the matrix they are given
+    *m_normal_mat_sptr = At * A.eigen_object();
+    m_normal_mat_sptr->makeCompressed();
+    compute(*m_normal_mat_sptr);
     return solver().info() == Eigen::Success;
   }
 
@@ -225,8 +302,27 @@ public:
   }
 
 protected:
+  // Factorizes `M`, the symbolic analysis being skipped if `M` has the same pattern
+  // as the previously factorized matrix.
+  void compute(const typename Matrix::EigenType& M)
+  {
+    if(!m_pattern_sptr->is_pattern_of(M))
+    {
+      solver().analyzePattern(M);
+      m_pattern_sptr->assign(M);
+    }
+
+    solver().factorize(M);
+
+    // analyze again next time, as the analysis might be the cause of the failure
+    if(solver().info() != Eigen::Success)
+      m_pattern_sptr->clear();
+  }
+
   const typename Matrix::EigenType* m_mat;
   std::shared_ptr<EigenSolverT> m_solver_sptr;
+  std::shared_ptr<internal::Eigen_sparsity_pattern<typename Matrix::EigenType> > m_pattern_sptr;
+  std::shared_ptr<typename Matrix::EigenType> m_normal_mat_sptr;
 };
 
 // Specialization of the solver for BiCGSTAB as for surface parameterization,
@@ -30,6 +30,37 @@ create_offset_polygons_2(FT offset,
                          const StraightSkeleton& ss,
                          OfK k = Exact_predicates_inexact_constructions_kernel());
 
+/*!
+\ingroup PkgStraightSkeleton2OffsetFunctions
+
+\brief returns, for each distance in the range `[offsets_begin, offsets_end)`, a container with the offset polygons
+at this distance obtained from the straight skeleton `ss`.
+
+The straight skeleton is constructed (and, if needed, converted) only once and is shared by all distances.
+The `i`-th entry of the returned vector holds the offset polygons at the `i`-th distance of the range.
+
+\tparam OfKPolygon is a polygon without holes type determined from `OfK`, see Section \ref SLSOffsetPolygonReturnType.
+\tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+        `Parallel_tag`, and `Parallel_if_available_tag`. With a parallel tag, the offset polygons
+        at different distances are constructed concurrently.
+\tparam FTIterator must be a model of `InputIterator` with a value type convertible to `OfK::FT`.
+\tparam StraightSkeleton is an object of type `CGAL::Straight_skeleton_2<SsK>`.
+\tparam OfK must be a model of `Kernel`. It is used to instantiate
+           `Polygon_offset_builder_traits_2<OfK>` for constructing the offset polygons.
+
+\note If `SsK != OfK` the constructed straight skeleton is converted to `CGAL::Straight_skeleton_2<OfK>`.
+
+\pre All the distances are positive.
+\pre `ss` is a valid straight skeleton.
+*/
+template <typename OfKPolygon, typename ConcurrencyTag = Sequential_tag,
+          typename FTIterator, typename StraightSkeleton, typename OfK>
+std::vector< std::vector< std::shared_ptr<OfKPolygon> > >
+create_offset_polygons_2(FTIterator offsets_begin,
+                         FTIterator offsets_end,
+                         const StraightSkeleton& ss,
+                         OfK k);
+
 // ---------------------------------------------- INTERIOR -----------------------------------------
 
 /*!
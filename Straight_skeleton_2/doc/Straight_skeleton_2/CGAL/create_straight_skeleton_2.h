@@ -83,6 +83,33 @@ std::shared_ptr< Straight_skeleton_2<SsK> >
 create_interior_straight_skeleton_2(const Polygon& polygon,
                                     SsK k = CGAL::Exact_predicates_inexact_constructions_kernel());
 
+/*!
+\ingroup PkgStraightSkeleton2SkeletonFunctions
+
+\brief creates a straight skeleton in the interior of each 2D polygon of the range `polygons`.
+
+The `i`-th entry of the returned vector is the skeleton of the `i`-th polygon of the range,
+as returned by `CGAL::create_interior_straight_skeleton_2()`.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+        `Parallel_tag`, and `Parallel_if_available_tag`. With a parallel tag, the skeletons
+        of different polygons are constructed concurrently.
+\tparam PolygonRange must be a model of `ConstRange` whose value type is a model of `SequenceContainer`
+        with value type `InK::Point_2` (e.g. `Polygon_2<InK>`), or a model of `GeneralPolygonWithHoles_2`
+        (e.g. `Polygon_with_holes_2<InK>`).
+\tparam SsK must be a model of `Kernel`.
+
+\note This function is defined in the header `CGAL/create_straight_skeleton_from_polygon_with_holes_2.h`.
+
+\pre Each polygon is a weakly simple, counterclockwise polygon with clockwise oriented holes.
+
+\sa `CGAL::create_interior_straight_skeleton_2()`
+*/
+template <typename ConcurrencyTag = Sequential_tag, typename PolygonRange, typename SsK>
+std::vector< std::shared_ptr< Straight_skeleton_2<SsK> > >
+create_interior_straight_skeletons_2(const PolygonRange& polygons,
+                                     SsK k = CGAL::Exact_predicates_inexact_constructions_kernel());
+
 // ---------------------------------------------- EXTERIOR -----------------------------------------
 
 /*!
@@ -24,6 +24,7 @@
 
 #include <CGAL/assertions.h>
 #include <CGAL/Cartesian_converter.h>
+#include <CGAL/for_each.h>
 #include <CGAL/Kernel_traits.h>
 #include <CGAL/Polygon_2.h>
 #include <CGAL/Polygon_with_holes_2.h>
@@ -31,6 +32,7 @@
 
 #include <optional>
 #include <boost/range/value_type.hpp>
+#include <boost/range/irange.hpp>
 #include <memory>
 
 #include <algorithm>
@@ -180,6 +182,57 @@ create_offset_polygons_2 ( FT const& aOffset, Skeleton const& aSs, K const& /*k*
   return rR ;
 }
 
+//
+// Offset polygons at several distances, all obtained from the same skeleton (of kernel K)
+//
+template<class OutPolygon, class ConcurrencyTag, class FTIterator, class OfSkeleton>
+std::vector< std::vector< std::shared_ptr<OutPolygon> > >
+construct_offset_polygons_2 ( FTIterator aOffsetsBegin, FTIterator aOffsetsEnd, OfSkeleton const& aSs )
+{
+  typedef std::shared_ptr<OutPolygon> OutPolygonPtr ;
+  typedef std::vector<OutPolygonPtr>    OutPolygonPtrVector ;
+
+  typedef typename OfSkeleton::Traits K ;
+  typedef typename K::FT              OfFT ;
+
+  typedef Polygon_offset_builder_traits_2<K>                                  OffsetBuilderTraits;
+  typedef Polygon_offset_builder_2<OfSkeleton,OffsetBuilderTraits,OutPolygon> OffsetBuilder;
+
+  std::vector<OfFT> lOffsets(aOffsetsBegin, aOffsetsEnd) ;
+
+  std::vector<OutPolygonPtrVector> rR(lOffsets.size()) ;
+
+  // The offset builder does not modify the skeleton and keeps its state to itself,
+  // so the offsets at different distances can be traced independently.
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, lOffsets.size()),
+                                 [&](std::size_t i) -> bool
+                                 {
+                                   OffsetBuilder ob(aSs);
+                                   ob.construct_offset_contours(lOffsets[i], std::back_inserter(rR[i]) ) ;
+                                   return true;
+                                 });
+
+  return rR ;
+}
+
+template<class OutPolygon, class ConcurrencyTag, class FTIterator, class Skeleton, class K>
+std::vector< std::vector< std::shared_ptr<OutPolygon> > >
+create_offset_polygons_2 ( FTIterator aOffsetsBegin, FTIterator aOffsetsEnd, Skeleton const& aSs, K const& , Tag_false )
+{
+  typedef Straight_skeleton_2<K> OfSkeleton ;
+
+  // The skeleton is converted only once for all the distances
+  std::shared_ptr<OfSkeleton> lConvertedSs = convert_straight_skeleton_2<OfSkeleton>(aSs);
+  return construct_offset_polygons_2<OutPolygon, ConcurrencyTag>(aOffsetsBegin, aOffsetsEnd, *lConvertedSs) ;
+}
+
+template<class OutPolygon, class ConcurrencyTag, class FTIterator, class Skeleton, class K>
+std::vector< std::vector< std::shared_ptr<OutPolygon> > >
+create_offset_polygons_2 ( FTIterator aOffsetsBegin, FTIterator aOffsetsEnd, Skeleton const& aSs, K const& , Tag_true )
+{
+  return construct_offset_polygons_2<OutPolygon, ConcurrencyTag>(aOffsetsBegin, aOffsetsEnd, aSs) ;
+}
+
 // Allow failure due to invalid straight skeletons to go through the users
 template<class Skeleton>
 Skeleton const& dereference ( std::shared_ptr<Skeleton> const& ss )
@@ -211,6 +264,26 @@ create_offset_polygons_2(const FT& aOffset,
   return create_offset_polygons_2<Polygon>(aOffset, aSs, Exact_predicates_inexact_constructions_kernel());
 }
 
+// Several distances, one skeleton: the i-th entry of the result holds the offset polygons
+// at the i-th distance of the range
+template<class OutPolygon, class ConcurrencyTag = Sequential_tag,
+         class FTIterator, class Skeleton, class K>
+std::vector< std::vector< std::shared_ptr<OutPolygon> > >
+inline
+create_offset_polygons_2(FTIterator aOffsetsBegin,
+                         FTIterator aOffsetsEnd,
+                         const Skeleton& aSs,
+                         const K& k)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  typename CGAL_SS_i::Is_same_type<K, typename Skeleton::Traits>::type same_kernel;
+  return CGAL_SS_i::create_offset_polygons_2<OutPolygon, ConcurrencyTag>(aOffsetsBegin, aOffsetsEnd, aSs, k, same_kernel);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
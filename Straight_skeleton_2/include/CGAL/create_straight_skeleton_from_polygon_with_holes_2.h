@@ -19,10 +19,15 @@
 #include <CGAL/Straight_skeleton_2/Polygon_iterators.h>
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
-#include <memory>
+#include <boost/range/irange.hpp>
 
+#include <iterator>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace CGAL {
 
@@ -42,6 +47,44 @@ create_interior_straight_skeleton_2 ( Polygon const& aPolyWithHoles,
                                             );
 }
 
+// The skeletons of polygons that do not share any edge are independent: each polygon,
+// with or without holes, gets its own builder, and the builders may run concurrently.
+template<class ConcurrencyTag = Sequential_tag, class PolygonRange, class K>
+std::vector< std::shared_ptr< Straight_skeleton_2<K> > >
+create_interior_straight_skeletons_2 ( PolygonRange const& aPolygons,
+                                       K const& k )
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  typedef typename std::iterator_traits<typename PolygonRange::const_iterator>::value_type Polygon ;
+
+  std::vector<const Polygon*> lPolygons ;
+  for ( const Polygon& p : aPolygons )
+    lPolygons.push_back(&p) ;
+
+  std::vector< std::shared_ptr< Straight_skeleton_2<K> > > rR(lPolygons.size()) ;
+
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, lPolygons.size()),
+                                 [&](std::size_t i) -> bool
+                                 {
+                                   rR[i] = create_interior_straight_skeleton_2(*lPolygons[i], k) ;
+                                   return true;
+                                 });
+
+  return rR ;
+}
+
+template<class ConcurrencyTag = Sequential_tag, class PolygonRange>
+std::vector< std::shared_ptr< Straight_skeleton_2< Exact_predicates_inexact_constructions_kernel > > >
+inline
+create_interior_straight_skeletons_2 ( PolygonRange const& aPolygons )
+{
+  return create_interior_straight_skeletons_2<ConcurrencyTag>(aPolygons, Exact_predicates_inexact_constructions_kernel());
+}
+
 // create_exterior_straight_skeleton_2() for polygon with holes is simply in create_straight_skeleton_2.h
 // as the holes do not matter.
 
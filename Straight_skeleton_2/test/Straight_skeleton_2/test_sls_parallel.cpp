@@ -0,0 +1,127 @@
+// Check that the skeletons of independent polygons and the offsets at several
+// distances from one skeleton match the results of the one-at-a-time functions.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+
+#include <CGAL/create_straight_skeleton_from_polygon_with_holes_2.h>
+#include <CGAL/create_offset_polygons_2.h>
+#include <CGAL/Polygon_2.h>
+#include <CGAL/Polygon_with_holes_2.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   EPICK;
+typedef CGAL::Exact_predicates_exact_constructions_kernel     EPECK;
+
+typedef EPICK::Point_2                                        Point_2;
+typedef CGAL::Polygon_2<EPICK>                                Polygon_2;
+typedef CGAL::Polygon_with_holes_2<EPICK>                     Polygon_with_holes_2;
+
+typedef std::vector< std::shared_ptr<Polygon_2> >             Offset_polygons;
+
+// A star-shaped polygon around (cx, cy), counterclockwise
+Polygon_2 random_star(double cx, double cy, double r, int n, CGAL::Random& rnd)
+{
+  Polygon_2 p;
+  for(int i=0; i<n; ++i)
+  {
+    double a = 2 * CGAL_PI * i / n;
+    double l = r * rnd.get_double(0.4, 1.);
+    p.push_back(Point_2(cx + l * std::cos(a), cy + l * std::sin(a)));
+  }
+  return p;
+}
+
+std::vector<Polygon_with_holes_2> random_polygons(int n, CGAL::Random& rnd)
+{
+  std::vector<Polygon_with_holes_2> polygons;
+  for(int i=0; i<n; ++i)
+  {
+    Polygon_with_holes_2 pwh(random_star(10 * i, 0, 4, 40, rnd));
+    Polygon_2 hole = random_star(10 * i, 0, 0.5, 8, rnd);
+    hole.reverse_orientation();
+    pwh.add_hole(hole);
+    polygons.push_back(pwh);
+  }
+  return polygons;
+}
+
+bool same_offsets(const Offset_polygons& a, const Offset_polygons& b)
+{
+  if(a.size() != b.size())
+    return false;
+  for(std::size_t i=0; i<a.size(); ++i)
+    if(*a[i] != *b[i])
+      return false;
+  return true;
+}
+
+template <typename ConcurrencyTag, typename K>
+void test_skeletons(const std::vector<Polygon_with_holes_2>& polygons)
+{
+  std::vector< std::shared_ptr< CGAL::Straight_skeleton_2<K> > > ss =
+    CGAL::create_interior_straight_skeletons_2<ConcurrencyTag>(polygons, K());
+  assert(ss.size() == polygons.size());
+
+  for(std::size_t i=0; i<polygons.size(); ++i)
+  {
+    std::shared_ptr< CGAL::Straight_skeleton_2<K> > ref =
+      CGAL::create_interior_straight_skeleton_2(polygons[i], K());
+    assert(ss[i] && ref);
+    assert(ss[i]->size_of_vertices() == ref->size_of_vertices());
+    assert(ss[i]->size_of_halfedges() == ref->size_of_halfedges());
+    assert(ss[i]->size_of_faces() == ref->size_of_faces());
+  }
+}
+
+template <typename ConcurrencyTag, typename K>
+void test_offsets(const Polygon_with_holes_2& polygon)
+{
+  std::shared_ptr< CGAL::Straight_skeleton_2<K> > ss =
+    CGAL::create_interior_straight_skeleton_2(polygon, K());
+  assert(ss);
+
+  const std::vector<double> offsets = { 0.05, 0.2, 0.5, 1., 1.5, 3., 10. };
+
+  std::vector<Offset_polygons> res =
+    CGAL::create_offset_polygons_2<Polygon_2, ConcurrencyTag>(offsets.begin(), offsets.end(),
+                                                              *ss, EPICK());
+  assert(res.size() == offsets.size());
+
+  for(std::size_t i=0; i<offsets.size(); ++i)
+  {
+    Offset_polygons ref = CGAL::create_offset_polygons_2<Polygon_2>(offsets[i], *ss, EPICK());
+    assert(same_offsets(res[i], ref));
+  }
+  assert(res.back().empty());
+}
+
+template <typename ConcurrencyTag>
+void test(const std::vector<Polygon_with_holes_2>& polygons)
+{
+  test_skeletons<ConcurrencyTag, EPICK>(polygons);
+  test_skeletons<ConcurrencyTag, EPECK>(polygons);
+
+  test_offsets<ConcurrencyTag, EPICK>(polygons.front());
+  test_offsets<ConcurrencyTag, EPECK>(polygons.front());
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::vector<Polygon_with_holes_2> polygons = random_polygons(16, rnd);
+
+  test<CGAL::Sequential_tag>(polygons);
+#ifdef CGAL_LINKED_WITH_TBB
+  test<CGAL::Parallel_tag>(polygons);
+#endif
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
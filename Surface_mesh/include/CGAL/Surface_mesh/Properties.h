@@ -65,6 +65,34 @@ public:
     /// Let two elements swap their storage place.
     virtual void swap(size_t i0, size_t i1) = 0;
 
+    /// Keep only the elements at positions `order[0]`, `order[1]`, etc., in this order.
+    /// The default implementation permutes the elements with `swap()`.
+    virtual void gather(const std::vector<std::size_t>& order)
+    {
+        std::size_t n = order.size();
+        for (std::size_t i : order)
+            n = (std::max)(n, i + 1);
+        // position[e] is the current position of the element that was at
+        // position e, and element[p] is the former position of the element at p
+        std::vector<std::size_t> position(n), element(n);
+        for (std::size_t i = 0; i < n; ++i)
+            position[i] = element[i] = i;
+        for (std::size_t k = 0; k < order.size(); ++k)
+        {
+            const std::size_t from = position[order[k]];
+            if (from == k)
+                continue;
+            swap(k, from);
+            const std::size_t e = element[k];
+            element[k] = order[k];
+            element[from] = e;
+            position[order[k]] = k;
+            position[e] = from;
+        }
+        resize(order.size());
+        shrink_to_fit();
+    }
+
     /// Return a deep copy of self.
     virtual Base_property_array* clone () const = 0;
 
@@ -164,6 +192,15 @@ public: // virtual interface of Base_property_array
         data_[i1]=d;
     }
 
+    virtual void gather(const std::vector<std::size_t>& order)
+    {
+        vector_type d;
+        d.reserve(order.size());
+        for (std::size_t i : order)
+            d.push_back(data_[i]);
+        data_.swap(d);
+    }
+
     virtual Base_property_array* clone() const
     {
         Property_array<T>* p = new Property_array<T>(this->name_, this->value_);
@@ -501,6 +538,15 @@ public:
             parrays_[i]->swap(i0, i1);
     }
 
+    // keep only the elements at positions order[0], order[1], etc. in all arrays
+    void gather(const std::vector<std::size_t>& order)
+    {
+        for (std::size_t i=0; i<parrays_.size(); ++i)
+            parrays_[i]->gather(order);
+        size_ = order.size();
+        capacity_ = size_;
+    }
+
     // swap content with other Property_container
     void swap (Property_container& other)
     {
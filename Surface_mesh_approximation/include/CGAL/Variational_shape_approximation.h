@@ -26,6 +26,7 @@
 #include <CGAL/Surface_mesh_approximation/L21_metric_plane_proxy.h>
 #include <CGAL/Default.h>
 #include <CGAL/tags.h>
+#include <CGAL/for_each.h>
 
 #include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
 
@@ -33,6 +34,7 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/subgraph.hpp>
+#include <boost/range/irange.hpp>
 #include <optional>
 
 #include <CGAL/Named_function_parameters.h>
@@ -79,7 +81,10 @@ enum Seeding_method {
 /// @tparam VertexPointMap a `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor` as key and `GeomTraits::Point_3` as value type
 /// @tparam ErrorMetricProxy a model of `ErrorMetricProxy`
 /// @tparam GeomTraits a model of Kernel
-/// @tparam Concurrency_tag concurrency tag.
+/// @tparam Concurrency_tag enables sequential versus parallel algorithm.
+/// Possible values are `Sequential_tag` and `Parallel_tag`.
+/// With `Parallel_tag`, the partition, the proxy fitting and the meshing run in parallel,
+/// and the partition may differ from the one computed with `Sequential_tag`.
 template <typename TriangleMesh,
   typename VertexPointMap,
   typename ErrorMetricProxy = CGAL::Default,
@@ -146,6 +151,9 @@ private:
   typedef CGAL::dynamic_face_property_t<std::size_t> Face_proxy_tag;
   typedef typename boost::property_map<TriangleMesh, Face_proxy_tag>::type Face_proxy_map;
 
+  typedef CGAL::dynamic_face_property_t<std::size_t> Face_id_tag;
+  typedef typename boost::property_map<TriangleMesh, Face_id_tag>::type Face_id_map;
+
   typedef std::vector<halfedge_descriptor> Boundary_chord;
   typedef typename Boundary_chord::iterator Boundary_chord_iterator;
 
@@ -258,6 +266,14 @@ private:
   // The attached anchor index of a vertex.
   Vertex_anchor_map m_vanchor_map;
 
+  // Face adjacency used by the parallel partition, initialized on demand.
+  // The faces of the mesh.
+  std::vector<face_descriptor> m_faces;
+  // The index of a face in m_faces.
+  Face_id_map m_face_ids;
+  // The indices of the adjacent faces, CGAL_VSA_INVALID_TAG across the border.
+  std::vector<std::array<std::size_t, 3> > m_fadj;
+
 //member functions
 public:
   /// \name Construction
@@ -277,7 +293,8 @@ public:
     m_metric(&error_metric),
     m_average_edge_length(0.0),
     m_fproxy_map( get(Face_proxy_tag(), *(const_cast<TriangleMesh *>(m_ptm))) ),
-    m_vanchor_map( get( Vertex_anchor_tag(), *(const_cast<TriangleMesh *>(m_ptm))) )
+    m_vanchor_map( get( Vertex_anchor_tag(), *(const_cast<TriangleMesh *>(m_ptm))) ),
+    m_face_ids( get( Face_id_tag(), *(const_cast<TriangleMesh *>(m_ptm))) )
   {
 
     Geom_traits traits;
@@ -1186,6 +1203,20 @@ private:
    */
   template<typename ProxyWrapperIterator>
   void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end) {
+    partition(beg, end, Concurrency_tag());
+  }
+
+  /*!
+   * @brief partitions the area tagged with CGAL_VSA_INVALID_TAG with proxies, sequential.
+   * The faces are integrated one at a time in increasing order of fitting error.
+   * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
+   * @param beg iterator point to the first element
+   * @param end iterator point to the one past the last element
+   * @param t concurrency tag
+   */
+  template<typename ProxyWrapperIterator>
+  void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end, const CGAL::Sequential_tag & t) {
+    CGAL_USE(t);
     std::priority_queue<Face_to_integrate> face_pqueue;
     for (ProxyWrapperIterator pxw_itr = beg; pxw_itr != end; ++pxw_itr) {
       face_descriptor f = pxw_itr->seed;
@@ -1216,6 +1247,131 @@ private:
     }
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  /*!
+   * @brief partitions the area tagged with CGAL_VSA_INVALID_TAG with proxies, parallel.
+   * The flooding proceeds by rounds: the best proxy of each face of the front is computed
+   * in parallel among its already integrated neighbors (ties are broken by the smallest proxy index),
+   * and the faces whose error is not larger than the median error of the front are integrated.
+   * The other faces stay in the front of the next round, which also receives the new neighbors.
+   * The result does not depend on the number of threads, but may differ from the sequential partition.
+   * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
+   * @param beg iterator point to the first element
+   * @param end iterator point to the one past the last element
+   * @param t concurrency tag
+   */
+  template<typename ProxyWrapperIterator>
+  void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end, const CGAL::Parallel_tag & t) {
+    CGAL_USE(t);
+    init_face_adjacency();
+
+    const std::size_t nb_faces = m_faces.size();
+    std::vector<std::size_t> fpx(nb_faces);
+    for (std::size_t i = 0; i < nb_faces; ++i)
+      fpx[i] = get(m_fproxy_map, m_faces[i]);
+
+    // the proxies taking part in this partition, by proxy index
+    std::vector<const Proxy *> px_params(m_proxies.size(), nullptr);
+    // faces integrated by this partition, written back at the end
+    std::vector<std::size_t> integrated;
+    for (ProxyWrapperIterator pxw_itr = beg; pxw_itr != end; ++pxw_itr) {
+      px_params[pxw_itr->idx] = &(pxw_itr->px);
+      const std::size_t i = get(m_face_ids, pxw_itr->seed);
+      fpx[i] = pxw_itr->idx;
+      integrated.push_back(i);
+    }
+
+    std::vector<char> queued(nb_faces, 0);
+    std::vector<std::size_t> front;
+    for (const std::size_t i : integrated) {
+      for (const std::size_t j : m_fadj[i]) {
+        if (j != CGAL_VSA_INVALID_TAG && fpx[j] == CGAL_VSA_INVALID_TAG && !queued[j]) {
+          queued[j] = 1;
+          front.push_back(j);
+        }
+      }
+    }
+
+    std::vector<Proxy_error> candidates;
+    std::vector<FT> errors;
+    std::vector<std::size_t> next_front;
+    while (!front.empty()) {
+      // best proxy of each face among its integrated neighbors
+      candidates.assign(front.size(), Proxy_error(CGAL_VSA_INVALID_TAG, FT(0.0)));
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, front.size()),
+        [&](const tbb::blocked_range<std::size_t> &r) {
+          for (std::size_t k = r.begin(); k != r.end(); ++k) {
+            const std::size_t i = front[k];
+            Proxy_error &c = candidates[k];
+            for (const std::size_t j : m_fadj[i]) {
+              if (j == CGAL_VSA_INVALID_TAG || fpx[j] == CGAL_VSA_INVALID_TAG
+                || px_params[fpx[j]] == nullptr || fpx[j] == c.px)
+                continue;
+              const FT err = m_metric->compute_error(m_faces[i], *m_ptm, *px_params[fpx[j]]);
+              if (c.px == CGAL_VSA_INVALID_TAG || err < c.err || (err == c.err && fpx[j] < c.px))
+                c = Proxy_error(fpx[j], err);
+            }
+          }
+        });
+
+      // integrate the faces with an error up to the median of the front
+      errors.resize(candidates.size());
+      for (std::size_t k = 0; k < candidates.size(); ++k)
+        errors[k] = candidates[k].err;
+      typename std::vector<FT>::iterator median = errors.begin() + errors.size() / 2;
+      std::nth_element(errors.begin(), median, errors.end());
+      const FT threshold = *median;
+
+      next_front.clear();
+      std::size_t nb_front_integrated = integrated.size();
+      for (std::size_t k = 0; k < front.size(); ++k) {
+        if (threshold < candidates[k].err) {
+          next_front.push_back(front[k]);
+          continue;
+        }
+        fpx[front[k]] = candidates[k].px;
+        integrated.push_back(front[k]);
+      }
+      for (; nb_front_integrated < integrated.size(); ++nb_front_integrated) {
+        for (const std::size_t j : m_fadj[integrated[nb_front_integrated]]) {
+          if (j != CGAL_VSA_INVALID_TAG && fpx[j] == CGAL_VSA_INVALID_TAG && !queued[j]) {
+            queued[j] = 1;
+            next_front.push_back(j);
+          }
+        }
+      }
+      front.swap(next_front);
+    }
+
+    for (const std::size_t i : integrated)
+      put(m_fproxy_map, m_faces[i], fpx[i]);
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
+  /*!
+   * @brief initializes the face indices and the face adjacency, if not already done.
+   */
+  void init_face_adjacency() {
+    if (!m_faces.empty())
+      return;
+
+    m_faces.reserve(m_nb_of_faces);
+    for(face_descriptor f : faces(*m_ptm)) {
+      put(m_face_ids, f, m_faces.size());
+      m_faces.push_back(f);
+    }
+
+    m_fadj.resize(m_faces.size());
+    for (std::size_t i = 0; i < m_faces.size(); ++i) {
+      std::size_t k = 0;
+      for(face_descriptor fadj : faces_around_face(halfedge(m_faces[i], *m_ptm), *m_ptm)) {
+        CGAL_assertion(k < 3);
+        m_fadj[i][k++] = (fadj == boost::graph_traits<TriangleMesh>::null_face()) ?
+          CGAL_VSA_INVALID_TAG : get(m_face_ids, fadj);
+      }
+    }
+  }
+
   /*!
    * @brief refits and updates input range of proxies, sequential.
    * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
@@ -1248,7 +1404,7 @@ private:
   template<typename ProxyWrapperIterator>
   void fit(const ProxyWrapperIterator beg, const ProxyWrapperIterator end, const CGAL::Parallel_tag & t) {
     CGAL_USE(t);
-    std::vector<std::list<face_descriptor> > px_faces(m_proxies.size());
+    std::vector<std::vector<face_descriptor> > px_faces(m_proxies.size());
     for(face_descriptor f : faces(*m_ptm))
       px_faces[get(m_fproxy_map, f)].push_back(f);
 
@@ -1476,11 +1632,14 @@ private:
    */
   void compute_proxy_planes(const bool if_pca_plane) {
     // fit proxy planes, areas, normals
-    std::vector<std::list<face_descriptor> > px_faces(m_proxies.size());
+    std::vector<std::vector<face_descriptor> > px_faces(m_proxies.size());
     for(face_descriptor f : faces(*m_ptm))
       px_faces[get(m_fproxy_map, f)].push_back(f);
 
-    for(const std::list<face_descriptor>& px_patch : px_faces) {
+    m_px_planes.assign(px_faces.size(), Proxy_plane(Plane_3(), CGAL::NULL_VECTOR, FT(0.0)));
+    CGAL::for_each<Concurrency_tag>(boost::irange<std::size_t>(0, px_faces.size()),
+      [&](const std::size_t px_idx) -> bool {
+      const std::vector<face_descriptor>& px_patch = px_faces[px_idx];
       Plane_3 fit_plane = if_pca_plane ?
         fit_plane_pca(px_patch.begin(), px_patch.end()) :
           fit_plane_area_averaged(px_patch.begin(), px_patch.end());
@@ -1504,26 +1663,35 @@ private:
       else
         norm = Vector_3(FT(0.0), FT(0.0), FT(1.0));
 
-      m_px_planes.push_back(Proxy_plane(fit_plane, norm, area));
-    }
+      m_px_planes[px_idx] = Proxy_plane(fit_plane, norm, area);
+      return true;
+    });
   }
 
   /*!
    * @brief finds the anchors.
    */
   void find_anchors() {
-    for(vertex_descriptor vtx : vertices(*m_ptm)) {
+    std::vector<vertex_descriptor> vtxs(vertices(*m_ptm).first, vertices(*m_ptm).second);
+    std::vector<char> is_anchor(vtxs.size(), 0);
+    CGAL::for_each<Concurrency_tag>(boost::irange<std::size_t>(0, vtxs.size()),
+      [&](const std::size_t i) -> bool {
       std::size_t border_count = 0;
 
-      for(halfedge_descriptor h : halfedges_around_target(vtx, *m_ptm)) {
+      for(halfedge_descriptor h : halfedges_around_target(vtxs[i], *m_ptm)) {
         if (CGAL::is_border_edge(h, *m_ptm))
           ++border_count;
         else if (get(m_fproxy_map, face(h, *m_ptm)) != get(m_fproxy_map, face(opposite(h, *m_ptm), *m_ptm)))
           ++border_count;
       }
-      if (border_count >= 3)
-        attach_anchor(vtx);
-    }
+      is_anchor[i] = (border_count >= 3);
+      return true;
+    });
+
+    // attach in vertex order, the anchor indices do not depend on the concurrency tag
+    for (std::size_t i = 0; i < vtxs.size(); ++i)
+      if (is_anchor[i])
+        attach_anchor(vtxs[i]);
   }
 
   /*!
@@ -1725,29 +1893,41 @@ private:
         vpatch.push_back(superv);
     }
 
-    // multi-source Dijkstra's shortest path algorithm applied to each proxy patch
-    for(VertexVector& vpatch : vertex_patches) {
-      // ignore ball patch
+    // construct the subgraph of each proxy patch, ball patches are ignored
+    std::vector<SubGraph *> patch_graphs(vertex_patches.size(), nullptr);
+    for (std::size_t p = 0; p < vertex_patches.size(); ++p) {
+      const VertexVector& vpatch = vertex_patches[p];
       if (vpatch.back() == boost::graph_traits<SubGraph>::null_vertex())
         continue;
 
-      // construct subgraph
       SubGraph &glocal = gmain.create_subgraph();
       for(sg_vertex_descriptor v : vpatch)
         add_vertex(v, glocal);
+      patch_graphs[p] = &glocal;
+    }
+
+    // multi-source Dijkstra's shortest path algorithm applied to each proxy patch,
+    // the vertices shared by several patches are tagged afterwards in patch order
+    std::vector<std::vector<std::pair<sg_vertex_descriptor, std::size_t> > > patch_vtags(vertex_patches.size());
+    CGAL::for_each<Concurrency_tag>(boost::irange<std::size_t>(0, vertex_patches.size()),
+      [&](const std::size_t p) -> bool {
+      if (patch_graphs[p] == nullptr)
+        return true;
+      const SubGraph &glocal = *patch_graphs[p];
 
       // most subgraph functions work with local descriptors
-      VertexIndex1Map local_vanchor_map = get(boost::vertex_index1, glocal);
-      VertexIndex2Map local_vtag_map = get(boost::vertex_index2, glocal);
-      EdgeWeightMap local_eweight_map = get(boost::edge_weight, glocal);
+      const VertexIndex1Map local_vanchor_map = get(boost::vertex_index1, *patch_graphs[p]);
+      const EdgeWeightMap local_eweight_map = get(boost::edge_weight, *patch_graphs[p]);
 
-      const sg_vertex_descriptor source = glocal.global_to_local(vpatch.back());
+      const sg_vertex_descriptor source = glocal.global_to_local(vertex_patches[p].back());
       VertexVector pred(num_vertices(glocal),
         boost::graph_traits<SubGraph>::null_vertex());
       boost::dijkstra_shortest_paths(glocal, source,
         boost::predecessor_map(&pred[0]).weight_map(local_eweight_map));
 
       // backtrack to the anchor and tag each vertex in the local patch graph
+      std::vector<std::pair<sg_vertex_descriptor, std::size_t> > &vtags = patch_vtags[p];
+      vtags.reserve(num_vertices(glocal));
       for(sg_vertex_descriptor v : make_range(vertices(glocal))) {
         // skip the added super source vertex in the patch
         if (v == source)
@@ -1755,9 +1935,14 @@ private:
         sg_vertex_descriptor curr = v;
         while (!is_anchor_attached(curr, local_vanchor_map))
           curr = pred[curr];
-        local_vtag_map[v] = local_vanchor_map[curr];
+        vtags.push_back(std::make_pair(glocal.local_to_global(v), local_vanchor_map[curr]));
       }
-    }
+      return true;
+    });
+
+    for(const std::vector<std::pair<sg_vertex_descriptor, std::size_t> >& vtags : patch_vtags)
+      for(const std::pair<sg_vertex_descriptor, std::size_t>& vt : vtags)
+        global_vtag_map[vt.first] = vt.second;
 
     // tag all boundary chords
     for(const Boundary_cycle& bcycle : m_bcycles) {
@@ -2020,12 +2205,12 @@ private:
    * the anchor vertex to the incident proxy plane.
    */
   void optimize_anchor_location(bool optimize_boundary_anchor_location) {
-    for(Anchor& a : m_anchors) {
+    CGAL::for_each<Concurrency_tag>(m_anchors, [&](Anchor& a) -> bool {
       const vertex_descriptor v = a.vtx;
 
       if(! optimize_boundary_anchor_location && is_border(v,*m_ptm)){
         a.pos  = m_vpoint_map[v];
-        continue;
+        return true;
       }
 
       // incident proxy set
@@ -2053,7 +2238,8 @@ private:
           scale_functor(vec, FT(1.0) / sum_area));
       else
         a.pos = vtx_pt;
-    }
+      return true;
+    });
   }
 
   /*!
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <fstream>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Variational_shape_approximation.h>
+#include <CGAL/Surface_mesh_approximation/L21_metric_plane_proxy.h>
+#include <CGAL/Surface_mesh_approximation/L2_metric_plane_proxy.h>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef CGAL::Surface_mesh<Kernel::Point_3> Mesh;
+typedef boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+
+typedef Mesh::Property_map<face_descriptor, std::size_t> Face_proxy_map;
+typedef boost::property_map<Mesh, boost::vertex_point_t>::type Vertex_point_map;
+
+typedef CGAL::Surface_mesh_approximation::L21_metric_plane_proxy<Mesh> L21_metric;
+typedef CGAL::Surface_mesh_approximation::L2_metric_plane_proxy<Mesh> L2_metric;
+
+/**
+ * This file tests the approximation with the given concurrency tag:
+ * every face is assigned to an existing proxy, every proxy has a face,
+ * and the meshing produces triangles.
+ */
+template <typename Error_metric, typename Concurrency_tag>
+bool test(Mesh &mesh)
+{
+  typedef CGAL::Variational_shape_approximation<Mesh, Vertex_point_map,
+    Error_metric, CGAL::Default, Concurrency_tag> Approximation;
+
+  const Vertex_point_map vpmap = get(boost::vertex_point, mesh);
+  Error_metric error_metric(mesh, vpmap);
+  Approximation approx(mesh, vpmap, error_metric);
+
+  approx.initialize_seeds(CGAL::parameters::seeding_method(CGAL::Surface_mesh_approximation::HIERARCHICAL)
+    .max_number_of_proxies(50));
+  approx.run(10);
+  std::cout << "  #proxies " << approx.number_of_proxies()
+            << ", error " << approx.compute_total_error() << std::endl;
+
+  approx.split(0, 2, 5);
+
+  Face_proxy_map fpxmap =
+    mesh.add_property_map<face_descriptor, std::size_t>("f:proxy_id", 0).first;
+  approx.proxy_map(fpxmap);
+
+  std::vector<std::size_t> px_sizes(approx.number_of_proxies(), 0);
+  for(face_descriptor f : faces(mesh)) {
+    if (fpxmap[f] >= approx.number_of_proxies()) {
+      std::cerr << "Face with invalid proxy index." << std::endl;
+      return false;
+    }
+    ++px_sizes[fpxmap[f]];
+  }
+  mesh.remove_property_map(fpxmap);
+  for (std::size_t s : px_sizes) {
+    if (s == 0) {
+      std::cerr << "Empty proxy." << std::endl;
+      return false;
+    }
+  }
+
+  approx.extract_mesh(CGAL::parameters::subdivision_ratio(1.0));
+  std::vector<std::array<std::size_t, 3> > tris;
+  approx.indexed_triangles(std::back_inserter(tris));
+  std::cout << "  #triangles " << tris.size() << std::endl;
+
+  return !tris.empty();
+}
+
+int main()
+{
+  Mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/sphere.off"));
+  if (!input || !(input >> mesh) || !CGAL::is_triangle_mesh(mesh)) {
+    std::cerr << "Invalid input file." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Sequential L21" << std::endl;
+  if (!test<L21_metric, CGAL::Sequential_tag>(mesh))
+    return EXIT_FAILURE;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel L21" << std::endl;
+  if (!test<L21_metric, CGAL::Parallel_tag>(mesh))
+    return EXIT_FAILURE;
+
+  std::cout << "Parallel L2" << std::endl;
+  if (!test<L2_metric, CGAL::Parallel_tag>(mesh))
+    return EXIT_FAILURE;
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -20,10 +20,14 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/config.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 #include <CGAL/tuple.h>
 #include <CGAL/Simple_cartesian.h>
 #include <CGAL/Weights/cotangent_weights.h>
 
+#include <boost/range/irange.hpp>
+
 #include <vector>
 #include <list>
 #include <utility>
@@ -191,6 +195,10 @@ struct Types_selectors<TriangleMesh, VertexPointMap, CGAL::SRE_ARAP>
  /// `Deformation_Eigen_polar_closest_rotation_traits_3` is provided as default parameter.
  /// @tparam VPM a model of `ReadWritePropertyMap`</a>  with `Surface_mesh_deformation::vertex_descriptor` as key and a point as value type. The point type must be a model of `::RawPoint_3`.
  /// The default is `boost::property_map<TM, CGAL::vertex_point_t>::%type`.
+ /// @tparam ConcurrencyTag enables sequential versus parallel computation of the optimal rotations and of
+ ///         the right-hand sides of the linear systems solved at each iteration. Possible values are
+ ///         `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ ///         The default is `Sequential_tag`.
 template <
   class TM,
   class VIM=Default,
@@ -199,7 +207,8 @@ template <
   class WC = Default,
   class ST = Default,
   class CR = Default,
-  class VPM = Default
+  class VPM = Default,
+  class ConcurrencyTag = Sequential_tag
   >
 class Surface_mesh_deformation
 {
@@ -290,13 +299,15 @@ public:
   typedef typename boost::graph_traits<Triangle_mesh>::halfedge_descriptor halfedge_descriptor;
   /// The 3D point type, model of `::RawPoint_3`
   typedef typename boost::property_traits<Vertex_point_map>::value_type Point;
+  /// The concurrency tag
+  typedef ConcurrencyTag Concurrency_tag;
   /// A constant iterator range over the vertices of the region-of-interest.
   /// It is a model of `ConstRange` with `vertex_descriptor` as iterator value type.
   typedef std::vector<vertex_descriptor> Roi_vertex_range;
 /// @}
 
 private:
-  typedef Surface_mesh_deformation<TM, VIM, HIM, TAG, WC, ST, CR> Self;
+  typedef Surface_mesh_deformation<TM, VIM, HIM, TAG, WC, ST, CR, VPM, ConcurrencyTag> Self;
   // Repeat Triangle_mesh types
   typedef typename boost::graph_traits<Triangle_mesh>::in_edge_iterator    in_edge_iterator;
   typedef typename boost::graph_traits<Triangle_mesh>::out_edge_iterator   out_edge_iterator;
@@ -304,6 +315,8 @@ private:
   typedef typename Closest_rotation_traits::Matrix CR_matrix;
   typedef typename Closest_rotation_traits::Vector CR_vector;
 
+  typedef typename internal::Types_selectors<Triangle_mesh, Vertex_point_map, TAG>::ARAP_visitor ARAP_visitor;
+
 // Data members.
   Triangle_mesh& m_triangle_mesh;                   /**< Source triangulated surface mesh for modeling */
 
@@ -336,7 +349,7 @@ private:
   Weight_calculator weight_calculator;
 
 public:
-  typename internal::Types_selectors<Triangle_mesh, Vertex_point_map, TAG>::ARAP_visitor arap_visitor;
+  ARAP_visitor arap_visitor;
 private:
 
 #ifdef CGAL_DEFORM_MESH_USE_EXPERIMENTAL_SCALE
@@ -1196,180 +1209,174 @@ private:
   }
   void optimal_rotations_arap()
   {
-    Closest_rotation_traits cr_traits;
-    CR_matrix cov = cr_traits.zero_matrix();
+    // With SRE_ARAP, the covariance matrix of a vertex also depends on the rotations of its neighbors,
+    // which are updated in place: the result depends on the order of the vertices, so it is kept sequential.
+    if(TAG == SRE_ARAP)
+    {
+      for(std::size_t k = 0; k < ros.size(); k++)
+        optimal_rotation_arap(ros[k], rot_mtr[ros_id(ros[k])]);
+      return;
+    }
 
     // only accumulate ros vertices
-    for ( std::size_t k = 0; k < ros.size(); k++ )
-    {
-      vertex_descriptor vi = ros[k];
-      std::size_t vi_id = ros_id(vi);
-      // compute covariance matrix (user manual eq:cov_matrix)
-      cov = cr_traits.zero_matrix();
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, ros.size()),
+      [&](const std::size_t k) -> bool
+      {
+        optimal_rotation_arap(ros[k], rot_mtr[ros_id(ros[k])]);
+        return true;
+      });
+  }
+  void optimal_rotation_arap(vertex_descriptor vi, CR_matrix& rotation) const
+  {
+    Closest_rotation_traits cr_traits;
+    // the visitor might store per-vertex data, so each vertex uses its own copy
+    ARAP_visitor visitor = arap_visitor;
 
-      in_edge_iterator e, e_end;
+    std::size_t vi_id = ros_id(vi);
+    // compute covariance matrix (user manual eq:cov_matrix)
+    CR_matrix cov = cr_traits.zero_matrix();
 
-      arap_visitor.rotation_matrix_pre(vi, m_triangle_mesh);
+    in_edge_iterator e, e_end;
 
-      for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
-      {
-        halfedge_descriptor he=halfedge(*e, m_triangle_mesh);
-        vertex_descriptor vj = source(he, m_triangle_mesh);
-        std::size_t vj_id = ros_id(vj);
+    visitor.rotation_matrix_pre(vi, m_triangle_mesh);
 
-        const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
-        const CR_vector& qij = sub_to_CR_vector(solution[vi_id], solution[vj_id]);
-        double wij = hedge_weight[id(he)];
+    for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
+    {
+      halfedge_descriptor he=halfedge(*e, m_triangle_mesh);
+      vertex_descriptor vj = source(he, m_triangle_mesh);
+      std::size_t vj_id = ros_id(vj);
 
-        cr_traits.add_scalar_t_vector_t_vector_transpose(cov, wij, pij, qij); // cov += wij * (pij * qij)
+      const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
+      const CR_vector& qij = sub_to_CR_vector(solution[vi_id], solution[vj_id]);
+      double wij = hedge_weight[id(he)];
 
-        if ( vj_id < rot_mtr.size() )
-          arap_visitor.update_covariance_matrix(cov, rot_mtr[vj_id]);
-      }
+      cr_traits.add_scalar_t_vector_t_vector_transpose(cov, wij, pij, qij); // cov += wij * (pij * qij)
 
-      cr_traits.compute_close_rotation(cov, rot_mtr[vi_id]);
+      if ( vj_id < rot_mtr.size() )
+        visitor.update_covariance_matrix(cov, rot_mtr[vj_id]);
     }
+
+    cr_traits.compute_close_rotation(cov, rotation);
   }
   void optimal_rotations_spokes_and_rims()
+  {
+    // only accumulate ros vertices
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, ros.size()),
+      [&](const std::size_t k) -> bool
+      {
+        optimal_rotation_spokes_and_rims(ros[k], rot_mtr[ros_id(ros[k])]);
+        return true;
+      });
+  }
+  void optimal_rotation_spokes_and_rims(vertex_descriptor vi, CR_matrix& rotation) const
   {
     Closest_rotation_traits cr_traits;
-    CR_matrix cov =cr_traits.zero_matrix();
 
-    // only accumulate ros vertices
-    for ( std::size_t k = 0; k < ros.size(); k++ )
-    {
-      vertex_descriptor vi = ros[k];
-      std::size_t vi_id = ros_id(vi);
-      // compute covariance matrix
-      cov = cr_traits.zero_matrix();
+    // compute covariance matrix
+    CR_matrix cov = cr_traits.zero_matrix();
 
-      //iterate through all triangles
-      out_edge_iterator e, e_end;
-      for (std::tie(e,e_end) = out_edges(vi, m_triangle_mesh); e != e_end; e++)
+    //iterate through all triangles
+    out_edge_iterator e, e_end;
+    for (std::tie(e,e_end) = out_edges(vi, m_triangle_mesh); e != e_end; e++)
+    {
+      halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
+      if(is_border(he, m_triangle_mesh)) { continue; } // no facet
+      // iterate edges around facet
+      halfedge_descriptor hedge_around_facet = he;
+      do
       {
-        halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
-        if(is_border(he, m_triangle_mesh)) { continue; } // no facet
-        // iterate edges around facet
-        halfedge_descriptor hedge_around_facet = he;
-        do
-        {
-          vertex_descriptor v1 = target(hedge_around_facet, m_triangle_mesh);
-          vertex_descriptor v2 = source(hedge_around_facet, m_triangle_mesh);
-
-          std::size_t v1_id = ros_id(v1); std::size_t v2_id = ros_id(v2);
+        vertex_descriptor v1 = target(hedge_around_facet, m_triangle_mesh);
+        vertex_descriptor v2 = source(hedge_around_facet, m_triangle_mesh);
 
-          const CR_vector& p12 = sub_to_CR_vector(original[v1_id], original[v2_id]);
-          const CR_vector& q12 = sub_to_CR_vector(solution[v1_id], solution[v2_id]);
-          double w12 = hedge_weight[id(hedge_around_facet)];
+        std::size_t v1_id = ros_id(v1); std::size_t v2_id = ros_id(v2);
 
-          cr_traits.add_scalar_t_vector_t_vector_transpose(cov, w12, p12, q12); // cov += w12 * (p12 * q12);
+        const CR_vector& p12 = sub_to_CR_vector(original[v1_id], original[v2_id]);
+        const CR_vector& q12 = sub_to_CR_vector(solution[v1_id], solution[v2_id]);
+        double w12 = hedge_weight[id(hedge_around_facet)];
 
-        } while( (hedge_around_facet = next(hedge_around_facet, m_triangle_mesh)) != he);
-      }
+        cr_traits.add_scalar_t_vector_t_vector_transpose(cov, w12, p12, q12); // cov += w12 * (p12 * q12);
 
-      cr_traits.compute_close_rotation(cov, rot_mtr[vi_id]);
+      } while( (hedge_around_facet = next(hedge_around_facet, m_triangle_mesh)) != he);
     }
+
+    cr_traits.compute_close_rotation(cov, rotation);
   }
 
 #ifdef CGAL_DEFORM_MESH_USE_EXPERIMENTAL_SCALE
   void optimal_scales()
   {
-    for ( std::size_t k = 0; k < ros.size(); k++ )
-    {
-      vertex_descriptor vi = ros[k];
-      std::size_t vi_id = ros_id(vi);
-      // compute covariance matrix (user manual eq:cov_matrix)
-      double eT_eR = 0, eRT_eR = 0;
-
-      in_edge_iterator e, e_end;
-      for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, ros.size()),
+      [&](const std::size_t k) -> bool
       {
-        halfedge_descriptor he = *e;
-        vertex_descriptor vj = source(he, m_triangle_mesh);
-        std::size_t vj_id = ros_id(vj);
+        vertex_descriptor vi = ros[k];
+        std::size_t vi_id = ros_id(vi);
+        // compute covariance matrix (user manual eq:cov_matrix)
+        double eT_eR = 0, eRT_eR = 0;
 
-        const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
-        const CR_vector& qij = sub_to_CR_vector(solution[vi_id], solution[vj_id]);
+        in_edge_iterator e, e_end;
+        for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
+        {
+          halfedge_descriptor he = *e;
+          vertex_descriptor vj = source(he, m_triangle_mesh);
+          std::size_t vj_id = ros_id(vj);
 
-        double wij = hedge_weight[id(he)];
+          const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
+          const CR_vector& qij = sub_to_CR_vector(solution[vi_id], solution[vj_id]);
 
-        const CR_vector& pRij = rot_mtr[vi_id] * pij;
-        eRT_eR += pRij[0]*pRij[0] + pRij[1]*pRij[1] + pRij[2]*pRij[2];
-        eT_eR  += qij[0]*pRij[0]  + qij[1]*pRij[1]  + qij[2]*pRij[2];
-      }
+          double wij = hedge_weight[id(he)];
 
-      scales[vi_id] = eT_eR / eRT_eR;
-    }
+          const CR_vector& pRij = rot_mtr[vi_id] * pij;
+          eRT_eR += pRij[0]*pRij[0] + pRij[1]*pRij[1] + pRij[2]*pRij[2];
+          eT_eR  += qij[0]*pRij[0]  + qij[1]*pRij[1]  + qij[2]*pRij[2];
+        }
+
+        scales[vi_id] = eT_eR / eRT_eR;
+        return true;
+      });
   }
 #endif
 
   /// Global step of iterations, updating solution
   void update_solution()
-  {
-    if(TAG == SPOKES_AND_RIMS)
-    {
-      update_solution_spokes_and_rims();
-    }
-    else
-    {
-      update_solution_arap();
-    }
-  }
-  /// calculate right-hand side of eq:lap_ber in user manual and solve the system
-  void update_solution_arap()
   {
     typename Sparse_linear_solver::Vector X(ros.size()), Bx(ros.size());
     typename Sparse_linear_solver::Vector Y(ros.size()), By(ros.size());
     typename Sparse_linear_solver::Vector Z(ros.size()), Bz(ros.size());
 
-    Closest_rotation_traits cr_traits;
-
     // assemble right columns of linear system
-    for ( std::size_t k = 0; k < ros.size(); k++ )
-    {
-      vertex_descriptor vi = ros[k];
-      std::size_t vi_id = ros_id(vi);
-
-      if ( is_roi_vertex(vi) && !is_control_vertex(vi) )
-      {// free vertices
-        // sum of right-hand side of eq:lap_ber in user manual
-        CR_vector xyz = cr_traits.vector(0, 0, 0);
-
-        in_edge_iterator e, e_end;
-        for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
-        {
-          halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
-          vertex_descriptor vj = source(he, m_triangle_mesh);
-          std::size_t vj_id = ros_id(vj);
-
-          const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
-
-          double wij = hedge_weight[id(he)];
-          double wji = hedge_weight[id(opposite(he, m_triangle_mesh))];
-#ifndef CGAL_DEFORM_MESH_USE_EXPERIMENTAL_SCALE
-          cr_traits.add__scalar_t_matrix_p_scalar_t_matrix__t_vector(xyz, wij, rot_mtr[vi_id], wji, rot_mtr[vj_id], pij);
-#else
-        cr_traits.add__scalar_t_matrix_p_scalar_t_matrix__t_vector(xyz, wij * scales[vi_id], rot_mtr[vi_id],
-          wji * scales[vj_id], rot_mtr[vj_id], pij);
-#endif
-          // corresponds xyz += (wij*rot_mtr[vi_id] + wji*rot_mtr[vj_id]) * pij
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, ros.size()),
+      [&](const std::size_t k) -> bool
+      {
+        vertex_descriptor vi = ros[k];
+        std::size_t vi_id = ros_id(vi);
+
+        if ( is_roi_vertex(vi) && !is_control_vertex(vi) )
+        {// free vertices
+          const CR_vector xyz = (TAG == SPOKES_AND_RIMS) ? right_hand_side_spokes_and_rims(vi)
+                                                         : right_hand_side_arap(vi);
+          Closest_rotation_traits cr_traits;
+          Bx[vi_id] = cr_traits.vector_coordinate(xyz, 0);
+          By[vi_id] = cr_traits.vector_coordinate(xyz, 1);
+          Bz[vi_id] = cr_traits.vector_coordinate(xyz, 2);
         }
-        Bx[vi_id] = cr_traits.vector_coordinate(xyz, 0);
-        By[vi_id] = cr_traits.vector_coordinate(xyz, 1);
-        Bz[vi_id] = cr_traits.vector_coordinate(xyz, 2);
-      }
-      else
-      {// constrained vertex
-        Bx[vi_id] = solution[vi_id][0]; By[vi_id] = solution[vi_id][1]; Bz[vi_id] = solution[vi_id][2];
-      }
-    }
+        else
+        {// constrained vertices
+          Bx[vi_id] = solution[vi_id][0]; By[vi_id] = solution[vi_id][1]; Bz[vi_id] = solution[vi_id][2];
+        }
+        return true;
+      });
 
-    // solve "A*X = B".
+    // solve "A*X = B", using the factorization computed in preprocess()
     bool is_all_solved = m_solver.linear_solver(Bx, X) && m_solver.linear_solver(By, Y) && m_solver.linear_solver(Bz, Z);
     if(!is_all_solved) {
       CGAL_warning(false);
       return;
     }
+
     // copy to solution
     for (std::size_t i = 0; i < ros.size(); i++)
     {
@@ -1379,76 +1386,72 @@ private:
         solution[v_id] = p;
     }
   }
-  /// calculate right-hand side of eq:lap_ber_rims in user manual and solve the system
-  void update_solution_spokes_and_rims()
+  /// calculate right-hand side of eq:lap_ber in user manual for the free vertex `vi`
+  CR_vector right_hand_side_arap(vertex_descriptor vi) const
   {
-    typename Sparse_linear_solver::Vector X(ros.size()), Bx(ros.size());
-    typename Sparse_linear_solver::Vector Y(ros.size()), By(ros.size());
-    typename Sparse_linear_solver::Vector Z(ros.size()), Bz(ros.size());
-
     Closest_rotation_traits cr_traits;
+    std::size_t vi_id = ros_id(vi);
 
-    // assemble right columns of linear system
-    for ( std::size_t k = 0; k < ros.size(); k++ )
+    // sum of right-hand side of eq:lap_ber in user manual
+    CR_vector xyz = cr_traits.vector(0, 0, 0);
+
+    in_edge_iterator e, e_end;
+    for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
     {
-      vertex_descriptor vi = ros[k];
-      std::size_t vi_id = ros_id(vi);
+      halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
+      vertex_descriptor vj = source(he, m_triangle_mesh);
+      std::size_t vj_id = ros_id(vj);
 
-      if ( is_roi_vertex(vi) && !is_control_vertex(vi) )
-      {// free vertices
-        // sum of right-hand side of eq:lap_ber_rims in user manual
-        CR_vector xyz = cr_traits.vector(0, 0, 0);
+      const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
 
-        out_edge_iterator e, e_end;
-        for (std::tie(e,e_end) = out_edges(vi, m_triangle_mesh); e != e_end; e++)
-        {
-          halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
-          vertex_descriptor vj = target(he, m_triangle_mesh);
-          std::size_t vj_id = ros_id(vj);
+      double wij = hedge_weight[id(he)];
+      double wji = hedge_weight[id(opposite(he, m_triangle_mesh))];
+#ifndef CGAL_DEFORM_MESH_USE_EXPERIMENTAL_SCALE
+      cr_traits.add__scalar_t_matrix_p_scalar_t_matrix__t_vector(xyz, wij, rot_mtr[vi_id], wji, rot_mtr[vj_id], pij);
+#else
+      cr_traits.add__scalar_t_matrix_p_scalar_t_matrix__t_vector(xyz, wij * scales[vi_id], rot_mtr[vi_id],
+        wji * scales[vj_id], rot_mtr[vj_id], pij);
+#endif
+      // corresponds xyz += (wij*rot_mtr[vi_id] + wji*rot_mtr[vj_id]) * pij
+    }
+    return xyz;
+  }
+  /// calculate right-hand side of eq:lap_ber_rims in user manual for the free vertex `vi`
+  CR_vector right_hand_side_spokes_and_rims(vertex_descriptor vi) const
+  {
+    Closest_rotation_traits cr_traits;
+    std::size_t vi_id = ros_id(vi);
 
-          const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
+    // sum of right-hand side of eq:lap_ber_rims in user manual
+    CR_vector xyz = cr_traits.vector(0, 0, 0);
 
-          if(!is_border(he, m_triangle_mesh))
-          {
-            vertex_descriptor vn = target(next(he, m_triangle_mesh), m_triangle_mesh); // opp vertex of e_ij
-            double wji = hedge_weight[id(he)] / 3.0;  // edge(pj - pi)
-            cr_traits.add_scalar_t_matrix_sum_t_vector(xyz, wji, rot_mtr[vi_id], rot_mtr[vj_id], rot_mtr[ros_id(vn)], pij);
-            // corresponds  xyz += wji*(rot_mtr[vi_id] + rot_mtr[vj_id] + rot_mtr[ros_id(vn)])*pij;
-          }
+    out_edge_iterator e, e_end;
+    for (std::tie(e,e_end) = out_edges(vi, m_triangle_mesh); e != e_end; e++)
+    {
+      halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
+      vertex_descriptor vj = target(he, m_triangle_mesh);
+      std::size_t vj_id = ros_id(vj);
 
-          halfedge_descriptor opp = opposite(he, m_triangle_mesh);
-          if(!is_border(opp, m_triangle_mesh))
-          {
-            vertex_descriptor vm = target(next(opp, m_triangle_mesh), m_triangle_mesh); // other opp vertex of e_ij
-            double wij = hedge_weight[id(opp)] / 3.0;  // edge(pi - pj)
-            cr_traits.add_scalar_t_matrix_sum_t_vector(xyz, wij, rot_mtr[vi_id], rot_mtr[vj_id], rot_mtr[ros_id(vm)], pij);
-            // corresponds xyz += wij * ( rot_mtr[vi_id] + rot_mtr[vj_id] + rot_mtr[ros_id(vm)] ) * pij
-          }
-        }
-        Bx[vi_id] = cr_traits.vector_coordinate(xyz, 0);
-        By[vi_id] = cr_traits.vector_coordinate(xyz, 1);
-        Bz[vi_id] = cr_traits.vector_coordinate(xyz, 2);
-      }
-      else
-      {// constrained vertices
-        Bx[vi_id] = solution[vi_id][0]; By[vi_id] = solution[vi_id][1]; Bz[vi_id] = solution[vi_id][2];
+      const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
+
+      if(!is_border(he, m_triangle_mesh))
+      {
+        vertex_descriptor vn = target(next(he, m_triangle_mesh), m_triangle_mesh); // opp vertex of e_ij
+        double wji = hedge_weight[id(he)] / 3.0;  // edge(pj - pi)
+        cr_traits.add_scalar_t_matrix_sum_t_vector(xyz, wji, rot_mtr[vi_id], rot_mtr[vj_id], rot_mtr[ros_id(vn)], pij);
+        // corresponds  xyz += wji*(rot_mtr[vi_id] + rot_mtr[vj_id] + rot_mtr[ros_id(vn)])*pij;
       }
-    }
-    // solve "A*X = B".
-    bool is_all_solved = m_solver.linear_solver(Bx, X) && m_solver.linear_solver(By, Y) && m_solver.linear_solver(Bz, Z);
-    if(!is_all_solved) {
-      CGAL_warning(false);
-      return;
-    }
 
-    // copy to solution
-    for (std::size_t i = 0; i < ros.size(); i++)
-    {
-      std::size_t v_id = ros_id(ros[i]);
-      Point p(X[v_id], Y[v_id], Z[v_id]);
-      if (!is_ctrl_map[id(ros[i])])
-        solution[v_id] = p;
+      halfedge_descriptor opp = opposite(he, m_triangle_mesh);
+      if(!is_border(opp, m_triangle_mesh))
+      {
+        vertex_descriptor vm = target(next(opp, m_triangle_mesh), m_triangle_mesh); // other opp vertex of e_ij
+        double wij = hedge_weight[id(opp)] / 3.0;  // edge(pi - pj)
+        cr_traits.add_scalar_t_matrix_sum_t_vector(xyz, wij, rot_mtr[vi_id], rot_mtr[vj_id], rot_mtr[ros_id(vm)], pij);
+        // corresponds xyz += wij * ( rot_mtr[vi_id] + rot_mtr[vj_id] + rot_mtr[ros_id(vm)] ) * pij
+      }
     }
+    return xyz;
   }
 
   /// Assign solution to target surface mesh
@@ -1466,77 +1469,76 @@ private:
   /// Compute modeling energy
   double energy() const
   {
-    if(TAG == SPOKES_AND_RIMS)
-    {
-      return energy_spokes_and_rims();
-    }
-    else
-    {
-      return energy_arap();
-    }
+    // the energies of the vertices are computed independently,
+    // and summed in a fixed order so that the result does not depend on the concurrency tag
+    std::vector<double> vertex_energies(ros.size());
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, ros.size()),
+      [&](const std::size_t k) -> bool
+      {
+        vertex_energies[k] = (TAG == SPOKES_AND_RIMS) ? energy_spokes_and_rims(ros[k])
+                                                      : energy_arap(ros[k]);
+        return true;
+      });
+
+    double sum_of_energy = 0;
+    for(double e : vertex_energies)
+      sum_of_energy += e;
+    return sum_of_energy;
   }
-  double energy_arap() const
+  double energy_arap(vertex_descriptor vi) const
   {
     Closest_rotation_traits cr_traits;
 
     double sum_of_energy = 0;
-    // only accumulate ros vertices
-    for( std::size_t k = 0; k < ros.size(); k++ )
-    {
-      vertex_descriptor vi = ros[k];
-      std::size_t vi_id = ros_id(vi);
+    std::size_t vi_id = ros_id(vi);
 
-      in_edge_iterator e, e_end;
-      for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
-      {
-        halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
-        vertex_descriptor vj = source(he, m_triangle_mesh);
-        std::size_t vj_id = ros_id(vj);
+    in_edge_iterator e, e_end;
+    for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
+    {
+      halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
+      vertex_descriptor vj = source(he, m_triangle_mesh);
+      std::size_t vj_id = ros_id(vj);
 
-        const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
-        const CR_vector& qij = sub_to_CR_vector(solution[vi_id], solution[vj_id]);
+      const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
+      const CR_vector& qij = sub_to_CR_vector(solution[vi_id], solution[vj_id]);
 
-        double wij = hedge_weight[id(he)];
+      double wij = hedge_weight[id(he)];
 
-        sum_of_energy += wij * cr_traits.squared_norm_vector_scalar_vector_subs(qij, rot_mtr[vi_id], pij);
-        // sum_of_energy += wij * ( qij - rot_mtr[vi_id]*pij )^2
-      }
+      sum_of_energy += wij * cr_traits.squared_norm_vector_scalar_vector_subs(qij, rot_mtr[vi_id], pij);
+      // sum_of_energy += wij * ( qij - rot_mtr[vi_id]*pij )^2
     }
     return sum_of_energy;
   }
-  double energy_spokes_and_rims() const
+  double energy_spokes_and_rims(vertex_descriptor vi) const
   {
     Closest_rotation_traits cr_traits;
 
     double sum_of_energy = 0;
-    // only accumulate ros vertices
-    for( std::size_t k = 0; k < ros.size(); k++ )
+    std::size_t vi_id = ros_id(vi);
+
+    //iterate through all triangles
+    out_edge_iterator e, e_end;
+    for (std::tie(e,e_end) = out_edges(vi, m_triangle_mesh); e != e_end; e++)
     {
-      vertex_descriptor vi = ros[k];
-      std::size_t vi_id = ros_id(vi);
-      //iterate through all triangles
-      out_edge_iterator e, e_end;
-      for (std::tie(e,e_end) = out_edges(vi, m_triangle_mesh); e != e_end; e++)
+      halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
+      if(is_border(he, m_triangle_mesh)) { continue; } // no facet
+      // iterate edges around facet
+      halfedge_descriptor hedge_around_facet = he;
+      do
       {
-        halfedge_descriptor he = halfedge(*e, m_triangle_mesh);
-        if(is_border(he, m_triangle_mesh)) { continue; } // no facet
-        // iterate edges around facet
-        halfedge_descriptor hedge_around_facet = he;
-        do
-        {
-          vertex_descriptor v1 = target(hedge_around_facet, m_triangle_mesh);
-          vertex_descriptor v2 = source(hedge_around_facet, m_triangle_mesh);
-          std::size_t v1_id = ros_id(v1); std::size_t v2_id = ros_id(v2);
+        vertex_descriptor v1 = target(hedge_around_facet, m_triangle_mesh);
+        vertex_descriptor v2 = source(hedge_around_facet, m_triangle_mesh);
+        std::size_t v1_id = ros_id(v1); std::size_t v2_id = ros_id(v2);
 
-          const CR_vector& p12 = sub_to_CR_vector(original[v1_id], original[v2_id]);
-          const CR_vector& q12 = sub_to_CR_vector(solution[v1_id], solution[v2_id]);
-          double w12 = hedge_weight[id(hedge_around_facet)];
+        const CR_vector& p12 = sub_to_CR_vector(original[v1_id], original[v2_id]);
+        const CR_vector& q12 = sub_to_CR_vector(solution[v1_id], solution[v2_id]);
+        double w12 = hedge_weight[id(hedge_around_facet)];
 
-          sum_of_energy += w12 * cr_traits.squared_norm_vector_scalar_vector_subs(q12, rot_mtr[vi_id], p12);
-          // sum_of_energy += w12 * ( q12 - rot_mtr[vi_id]*p12 )^2
+        sum_of_energy += w12 * cr_traits.squared_norm_vector_scalar_vector_subs(q12, rot_mtr[vi_id], p12);
+        // sum_of_energy += w12 * ( q12 - rot_mtr[vi_id]*p12 )^2
 
-        } while( (hedge_around_facet = next(hedge_around_facet, m_triangle_mesh)) != he);
-      }
+      } while( (hedge_around_facet = next(hedge_around_facet, m_triangle_mesh)) != he);
     }
     return sum_of_energy;
   }
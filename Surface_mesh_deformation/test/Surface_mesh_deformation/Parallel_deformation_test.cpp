@@ -0,0 +1,104 @@
+#include "Surface_mesh_deformation_test_commons.h"
+
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/Polyhedron_items_with_id_3.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh_deformation.h>
+
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef CGAL::Polyhedron_3<Kernel, CGAL::Polyhedron_items_with_id_3>  Polyhedron;
+
+typedef CGAL::Simple_cartesian<double>::Vector_3 Vector;
+
+template <CGAL::Deformation_algorithm_tag TAG, typename ConcurrencyTag>
+struct Deform_mesh
+{
+  typedef CGAL::Surface_mesh_deformation<Polyhedron, CGAL::Default, CGAL::Default, TAG,
+                                         CGAL::Default, CGAL::Default, CGAL::Default, CGAL::Default,
+                                         ConcurrencyTag> type;
+};
+
+// replays the cactus deformation session, the system being factorized only once
+template <CGAL::Deformation_algorithm_tag TAG, typename ConcurrencyTag>
+Polyhedron deform(const Polyhedron& input)
+{
+  typedef typename Deform_mesh<TAG, ConcurrencyTag>::type DeformMesh;
+  typedef typename DeformMesh::vertex_descriptor vertex_descriptor;
+
+  Polyhedron mesh = input;
+  init_indices(mesh);
+
+  DeformMesh deform_mesh(mesh);
+  std::vector<vertex_descriptor> hg = read_rois(deform_mesh, "data/cactus_roi.txt", "data/cactus_handle.txt");
+
+  if(!deform_mesh.preprocess()) {
+    std::cerr << "Error: preprocess() failed!" << std::endl;
+    assert(false);
+  }
+
+  std::ifstream dif_stream("data/cactus_handle_differences.txt");
+  std::vector<Vector> dif_vector;
+  double x, y, z;
+  while(dif_stream >> x >> y >> z)
+    dif_vector.push_back(Vector(x, y, z));
+  assert(!dif_vector.empty());
+
+  CGAL::Timer timer;
+  timer.start();
+
+  Vector previous(0,0,0);
+  for(const Vector& dif : dif_vector)
+  {
+    deform_mesh.translate(hg.begin(), hg.end(), dif - previous);
+    deform_mesh.deform(10, 1e-4);
+    previous = dif;
+  }
+
+  std::cerr << "  " << dif_vector.size() << " deformations: " << timer.time() << " s" << std::endl;
+  return mesh;
+}
+
+double max_squared_distance(const Polyhedron& mesh_1, const Polyhedron& mesh_2)
+{
+  double max_sd = 0;
+  Polyhedron::Vertex_const_iterator it_1 = mesh_1.vertices_begin();
+  Polyhedron::Vertex_const_iterator it_2 = mesh_2.vertices_begin();
+  for( ; it_1 != mesh_1.vertices_end(); ++it_1 , ++it_2)
+    max_sd = (std::max)(max_sd, CGAL::squared_distance(it_1->point(), it_2->point()));
+  return max_sd;
+}
+
+// the results computed sequentially and in parallel are identical
+template <CGAL::Deformation_algorithm_tag TAG>
+void test(const Polyhedron& input)
+{
+  std::cerr << "Sequential" << std::endl;
+  Polyhedron sequential = deform<TAG, CGAL::Sequential_tag>(input);
+  assert(max_squared_distance(input, sequential) > 0);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cerr << "Parallel" << std::endl;
+  Polyhedron parallel = deform<TAG, CGAL::Parallel_tag>(input);
+  const double max_sd = max_squared_distance(sequential, parallel);
+  std::cerr << "  max squared distance to the sequential result: " << max_sd << std::endl;
+  assert(max_sd == 0);
+#endif
+}
+
+int main()
+{
+  Polyhedron input;
+  read_to_polyhedron(CGAL::data_file_path("meshes/cactus.off"), input);
+
+  std::cerr << "ORIGINAL_ARAP" << std::endl;
+  test<CGAL::ORIGINAL_ARAP>(input);
+  std::cerr << "SPOKES_AND_RIMS" << std::endl;
+  test<CGAL::SPOKES_AND_RIMS>(input);
+  std::cerr << "SRE_ARAP" << std::endl;
+  test<CGAL::SRE_ARAP>(input);
+
+  std::cerr << "All done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -14,11 +14,11 @@ Construction and destruction are undefined.
 
 \cgalHasModelsBegin
 \cgalHasModels{CGAL::Surface_mesh_parameterization::Fixed_border_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>}
-\cgalHasModels{CGAL::Surface_mesh_parameterization::ARAP_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>}
+\cgalHasModels{CGAL::Surface_mesh_parameterization::ARAP_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits, ConcurrencyTag>}
 \cgalHasModels{CGAL::Surface_mesh_parameterization::Barycentric_mapping_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>}
 \cgalHasModels{CGAL::Surface_mesh_parameterization::Discrete_authalic_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>}
 \cgalHasModels{CGAL::Surface_mesh_parameterization::Discrete_conformal_map_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>}
-\cgalHasModels{CGAL::Surface_mesh_parameterization::LSCM_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>}
+\cgalHasModels{CGAL::Surface_mesh_parameterization::LSCM_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits, ConcurrencyTag>}
 \cgalHasModels{CGAL::Surface_mesh_parameterization::Mean_value_coordinates_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>}
 \cgalHasModels{CGAL::Surface_mesh_parameterization::Circular_border_parameterizer_3<TriangleMesh>}
 \cgalHasModels{CGAL::Surface_mesh_parameterization::Square_border_parameterizer_3<TriangleMesh>}
@@ -42,7 +42,10 @@
 #include <CGAL/basic.h>
 #include <CGAL/circulator.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Has_member.h>
 #include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
 
 // Below are two macros that can be used to improve the accuracy of optimal Lt
 // matrices.
@@ -83,7 +86,9 @@
 
 #include <boost/iterator/function_output_iterator.hpp>
 #include <boost/functional/hash.hpp>
+#include <boost/range/irange.hpp>
 
+#include <atomic>
 #include <unordered_set>
 #include <iostream>
 #include <fstream>
@@ -99,12 +104,18 @@
 // @todo Handle the case cot = 0 with a local parameterization aligned with the axes
 //       (this produces C2=0 which is problematic to compute a & b)
 // @todo Add distortion measures
-// @todo Parallelize the local phase?
 
 namespace CGAL {
 
 namespace Surface_mesh_parameterization {
 
+namespace internal {
+
+// used to detect models of `SparseLinearAlgebraWithFactorTraits_d`
+CGAL_GENERATE_MEMBER_DETECTOR(factor);
+
+} // namespace internal
+
 // ------------------------------------------------------------------------------------
 // Declaration
 // ------------------------------------------------------------------------------------
@@ -161,12 +172,23 @@ namespace Surface_mesh_parameterization {
 ///           Eigen::UmfPackLU<Eigen_sparse_matrix<double>::EigenType> >
 /// \endcode
 ///
+///         If `SolverTraits_` is also a model of `SparseLinearAlgebraWithFactorTraits_d`,
+///         the constant matrix of the global step is factorized once and
+///         the factorization is reused across iterations.
+///
+/// \tparam ConcurrencyTag_ enables sequential versus parallel local steps
+///         (computation of the optimal linear transformation of each face) and assembly
+///         of the right hand side of the global step.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.<br>
+///         <b>%Default:</b> `Sequential_tag`
+///
 /// \sa `CGAL::Surface_mesh_parameterization::Fixed_border_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>`
 /// \sa `CGAL::Surface_mesh_parameterization::Iterative_authalic_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>`
 ///
 template < class TriangleMesh_,
            class BorderParameterizer_ = Default,
-           class SolverTraits_ = Default>
+           class SolverTraits_ = Default,
+           class ConcurrencyTag_ = Sequential_tag>
 class ARAP_parameterizer_3
 {
 public:
@@ -210,6 +232,9 @@ public:
 
   typedef TriangleMesh_                                       TriangleMesh;
 
+  /// Concurrency tag type
+  typedef ConcurrencyTag_                                     Concurrency_tag;
+
   /// Mesh halfedge type
   typedef typename boost::graph_traits<Triangle_mesh>::halfedge_descriptor  halfedge_descriptor;
 
@@ -238,6 +263,8 @@ private:
   typedef typename Solver_traits::Vector                            Vector;
   typedef typename Solver_traits::Matrix                            Matrix;
 
+  typedef Boolean_tag<internal::has_factor<Solver_traits>::value>   Solver_has_factor;
+
   // Memory maps
     // Each triangle is associated a linear transformation matrix
   typedef std::pair<NT, NT>                                         Lt_matrix;
@@ -757,102 +784,120 @@ private:
     return index_arg;
   }
 
-  // Compute the optimal values of the linear transformation matrices Lt.
+  // Compute the optimal value of the linear transformation matrix Lt of a face.
   template <typename VertexUVMap>
-  Error_code compute_optimal_Lt_matrices(const Triangle_mesh& mesh,
-                                         const Faces_vector& faces,
-                                         const Cot_map ctmap,
-                                         const Local_points& lp,
-                                         const Lp_map lpmap,
-                                         const VertexUVMap uvmap,
-                                         Lt_map ltmap) const
+  Lt_matrix compute_optimal_Lt_matrix(const Triangle_mesh& mesh,
+                                      face_descriptor fd,
+                                      const Cot_map ctmap,
+                                      const Local_points& lp,
+                                      const Lp_map lpmap,
+                                      const VertexUVMap uvmap) const
   {
-    Error_code status = OK;
+    // Compute the coefficients C1, C2, C3
+    NT C1 = 0., C2 = 0., C3 = 0.;
 
-    for(face_descriptor fd : faces) {
-      // Compute the coefficients C1, C2, C3
-      NT C1 = 0., C2 = 0., C3 = 0.;
-
-      halfedge_around_face_circulator hc(halfedge(fd, mesh), mesh), end(hc);
-      CGAL_For_all(hc, end) {
-        halfedge_descriptor hd = *hc;
-        NT c = get(ctmap, hd);
-
-        // UV positions
-        const Point_2& uvpi = get(uvmap, source(hd, mesh));
-        const Point_2& uvpj = get(uvmap, target(hd, mesh));
-        NT diff_x = uvpi.x() - uvpj.x();
-        NT diff_y = uvpi.y() - uvpj.y();
+    halfedge_around_face_circulator hc(halfedge(fd, mesh), mesh), end(hc);
+    CGAL_For_all(hc, end) {
+      halfedge_descriptor hd = *hc;
+      NT c = get(ctmap, hd);
+
+      // UV positions
+      const Point_2& uvpi = get(uvmap, source(hd, mesh));
+      const Point_2& uvpj = get(uvmap, target(hd, mesh));
+      NT diff_x = uvpi.x() - uvpj.x();
+      NT diff_y = uvpi.y() - uvpj.y();
 //        CGAL_warning(diff_x == 0. && diff_y == 0.);
 
-        // local positions (in the isometric 2D param)
-        const Local_indices& li = get(lpmap, hd);
-        const Point_2& ppi = lp[ li.first ];
-        const Point_2& ppj = lp[ li.second ];
-        NT p_diff_x = ppi.x() - ppj.x();
-        NT p_diff_y = ppi.y() - ppj.y();
-        CGAL_precondition(p_diff_x != 0. || p_diff_y != 0.);
-
-        C1 += c * ( p_diff_x*p_diff_x + p_diff_y*p_diff_y );
-        C2 += c * ( diff_x*p_diff_x + diff_y*p_diff_y );
-        C3 += c * ( diff_x*p_diff_y - diff_y*p_diff_x );
-      }
+      // local positions (in the isometric 2D param)
+      const Local_indices& li = get(lpmap, hd);
+      const Point_2& ppi = lp[ li.first ];
+      const Point_2& ppj = lp[ li.second ];
+      NT p_diff_x = ppi.x() - ppj.x();
+      NT p_diff_y = ppi.y() - ppj.y();
+      CGAL_precondition(p_diff_x != 0. || p_diff_y != 0.);
 
-      // Compute a and b
-      NT a = 0., b = 0.;
+      C1 += c * ( p_diff_x*p_diff_x + p_diff_y*p_diff_y );
+      C2 += c * ( diff_x*p_diff_x + diff_y*p_diff_y );
+      C3 += c * ( diff_x*p_diff_y - diff_y*p_diff_x );
+    }
 
-      if(m_lambda == 0.) { // ASAP
-        CGAL_precondition(C1 != 0.);
-        a = C2 / C1;
-        b = C3 / C1;
-      }
-      else if( std::abs(C1) < m_lambda_tolerance * m_lambda &&
-               std::abs(C2) < m_lambda_tolerance * m_lambda ) { // ARAP
-        // If lambda is large compared to C1 and C2, the cubic equation that
-        // determines a and b can be simplified to a simple quadric equation
-
-        CGAL_precondition(C2*C2 + C3*C3 != 0.);
-        NT denom = 1. / CGAL::sqrt(C2*C2 + C3*C3);
-        a = C2 * denom;
-        b = C3 * denom;
-      }
-      else { // general case
+    // Compute a and b
+    NT a = 0., b = 0.;
+
+    if(m_lambda == 0.) { // ASAP
+      CGAL_precondition(C1 != 0.);
+      a = C2 / C1;
+      b = C3 / C1;
+    }
+    else if( std::abs(C1) < m_lambda_tolerance * m_lambda &&
+             std::abs(C2) < m_lambda_tolerance * m_lambda ) { // ARAP
+      // If lambda is large compared to C1 and C2, the cubic equation that
+      // determines a and b can be simplified to a simple quadric equation
+
+      CGAL_precondition(C2*C2 + C3*C3 != 0.);
+      NT denom = 1. / CGAL::sqrt(C2*C2 + C3*C3);
+      a = C2 * denom;
+      b = C3 * denom;
+    }
+    else { // general case
 #ifdef CGAL_SMP_SOLVE_CUBIC_EQUATION
-        CGAL_precondition(C2 != 0.);
-        NT C2_denom = 1. / C2;
-        NT a3_coeff = 2. * m_lambda * (C2 * C2 + C3 * C3) * C2_denom * C2_denom;
+      CGAL_precondition(C2 != 0.);
+      NT C2_denom = 1. / C2;
+      NT a3_coeff = 2. * m_lambda * (C2 * C2 + C3 * C3) * C2_denom * C2_denom;
 
-        std::vector<NT> roots;
+      std::vector<NT> roots;
 #ifdef CGAL_SMP_SOLVE_EQUATIONS_WITH_GMP
-        solve_cubic_equation_with_AK(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
+      solve_cubic_equation_with_AK(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
 #else // !CGAL_SMP_SOLVE_EQUATIONS_WITH_GMP
-        solve_cubic_equation(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
+      solve_cubic_equation(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
 #endif
-        std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
-                                                          ctmap, lp, lpmap, uvmap,
-                                                          C2_denom, C3, roots);
+      std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
+                                                        ctmap, lp, lpmap, uvmap,
+                                                        C2_denom, C3, roots);
 
-        a = roots[ind];
-        b = C3 * C2_denom * a;
+      a = roots[ind];
+      b = C3 * C2_denom * a;
 #else // !CGAL_SMP_SOLVE_CUBIC_EQUATION, solve the bivariate system
-        std::vector<NT> a_roots;
-        std::vector<NT> b_roots;
-        solve_bivariate_system(C1, C2, C3, a_roots, b_roots);
-
-        std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
-                                                          ctmap, lp, lpmap, uvmap,
-                                                          a_roots, b_roots);
-        a = a_roots[ind];
-        b = b_roots[ind];
+      std::vector<NT> a_roots;
+      std::vector<NT> b_roots;
+      solve_bivariate_system(C1, C2, C3, a_roots, b_roots);
+
+      std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
+                                                        ctmap, lp, lpmap, uvmap,
+                                                        a_roots, b_roots);
+      a = a_roots[ind];
+      b = b_roots[ind];
 #endif
-      }
-
-      // Update the map faces --> optimal Lt matrices
-      Lt_matrix ltm = std::make_pair(a, b);
-      put(ltmap, fd, ltm);
     }
 
-    return status;
+    return std::make_pair(a, b);
+  }
+
+  // Compute the optimal values of the linear transformation matrices Lt.
+  template <typename VertexUVMap>
+  Error_code compute_optimal_Lt_matrices(const Triangle_mesh& mesh,
+                                         const Faces_vector& faces,
+                                         const Cot_map ctmap,
+                                         const Local_points& lp,
+                                         const Lp_map lpmap,
+                                         const VertexUVMap uvmap,
+                                         Lt_map ltmap) const
+  {
+    // The faces are independent, but the map 'ltmap' cannot be written concurrently
+    std::vector<Lt_matrix> ltms(faces.size());
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, faces.size()),
+      [&](const std::size_t i) -> bool
+      {
+        ltms[i] = compute_optimal_Lt_matrix(mesh, faces[i], ctmap, lp, lpmap, uvmap);
+        return true;
+      });
+
+    // Update the map faces --> optimal Lt matrices
+    for(std::size_t i=0; i<faces.size(); ++i)
+      put(ltmap, faces[i], ltms[i]);
+
+    return OK;
   }
 
   // Computes the coordinates of the vertices p0, p1, p2
@@ -947,6 +992,26 @@ private:
     return OK;
   }
 
+  // Reading a missing key of the hash maps inserts it: insert beforehand all the keys
+  // read when filling the right hand side (including border halfedges and null faces),
+  // so that the maps can then be read concurrently.
+  void initialize_map_keys(const Triangle_mesh& mesh,
+                           const Vertex_set& vertices,
+                           Cot_hm& cthm,
+                           Lp_hm& lphm,
+                           Lt_hash_map& lt_hm) const
+  {
+    for(vertex_descriptor vd : vertices) {
+      for(halfedge_descriptor hd : halfedges_around_target(vd, mesh)) {
+        for(halfedge_descriptor h : { hd, opposite(hd, mesh) }) {
+          cthm[h];
+          lphm[h];
+          lt_hm[face(h, mesh)];
+        }
+      }
+    }
+  }
+
   // Compute the coefficient b_ij = (i,j) of the right hand side vector B,
   // for j neighbor vertex of i.
   void compute_b_ij(const Triangle_mesh& mesh,
@@ -1076,25 +1141,55 @@ private:
                          Vector& Bu, Vector& Bv) const
   {
     // Initialize the right hand side B in the linear system "A*X = B"
-    Error_code status = OK;
+    // Each vertex sets its own lines of Bu and Bv
+    std::atomic<Error_code> status(OK);
 
-    for(vertex_descriptor vd : vertices) {
+    CGAL::for_each<Concurrency_tag>(vertices, [&](const vertex_descriptor vd) -> bool
+    {
       if(!get(vpmap, vd)) { // not yet parameterized
         // Compute the lines i of the vectors Bu and Bv
-        status = fill_linear_system_rhs(mesh, vd, ctmap, lp, lpmap,
-                                                  ltmap, vimap, Bu, Bv);
-        if(status != OK)
-          return status;
+        Error_code vd_status = fill_linear_system_rhs(mesh, vd, ctmap, lp, lpmap,
+                                                      ltmap, vimap, Bu, Bv);
+        if(vd_status != OK) {
+          status = vd_status;
+          return false;
+        }
       } else { // fixed vertices
         int index = get(vimap, vd);
         const Point_2& uv = get(uvmap, vd);
         Bu.set(index, uv.x());
         Bv.set(index, uv.y());
       }
-    }
+      return true;
+    });
+
     return status;
   }
 
+  // Factorize the constant matrix A, if the solver supports it.
+  bool factor_linear_system(const Matrix& A, CGAL::Tag_true)
+  {
+    double D;
+    return get_linear_algebra_traits().factor(A, D);
+  }
+
+  bool factor_linear_system(const Matrix&, CGAL::Tag_false)
+  {
+    return true;
+  }
+
+  // Solve "A*X = B", using the factorization of A if the solver supports it.
+  bool solve_linear_system(const Matrix&, const Vector& B, Vector& X, double& D, CGAL::Tag_true)
+  {
+    D = 1.0;
+    return get_linear_algebra_traits().linear_solver(B, X);
+  }
+
+  bool solve_linear_system(const Matrix& A, const Vector& B, Vector& X, double& D, CGAL::Tag_false)
+  {
+    return get_linear_algebra_traits().linear_solver(A, B, X, D);
+  }
+
   // Compute the right hand side and solve the linear system to obtain the
   // new UV coordinates.
   template <typename VertexUVMap,
@@ -1126,8 +1221,8 @@ private:
     // Solve "A*Xu = Bu". On success, the solution is (1/Du) * Xu.
     // Solve "A*Xv = Bv". On success, the solution is (1/Dv) * Xv.
     double Du, Dv;
-    if(!get_linear_algebra_traits().linear_solver(A, Bu, Xu, Du) ||
-       !get_linear_algebra_traits().linear_solver(A, Bv, Xv, Dv)) {
+    if(!solve_linear_system(A, Bu, Xu, Du, Solver_has_factor()) ||
+       !solve_linear_system(A, Bv, Xv, Dv, Solver_has_factor())) {
       std::cerr << "Could not solve linear system" << std::endl;
       status = ERROR_CANNOT_SOLVE_LINEAR_SYSTEM;
       return status;
@@ -1224,13 +1319,21 @@ private:
                             const Lt_map ltmap,
                             const VertexUVMap uvmap) const
   {
-    NT E = 0.;
+    // Sum the energies of the faces in a fixed order, so that the result
+    // does not depend on the concurrency tag
+    std::vector<NT> Efs(faces.size());
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, faces.size()),
+      [&](const std::size_t i) -> bool
+      {
+        Efs[i] = compute_current_face_energy(mesh, faces[i], ctmap, lp, lpmap,
+                                             ltmap, uvmap);
+        return true;
+      });
 
-    for(face_descriptor fd : faces) {
-      NT Ef = compute_current_face_energy(mesh, fd, ctmap, lp, lpmap,
-                                          ltmap, uvmap);
+    NT E = 0.;
+    for(const NT Ef : Efs)
       E += Ef;
-    }
 
     E *= 0.5;
     return E;
@@ -1361,6 +1464,14 @@ public:
     if(status != OK)
       return status;
 
+    // ... and factorized only once
+    if(!factor_linear_system(A, Solver_has_factor())) {
+      std::cerr << "Could not solve linear system" << std::endl;
+      return ERROR_CANNOT_SOLVE_LINEAR_SYSTEM;
+    }
+
+    initialize_map_keys(mesh, vertices, cthm, lphm, lt_hm);
+
     NT energy_this = compute_current_energy(mesh, faces, ctmap, lp, lpmap,
                                             ltmap, uvmap);
     NT energy_last;
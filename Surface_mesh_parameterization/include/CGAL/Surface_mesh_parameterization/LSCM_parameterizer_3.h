@@ -25,13 +25,18 @@
 
 #include <CGAL/circulator.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #ifdef CGAL_EIGEN3_ENABLED
 #include <CGAL/Eigen_solver_traits.h>
 #endif
 
 #include <boost/iterator/function_output_iterator.hpp>
+#include <boost/range/irange.hpp>
 
+#include <array>
+#include <type_traits>
 #include <unordered_set>
 #include <vector>
 
@@ -77,12 +82,18 @@ namespace Surface_mesh_parameterization {
 ///   CGAL::Eigen_solver_traits<Eigen::SimplicialLDLT< Eigen::SparseMatrix<double> > >
 /// \endcode
 ///
+/// \tparam ConcurrencyTag_ enables sequential versus parallel computation of the
+///         coefficients of the linear system. The coefficients are accumulated in the same order
+///         in both cases, so that the result does not depend on the concurrency tag.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.<br>
+///         <b>%Default:</b> `Sequential_tag`
 ///
 /// \sa `CGAL::Surface_mesh_parameterization::Two_vertices_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>`
 ///
 template < class TriangleMesh_,
            class BorderParameterizer_ = Default,
-           class SolverTraits_ = Default>
+           class SolverTraits_ = Default,
+           class ConcurrencyTag_ = Sequential_tag>
 class LSCM_parameterizer_3
 {
 public:
@@ -118,6 +129,9 @@ public:
 
   typedef TriangleMesh_                                       TriangleMesh;
 
+  /// Concurrency tag type
+  typedef ConcurrencyTag_                                     Concurrency_tag;
+
   /// Mesh halfedge type
   typedef typename boost::graph_traits<Triangle_mesh>::halfedge_descriptor halfedge_descriptor;
 
@@ -139,6 +153,18 @@ private:
   typedef typename Solver_traits::Vector                            Vector;
   typedef typename Solver_traits::Matrix                            Matrix;
 
+  // A line of the linear system, before it is accumulated in the normal equations:
+  // the coefficients of the free variables, and of the pinned vertices with their values
+  struct Triangle_relation
+  {
+    std::array<double, 5> vals, fvals, pvals;
+    std::array<unsigned int, 5> ids;
+    std::size_t nf = 0, nl = 0;
+  };
+
+  // Real and imaginary parts of the LSCM equation of a triangle
+  typedef std::array<Triangle_relation, 2>                          Triangle_relations;
+
 // Fields
 private:
   // %Object that maps (at least two) border vertices onto a 2D space
@@ -253,11 +279,26 @@ public:
     Matrix A(nbVariables, nbVariables); // the constant matrix used in the linear system A*X = B
     Vector X(nbVariables), B(nbVariables);
 
-    for(face_descriptor fd : ccfaces) {
-      // Create two lines in the linear system per triangle (one for u, one for v)
-      status = setup_triangle_relations(mesh, fd, uvmap, vimap, vpmap, fvi, A, B);
-      if (status != OK)
-        return status;
+    // Create two lines in the linear system per triangle (one for u, one for v)
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value) {
+      // The lines are computed concurrently, but accumulated in the order of the faces
+      std::vector<Triangle_relations> relations(ccfaces.size());
+      CGAL::for_each<Concurrency_tag>(
+        boost::irange<std::size_t>(0, ccfaces.size()),
+        [&](const std::size_t i) -> bool
+        {
+          compute_triangle_relations(mesh, ccfaces[i], uvmap, vimap, vpmap, fvi, relations[i]);
+          return true;
+        });
+
+      for(const Triangle_relations& r : relations)
+        accumulate_triangle_relations(r, A, B);
+    } else {
+      Triangle_relations r;
+      for(face_descriptor fd : ccfaces) {
+        compute_triangle_relations(mesh, fd, uvmap, vimap, vpmap, fvi, r);
+        accumulate_triangle_relations(r, A, B);
+      }
     }
 
     // Solve the "A*X = B" linear system in the least squares sense
@@ -284,7 +325,7 @@ public:
 
 // Private operations
 private:
-  // Utility for setup_triangle_relations():
+  // Utility for compute_triangle_relations():
   // Computes the coordinates of the vertices of a triangle
   // in a local 2D orthonormal basis of the triangle's plane.
   void project_triangle(const Point_3& p0, const Point_3& p1, const Point_3& p2, // in
@@ -316,7 +357,7 @@ private:
     z2 = Point_2(x2, y2);
   }
 
-  // Create two lines in the linear system per triangle (one for u, one for v).
+  // Compute the two lines in the linear system of a triangle (one for u, one for v).
   //
   // \pre vertices of `mesh` must be indexed.
   //
@@ -330,14 +371,13 @@ private:
             typename VertexIndexMap,
             typename VertexParameterizedMap,
             typename FreeVertexIndices>
-  Error_code setup_triangle_relations(const Triangle_mesh& mesh,
-                                      face_descriptor facet,
-                                      UVmap uvmap,
-                                      VertexIndexMap vimap,
-                                      VertexParameterizedMap vpmap,
-                                      const FreeVertexIndices& fvi,
-                                      Matrix& A,
-                                      Vector& B) const
+  void compute_triangle_relations(const Triangle_mesh& mesh,
+                                  face_descriptor facet,
+                                  UVmap uvmap,
+                                  VertexIndexMap vimap,
+                                  VertexParameterizedMap vpmap,
+                                  const FreeVertexIndices& fvi,
+                                  Triangle_relations& relations) const
   {
     const PPM ppmap = get(vertex_point, mesh);
 
@@ -377,22 +417,22 @@ private:
     // Note  : 2*index     --> u
     //         2*index + 1 --> v
 
-    std::vector<double> vals;
-    std::vector<unsigned int> ids;
-    std::vector<double> fvals;
-    std::vector<double> pvals;
+    Triangle_relation* r = &relations[0];
+    r->nf = r->nl = 0;
 
     auto add_coefficient = [&](const vertex_descriptor v, const double a, const bool is_u)
     {
       if(get(vpmap, v)) {
         const Point_2& uv = get(uvmap, v);
-        fvals.push_back(a);
-        pvals.push_back(is_u ? uv.x() : uv.y());
+        r->fvals[r->nl] = a;
+        r->pvals[r->nl] = is_u ? uv.x() : uv.y();
+        ++(r->nl);
       } else {
         const int index = 2 * fvi[get(vimap, v)] + !is_u;
         CGAL_assertion(index >= 0);
-        vals.push_back(a);
-        ids.push_back(index);
+        r->vals[r->nf] = a;
+        r->ids[r->nf] = index;
+        ++(r->nf);
       }
     };
 
@@ -403,26 +443,10 @@ private:
       return add_coefficient(v, a, false /*is not u*/);
     };
 
-    auto accumulate = [&]()
+    auto next_relation = [&]()
     {
-      const std::size_t nf = vals.size();
-      const std::size_t nl = fvals.size();
-
-      for(std::size_t i=0; i<nf; ++i)
-        for(std::size_t j=0; j<nf; ++j)
-          A.add_coef(ids[i], ids[j], vals[i] * vals[j]);
-
-      double s = 0.;
-      for(std::size_t i=0; i<nl; ++i)
-        s += fvals[i] * pvals[i];
-
-      for(std::size_t i=0; i<nf; ++i)
-        B[ids[i]] -= vals[i] * s;
-
-      vals.clear();
-      ids.clear();
-      fvals.clear();
-      pvals.clear();
+      r = &relations[1];
+      r->nf = r->nl = 0;
     };
 
     // Real part
@@ -432,7 +456,7 @@ private:
     add_u_coefficient(v1, -c);
     add_v_coefficient(v1,  d);
     add_u_coefficient(v2,  a);
-    accumulate();
+    next_relation();
 
     // Imaginary part
     // Note: b = 0
@@ -441,9 +465,26 @@ private:
     add_u_coefficient(v1, -d);
     add_v_coefficient(v1, -c);
     add_v_coefficient(v2,  a);
-    accumulate();
+  }
 
-    return OK;
+  // Accumulate the lines of a triangle in the normal equations of the linear system.
+  void accumulate_triangle_relations(const Triangle_relations& relations,
+                                     Matrix& A,
+                                     Vector& B) const
+  {
+    for(const Triangle_relation& r : relations)
+    {
+      for(std::size_t i=0; i<r.nf; ++i)
+        for(std::size_t j=0; j<r.nf; ++j)
+          A.add_coef(r.ids[i], r.ids[j], r.vals[i] * r.vals[j]);
+
+      double s = 0.;
+      for(std::size_t i=0; i<r.nl; ++i)
+        s += r.fvals[i] * r.pvals[i];
+
+      for(std::size_t i=0; i<r.nf; ++i)
+        B[r.ids[i]] -= r.vals[i] * s;
+    }
   }
 };
 
@@ -18,7 +18,16 @@
 #include <CGAL/Surface_mesh_parameterization/Error_code.h>
 #include <CGAL/Surface_mesh_parameterization/Mean_value_coordinates_parameterizer_3.h>
 
+#include <CGAL/Polygon_mesh_processing/connected_components.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
 #include <boost/property_map/property_map.hpp>
+#include <boost/range/irange.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
 
 /// \file parameterize.h
 
@@ -109,6 +118,136 @@ Error_code parameterize(TriangleMesh& mesh,
   return parameterize(mesh, parameterizer, bhd, uvmap);
 }
 
+/// \cond SKIP_IN_MANUAL
+template <class TriangleMesh_, class BorderParameterizer_, class SolverTraits_>
+class Iterative_authalic_parameterizer_3;
+
+namespace internal {
+
+// Whether the parameterizer adds (dynamic) property maps to the mesh in `parameterize()`
+template <class Parameterizer>
+struct Adds_mesh_properties : public std::false_type { };
+
+template <class TriangleMesh_, class BorderParameterizer_, class SolverTraits_>
+struct Adds_mesh_properties<Iterative_authalic_parameterizer_3<TriangleMesh_, BorderParameterizer_, SolverTraits_> >
+  : public std::true_type { };
+
+} // namespace internal
+/// \endcond
+
+/// \ingroup  PkgSurfaceMeshParameterizationMainFunction
+///
+/// computes a mapping to the 2D space of each chart of a 3D triangle surface `mesh`,
+/// the charts being the connected components of `mesh` that contain the halfedges
+/// of `border_halfedges`.
+/// Each chart is parameterized by a new parameterizer, created by `make_parameterizer`,
+/// and the charts are optionally parameterized in parallel.
+/// The result is a pair `(u,v)` of parameter coordinates for each vertex of the charts.
+///
+/// \tparam ConcurrencyTag enables sequential versus parallel parameterization of the charts.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+///         The default is `Sequential_tag`. The charts are always parameterized sequentially
+///         by `Iterative_authalic_parameterizer_3`, which adds property maps to `mesh`.
+/// \tparam TriangleMesh must be a model of `FaceGraph`.
+/// \tparam ParameterizerGenerator must be a functor without argument, returning
+///         a model of `Parameterizer_3`. If `ConcurrencyTag` is `Parallel_tag`, the
+///         parameterizer must not add property maps to `mesh`, since this cannot be
+///         done concurrently.
+/// \tparam HalfedgeRange must be a model of `ConstRange` with
+///         `boost::graph_traits<TriangleMesh>::%halfedge_descriptor` as value type.
+/// \tparam VertexUVmap must be a model of `ReadWritePropertyMap` with
+///         `boost::graph_traits<TriangleMesh>::%vertex_descriptor` as key type and
+///         %Point_2 (type deduced from `TriangleMesh` using `Kernel_traits`)
+///         as value type. If `ConcurrencyTag` is `Parallel_tag`, it must be possible
+///         to write the values of different vertices concurrently
+///         (as, for example, with the property maps of `CGAL::Surface_mesh`).
+///
+/// \param mesh a triangulated surface.
+/// \param make_parameterizer the generator of parameterizers, called once per chart.
+///        Distinct parameterizers, rather than copies of the same one, are needed to
+///        parameterize the charts concurrently, since for example copies of
+///        `CGAL::Eigen_solver_traits` share the same \eigen solver.
+/// \param border_halfedges halfedge descriptors on the boundary of `mesh`,
+///        one per chart.
+/// \param uvmap an instantiation of the class `VertexUVmap`.
+///
+/// \returns `OK` if all the charts are successfully parameterized, and otherwise
+///          the error code of the first chart of `border_halfedges` that failed.
+///
+/// \pre `mesh` must be a triangular mesh.
+/// \pre The halfedges of `border_halfedges` are in pairwise distinct connected components.
+///
+template <class ConcurrencyTag = Sequential_tag,
+          class TriangleMesh, class ParameterizerGenerator, class HalfedgeRange, class VertexUVmap>
+Error_code parameterize_charts(TriangleMesh& mesh,
+                               const ParameterizerGenerator& make_parameterizer,
+                               const HalfedgeRange& border_halfedges,
+                               VertexUVmap uvmap)
+{
+  CGAL_precondition(is_valid_polygon_mesh(mesh));
+
+  typedef typename boost::graph_traits<TriangleMesh>::vertex_descriptor        vertex_descriptor;
+  typedef typename boost::graph_traits<TriangleMesh>::halfedge_descriptor      halfedge_descriptor;
+  typedef typename boost::graph_traits<TriangleMesh>::face_descriptor          face_descriptor;
+
+  typedef CGAL::dynamic_vertex_property_t<int>                                 Vertex_int_tag;
+  typedef typename boost::property_map<TriangleMesh, Vertex_int_tag>::type     Vertex_int_map;
+  Vertex_int_map vimap = get(Vertex_int_tag(), mesh);
+
+  // `char` rather than `bool`: maps of `bool` may pack the values of several vertices
+  // in the same word (as `CGAL::Surface_mesh` does), and the charts are written concurrently
+  typedef CGAL::dynamic_vertex_property_t<char>                                Vertex_char_tag;
+  typedef typename boost::property_map<TriangleMesh, Vertex_char_tag>::type    Vertex_char_map;
+  Vertex_char_map vpmap = get(Vertex_char_tag(), mesh);
+
+  const std::vector<halfedge_descriptor> bhds(std::begin(border_halfedges), std::end(border_halfedges));
+
+  // Fill the maps of all the vertices beforehand, so that they are only read and written
+  // (not extended) by the parameterizers. The indices are local to each chart.
+  for(vertex_descriptor v : vertices(mesh))
+  {
+    put(vimap, v, -1);
+    put(vpmap, v, char(false));
+  }
+
+  for(halfedge_descriptor bhd : bhds)
+  {
+    CGAL_precondition(bhd != boost::graph_traits<TriangleMesh>::null_halfedge() && is_border(bhd, mesh));
+    CGAL_precondition(get(vimap, target(bhd, mesh)) == -1);
+
+    std::vector<face_descriptor> cc_faces;
+    Polygon_mesh_processing::connected_component(face(opposite(bhd, mesh), mesh), mesh,
+                                                 std::back_inserter(cc_faces));
+
+    int index = 0;
+    for(face_descriptor f : cc_faces)
+      for(vertex_descriptor v : vertices_around_face(halfedge(f, mesh), mesh))
+        if(get(vimap, v) == -1)
+          put(vimap, v, index++);
+  }
+
+  // Parameterizers that add properties to the mesh cannot run concurrently on the same mesh
+  typedef typename std::decay<decltype(make_parameterizer())>::type           Parameterizer;
+  typedef typename std::conditional<internal::Adds_mesh_properties<Parameterizer>::value,
+                                    Sequential_tag, ConcurrencyTag>::type    Charts_concurrency_tag;
+
+  std::vector<Error_code> statuses(bhds.size(), OK);
+  CGAL::for_each<Charts_concurrency_tag>(
+    boost::irange<std::size_t>(0, bhds.size()),
+    [&](const std::size_t i) -> bool
+    {
+      auto parameterizer = make_parameterizer();
+      statuses[i] = parameterizer.parameterize(mesh, bhds[i], uvmap, vimap, vpmap);
+      return true;
+    });
+
+  for(Error_code status : statuses)
+    if(status != OK)
+      return status;
+
+  return OK;
+}
+
 } // namespace Surface_mesh_parameterization
 
 } // namespace CGAL
@@ -0,0 +1,178 @@
+#include <CGAL/Simple_cartesian.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Aff_transformation_3.h>
+
+#include <CGAL/Surface_mesh_parameterization/Error_code.h>
+#include <CGAL/surface_mesh_parameterization.h>
+
+#include <CGAL/Polygon_mesh_processing/measure.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+namespace SMP = CGAL::Surface_mesh_parameterization;
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+typedef CGAL::Simple_cartesian<double>                                Kernel;
+typedef Kernel::Point_2                                               Point_2;
+typedef Kernel::Point_3                                               Point_3;
+typedef CGAL::Surface_mesh<Point_3>                                   SMesh;
+
+typedef boost::graph_traits<SMesh>::vertex_descriptor                 vertex_descriptor;
+typedef boost::graph_traits<SMesh>::halfedge_descriptor               halfedge_descriptor;
+typedef boost::graph_traits<SMesh>::face_descriptor                   face_descriptor;
+typedef SMesh::Property_map<vertex_descriptor, Point_2>               UV_pmap;
+
+template <typename FaceRange>
+double uv_area(const SMesh& sm, const FaceRange& fr, const UV_pmap uvmap)
+{
+  double area = 0.;
+  for(face_descriptor fd : fr)
+  {
+    halfedge_descriptor hd = halfedge(fd, sm);
+    area += CGAL::area(get(uvmap, source(hd, sm)),
+                       get(uvmap, target(hd, sm)),
+                       get(uvmap, target(next(hd, sm), sm)));
+  }
+  return area;
+}
+
+template <typename Parameterizer>
+UV_pmap parameterize(SMesh& sm, const std::string& name)
+{
+  UV_pmap uvmap = sm.add_property_map<vertex_descriptor, Point_2>(name).first;
+  halfedge_descriptor bhd = PMP::longest_border(sm).first;
+
+  SMP::Error_code status = SMP::parameterize(sm, Parameterizer(), bhd, uvmap);
+  assert(status == SMP::OK);
+  CGAL_USE(status);
+
+  return uvmap;
+}
+
+// The parameterizations computed sequentially and in parallel are identical
+template <template <typename, typename, typename, typename> class Parameterizer>
+void test_parameterizer(SMesh& sm)
+{
+  typedef Parameterizer<SMesh, CGAL::Default, CGAL::Default, CGAL::Sequential_tag> Sequential_parameterizer;
+  typedef Parameterizer<SMesh, CGAL::Default, CGAL::Default, CGAL::Parallel_tag>   Parallel_parameterizer;
+
+  UV_pmap uv_seq = parameterize<Sequential_parameterizer>(sm, "v:uv_seq");
+  UV_pmap uv_par = parameterize<Parallel_parameterizer>(sm, "v:uv_par");
+
+  for(vertex_descriptor vd : vertices(sm))
+    assert(get(uv_seq, vd) == get(uv_par, vd));
+
+  sm.remove_property_map(uv_seq);
+  sm.remove_property_map(uv_par);
+}
+
+// Several charts parameterized at once, sequentially or in parallel
+template <typename ConcurrencyTag>
+UV_pmap parameterize_charts(SMesh& charts,
+                            const std::vector<halfedge_descriptor>& bhds,
+                            const std::string& name)
+{
+  typedef SMP::ARAP_parameterizer_3<SMesh>                              Parameterizer;
+
+  UV_pmap uvmap = charts.add_property_map<vertex_descriptor, Point_2>(name).first;
+  SMP::Error_code status = SMP::parameterize_charts<ConcurrencyTag>(charts,
+                                                                    [](){ return Parameterizer(); },
+                                                                    bhds, uvmap);
+  assert(status == SMP::OK);
+  CGAL_USE(status);
+
+  return uvmap;
+}
+
+void test_charts(const SMesh& sm)
+{
+  typedef SMP::ARAP_parameterizer_3<SMesh>                              Parameterizer;
+
+  const std::size_t nf = num_faces(sm);
+  const int nb_charts = 4;
+
+  SMesh charts;
+  for(int i=0; i<nb_charts; ++i)
+  {
+    SMesh chart = sm;
+    const CGAL::Aff_transformation_3<Kernel> translation(CGAL::TRANSLATION, Kernel::Vector_3(10 * i, 0, 0));
+    for(vertex_descriptor vd : vertices(chart))
+      chart.point(vd) = translation(chart.point(vd));
+    charts.join(chart);
+  }
+
+  std::vector<halfedge_descriptor> bhds;
+  for(int i=0; i<nb_charts; ++i)
+  {
+    halfedge_descriptor bhd = PMP::longest_border(sm).first;
+    bhds.push_back(halfedge_descriptor(static_cast<SMesh::size_type>(bhd + i * num_halfedges(sm))));
+  }
+
+  UV_pmap uvmap = parameterize_charts<CGAL::Sequential_tag>(charts, bhds, "v:uv");
+
+#ifdef CGAL_LINKED_WITH_TBB
+  UV_pmap uvmap_par = parameterize_charts<CGAL::Parallel_tag>(charts, bhds, "v:uv_par");
+  for(vertex_descriptor vd : vertices(charts))
+    assert(get(uvmap, vd) == get(uvmap_par, vd));
+
+  // The iterative authalic parameterizer adds property maps to the mesh:
+  // its charts are parameterized sequentially, even with Parallel_tag
+  typedef SMP::Iterative_authalic_parameterizer_3<SMesh>                Iterative_parameterizer;
+  UV_pmap uvmap_it = charts.add_property_map<vertex_descriptor, Point_2>("v:uv_it").first;
+  UV_pmap uvmap_it_par = charts.add_property_map<vertex_descriptor, Point_2>("v:uv_it_par").first;
+  SMP::Error_code status = SMP::parameterize_charts<CGAL::Sequential_tag>(
+                             charts, [](){ return Iterative_parameterizer(); }, bhds, uvmap_it);
+  assert(status == SMP::OK);
+  status = SMP::parameterize_charts<CGAL::Parallel_tag>(
+             charts, [](){ return Iterative_parameterizer(); }, bhds, uvmap_it_par);
+  assert(status == SMP::OK);
+  CGAL_USE(status);
+  for(vertex_descriptor vd : vertices(charts))
+    assert(get(uvmap_it, vd) == get(uvmap_it_par, vd));
+#endif
+
+  // Each chart has about the same parameterization as the mesh on its own
+  // (the pinned vertex, and thus the result of the iterative minimization, depend on the indices)
+  SMesh single = sm;
+  UV_pmap single_uvmap = parameterize<Parameterizer>(single, "v:uv");
+  const double single_area = uv_area(single, faces(single), single_uvmap);
+
+  for(int i=0; i<nb_charts; ++i)
+  {
+    std::vector<face_descriptor> chart_faces;
+    for(std::size_t j=0; j<nf; ++j)
+      chart_faces.push_back(face_descriptor(static_cast<SMesh::size_type>(j + i * nf)));
+
+    const double area = uv_area(charts, chart_faces, uvmap);
+    std::cout << "Area of chart #" << i << ": " << area << " (expected " << single_area << ")" << std::endl;
+    assert(CGAL::abs(area - single_area) < 1e-2 * single_area);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  std::cout.precision(17);
+
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/three_peaks.off");
+  std::ifstream in(filename);
+  SMesh sm;
+  in >> sm;
+  if(!in || num_vertices(sm) == 0) {
+    std::cerr << "Problem loading the input data" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  test_charts(sm);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  test_parameterizer<SMP::ARAP_parameterizer_3>(sm);
+  test_parameterizer<SMP::LSCM_parameterizer_3>(sm);
+#endif
+
+  std::cout << "Done!" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -22,10 +22,14 @@
 #include <CGAL/Surface_mesh_segmentation/internal/AABB_traits.h>
 #include <CGAL/Surface_mesh_segmentation/internal/Disk_samplers.h>
 #include <CGAL/constructions/kernel_ftC3.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 #include <boost/tuple/tuple.hpp>
+#include <boost/range/irange.hpp>
 #include <optional>
 
 #define CGAL_NUMBER_OF_MAD 1.5
@@ -180,6 +184,9 @@ public:
 
   /**
    * Calculates SDF values for each facet in a range, and stores them in @a sdf_values. Note that sdf values are neither smoothed nor normalized.
+   * The disk samples are computed once and shared by all facets. If @a ConcurrencyTag is `Parallel_tag`, the rays of
+   * the facets are cast concurrently, and the values are written to @a sdf_values once all facets are processed.
+   * @tparam ConcurrencyTag `Sequential_tag` or `Parallel_tag`
    * @tparam FacetValueMap `WritablePropertyMap` with `boost::graph_traits<Polyhedron>::face_handle` as key and `double` as value type
    * @tparam InputIterator Iterator over polyhedrons. Its value type is `pointer to polyhedron`.
    * @param facet_begin range begin
@@ -188,7 +195,7 @@ public:
    * @param number_of_rays number of rays picked from cone for each facet
    * @param[out] sdf_values
    */
-  template <class FacetValueMap, class InputIterator, class DiskSampling>
+  template <class ConcurrencyTag = Sequential_tag, class FacetValueMap, class InputIterator, class DiskSampling>
   void calculate_sdf_values(
     InputIterator facet_begin,
     InputIterator facet_end,
@@ -199,6 +206,23 @@ public:
     Disk_samples_list disk_samples;
     disk_sampler(number_of_rays, std::back_inserter(disk_samples));
 
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      std::vector<face_handle> facets(facet_begin, facet_end);
+      std::vector<double> values(facets.size());
+      CGAL::for_each<ConcurrencyTag>(
+        boost::irange<std::size_t>(0, facets.size()),
+        [&](const std::size_t i) -> bool {
+          std::optional<double> sdf_value = calculate_sdf_value_of_facet(facets[i],
+                                              cone_angle, true, disk_samples);
+          values[i] = sdf_value ? *sdf_value : -1.0;
+          return true;
+        });
+      for(std::size_t i = 0; i < facets.size(); ++i) {
+        put(sdf_values, facets[i], values[i]);
+      }
+      return;
+    }
+
     for( ; facet_begin != facet_end; ++facet_begin) {
       std::optional<double> sdf_value = calculate_sdf_value_of_facet(*facet_begin,
                                           cone_angle, true, disk_samples);
@@ -214,15 +238,15 @@ public:
   /**
    * Overload for default sampling parameter
    */
-  template <class FacetValueMap, class InputIterator>
+  template <class ConcurrencyTag = Sequential_tag, class FacetValueMap, class InputIterator>
   void calculate_sdf_values(
     InputIterator facet_begin,
     InputIterator facet_end,
     double cone_angle,
     std::size_t number_of_rays,
     FacetValueMap sdf_values) const {
-    calculate_sdf_values(facet_begin, facet_end, cone_angle, number_of_rays,
-                         sdf_values, Default_sampler());
+    calculate_sdf_values<ConcurrencyTag>(facet_begin, facet_end, cone_angle, number_of_rays,
+                                         sdf_values, Default_sampler());
   }
 
   /**
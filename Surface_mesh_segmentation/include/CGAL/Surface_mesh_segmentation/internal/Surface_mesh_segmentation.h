@@ -28,12 +28,17 @@
 #include <CGAL/Kernel/global_functions_3.h>
 
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+
+#include <boost/range/irange.hpp>
 
 #include <cmath>
 #include <vector>
 #include <algorithm>
 #include <utility>
 #include <map>
+#include <type_traits>
 
 #define CGAL_NORMALIZATION_ALPHA 5.0
 #define CGAL_CONVEX_FACTOR 0.08
@@ -245,7 +250,7 @@ public:
   }
 
 // Use these two functions together
-  template <class SDFPropertyMap>
+  template <class ConcurrencyTag = Sequential_tag, class SDFPropertyMap>
   std::pair<double, double>
   calculate_sdf_values(double cone_angle, std::size_t number_of_rays,
                        SDFPropertyMap sdf_pmap, bool postprocess_req) {
@@ -254,8 +259,8 @@ public:
                                          false, /* build_kd_ree */
                                          true, /* use_diagonal --> set to false to use `AABB_tree::first_intersection()` */
                                          traits);
-    sdf_calculator.calculate_sdf_values(faces(mesh).first, faces(mesh).second,
-                                        cone_angle, number_of_rays, sdf_pmap);
+    sdf_calculator.template calculate_sdf_values<ConcurrencyTag>(faces(mesh).first, faces(mesh).second,
+                                                                 cone_angle, number_of_rays, sdf_pmap);
 
     Postprocess_sdf_values<Polyhedron> p;
     return postprocess_req ? p.template postprocess<Filter>(mesh,
@@ -263,7 +268,7 @@ public:
            p.min_max_value(mesh, sdf_pmap);
   }
 
-  template <class FacetSegmentMap, class SDFPropertyMap>
+  template <class ConcurrencyTag = Sequential_tag, class FacetSegmentMap, class SDFPropertyMap>
   std::size_t partition(std::size_t number_of_centers, double smoothing_lambda,
                         SDFPropertyMap sdf_pmap, FacetSegmentMap segment_pmap,
                         bool clusters_to_segments) {
@@ -293,8 +298,12 @@ public:
         edge_weights);
 
     // apply graph cut
-    CGAL::alpha_expansion_graphcut (edges, edge_weights, probability_matrix, labels,
-                                    AlphaExpansionImplementationTag());
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      graph_cut_of_components<ConcurrencyTag>(edges, edge_weights, probability_matrix, labels);
+    } else {
+      CGAL::alpha_expansion_graphcut (edges, edge_weights, probability_matrix, labels,
+                                      AlphaExpansionImplementationTag());
+    }
     std::vector<std::size_t>::iterator label_it = labels.begin();
     face_iterator facet_it, fend;
     for(boost::tie(facet_it,fend) = faces(mesh);
@@ -429,6 +438,95 @@ private:
     }
   }
 
+  /**
+   * Applies alpha-expansion graph-cut separately on each connected component of the facet graph.
+   * Components do not share any edge, so that they can be processed concurrently.
+   * Note that the stopping criterion of alpha-expansion is then evaluated per component,
+   * thus labels might differ slightly from the ones of a single graph-cut over all facets.
+   * @param edges list of pair of neighbor facet ids
+   * @param edge_weights weight for each edge in @a edges
+   * @param probability_matrix log-normalized probability matrix in [center][facet] order
+   * @param[in, out] labels cluster-id of each facet
+   */
+  template<class ConcurrencyTag>
+  void graph_cut_of_components(const std::vector<std::pair<std::size_t, std::size_t> >& edges,
+                               const std::vector<double>& edge_weights,
+                               const std::vector<std::vector<double> >& probability_matrix,
+                               std::vector<std::size_t>& labels) const {
+    // union-find over facets
+    std::vector<std::size_t> parents(labels.size());
+    for(std::size_t i = 0; i < parents.size(); ++i) {
+      parents[i] = i;
+    }
+    auto find_root = [&parents](std::size_t i) {
+      while(parents[i] != i) {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+      }
+      return i;
+    };
+    for(const std::pair<std::size_t, std::size_t>& edge : edges) {
+      parents[find_root(edge.first)] = find_root(edge.second);
+    }
+
+    // facets of each component, and their index in it
+    std::vector<std::size_t> component_of_root(labels.size(), (std::numeric_limits<std::size_t>::max)());
+    std::vector<std::vector<std::size_t> > component_facets;
+    std::vector<std::size_t> local_index(labels.size());
+    for(std::size_t i = 0; i < labels.size(); ++i) {
+      std::size_t& component = component_of_root[find_root(i)];
+      if(component == (std::numeric_limits<std::size_t>::max)()) {
+        component = component_facets.size();
+        component_facets.push_back(std::vector<std::size_t>());
+      }
+      local_index[i] = component_facets[component].size();
+      component_facets[component].push_back(i);
+    }
+
+    if(component_facets.size() < 2) {
+      CGAL::alpha_expansion_graphcut (edges, edge_weights, probability_matrix, labels,
+                                      AlphaExpansionImplementationTag());
+      return;
+    }
+
+    std::vector<std::vector<std::pair<std::size_t, std::size_t> > > component_edges(component_facets.size());
+    std::vector<std::vector<double> > component_edge_weights(component_facets.size());
+    for(std::size_t e = 0; e < edges.size(); ++e) {
+      const std::size_t component = component_of_root[find_root(edges[e].first)];
+      component_edges[component].push_back(std::make_pair(local_index[edges[e].first],
+                                                          local_index[edges[e].second]));
+      component_edge_weights[component].push_back(edge_weights[e]);
+    }
+
+    CGAL::for_each<ConcurrencyTag>(
+      boost::irange<std::size_t>(0, component_facets.size()),
+      [&](const std::size_t component) -> bool {
+        const std::vector<std::size_t>& facets = component_facets[component];
+        std::vector<std::vector<double> > component_probabilities(probability_matrix.size());
+        std::vector<std::size_t> component_labels;
+        component_labels.reserve(facets.size());
+        for(std::size_t center = 0; center < probability_matrix.size(); ++center) {
+          component_probabilities[center].reserve(facets.size());
+          for(std::size_t facet : facets) {
+            component_probabilities[center].push_back(probability_matrix[center][facet]);
+          }
+        }
+        for(std::size_t facet : facets) {
+          component_labels.push_back(labels[facet]);
+        }
+
+        CGAL::alpha_expansion_graphcut (component_edges[component], component_edge_weights[component],
+                                        component_probabilities, component_labels,
+                                        AlphaExpansionImplementationTag());
+
+        // each facet belongs to a single component
+        for(std::size_t i = 0; i < facets.size(); ++i) {
+          labels[facets[i]] = component_labels[i];
+        }
+        return true;
+      });
+  }
+
   template<class Pair>
   struct Sort_pairs_with_second {
     bool operator() (const Pair& pair_1, const Pair& pair_2) const {
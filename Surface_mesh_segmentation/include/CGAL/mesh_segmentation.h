@@ -24,6 +24,9 @@
 #include <CGAL/boost/graph/helpers.h>
 #include <boost/config.hpp>
 #include <CGAL/Kernel/global_functions_3.h>
+#include <CGAL/tags.h>
+
+#include <type_traits>
 
 namespace CGAL
 {
@@ -298,6 +301,135 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
           smoothing_lambda, output_cluster_ids, ppmap, traits);
 }
 
+/// \cond SKIP_IN_MANUAL
+namespace internal {
+
+template <class ConcurrencyTag, class Result>
+using enable_if_concurrency_tag_t =
+  std::enable_if_t<std::is_same<ConcurrencyTag, Sequential_tag>::value ||
+                   std::is_same<ConcurrencyTag, Parallel_tag>::value, Result>;
+
+} // namespace internal
+/// \endcond
+
+/*!
+ * \ingroup PkgSurfaceMeshSegmentationRef
+ * @brief Function computing the Shape Diameter Function over a surface mesh, possibly in parallel.
+ *
+ * This function is equivalent to `CGAL::sdf_values()`. If `ConcurrencyTag` is `Parallel_tag`,
+ * the rays of different facets are cast concurrently in the same AABB tree.
+ * An overload is provided with `get(boost::vertex_point,triangle_mesh)` as default point property map.
+ *
+ * @pre `is_triangle_mesh(triangle_mesh)`
+ *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ *
+ * The other template parameters and the parameters are the ones of `CGAL::sdf_values()`.
+ */
+template <class ConcurrencyTag, class TriangleMesh, class SDFPropertyMap, class PointPropertyMap, class GeomTraits>
+#ifdef DOXYGEN_RUNNING
+std::pair<double, double>
+#else
+internal::enable_if_concurrency_tag_t<ConcurrencyTag, std::pair<double, double> >
+#endif
+sdf_values( const TriangleMesh& triangle_mesh,
+            SDFPropertyMap sdf_values_map,
+            double cone_angle,
+            std::size_t number_of_rays,
+            bool postprocess,
+            PointPropertyMap ppmap,
+            GeomTraits traits)
+{
+  internal::Surface_mesh_segmentation<TriangleMesh, GeomTraits, PointPropertyMap>
+    algorithm(triangle_mesh, traits, ppmap);
+  return algorithm.template calculate_sdf_values<ConcurrencyTag>(cone_angle, number_of_rays,
+                                                                 sdf_values_map, postprocess);
+}
+
+/*!
+ * \ingroup PkgSurfaceMeshSegmentationRef
+ * @brief Function computing the segmentation of a surface mesh given an SDF value per facet, possibly in parallel.
+ *
+ * This function is equivalent to `CGAL::segmentation_from_sdf_values()`. If `ConcurrencyTag` is `Parallel_tag`,
+ * the graph-cut is applied concurrently on each connected component of the mesh.
+ * The stopping criterion of the graph-cut is then evaluated per connected component,
+ * so that the result may slightly differ from the sequential version for meshes with several connected components.
+ * An overload is provided with `get(boost::vertex_point,triangle_mesh)` as default point property map.
+ *
+ * @pre `is_triangle_mesh(triangle_mesh)`
+ * @pre `number_of_clusters > 0`
+ *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ *
+ * The other template parameters and the parameters are the ones of `CGAL::segmentation_from_sdf_values()`.
+ */
+template <class ConcurrencyTag, class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap,
+          class PointPropertyMap, class GeomTraits>
+#ifdef DOXYGEN_RUNNING
+std::size_t
+#else
+internal::enable_if_concurrency_tag_t<ConcurrencyTag, std::size_t>
+#endif
+segmentation_from_sdf_values( const TriangleMesh& triangle_mesh,
+                              SDFPropertyMap sdf_values_map,
+                              SegmentPropertyMap segment_ids,
+                              std::size_t number_of_clusters,
+                              double smoothing_lambda,
+                              bool output_cluster_ids,
+                              PointPropertyMap ppmap,
+                              GeomTraits traits)
+{
+  internal::Surface_mesh_segmentation<TriangleMesh, GeomTraits, PointPropertyMap> algorithm(triangle_mesh, traits, ppmap);
+  return algorithm.template partition<ConcurrencyTag>(number_of_clusters, smoothing_lambda, sdf_values_map,
+                                                      segment_ids, !output_cluster_ids);
+}
+
+/*!
+ * \ingroup PkgSurfaceMeshSegmentationRef
+ * @brief Function computing the segmentation of a surface mesh, possibly in parallel.
+ *
+ * This function is equivalent to calling the functions `CGAL::sdf_values()` and
+ * `CGAL::segmentation_from_sdf_values()` with the same `ConcurrencyTag` and the same parameters.
+ * An overload is provided with `get(boost::vertex_point,triangle_mesh)` as default point property map.
+ *
+ * @pre `is_triangle_mesh(triangle_mesh)`
+ * @pre `number_of_clusters > 0`
+ *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ *
+ * The other template parameters and the parameters are the ones of `CGAL::segmentation_via_sdf_values()`.
+ */
+template <class ConcurrencyTag, class TriangleMesh, class SegmentPropertyMap, class PointPropertyMap, class GeomTraits>
+#ifdef DOXYGEN_RUNNING
+std::size_t
+#else
+internal::enable_if_concurrency_tag_t<ConcurrencyTag, std::size_t>
+#endif
+segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
+                            SegmentPropertyMap segment_ids,
+                            double cone_angle,
+                            std::size_t number_of_rays,
+                            std::size_t number_of_clusters,
+                            double smoothing_lambda,
+                            bool output_cluster_ids,
+                            PointPropertyMap ppmap,
+                            GeomTraits traits)
+{
+  typedef typename boost::graph_traits<TriangleMesh>::face_descriptor face_descriptor;
+  typedef std::map<face_descriptor, double>
+  Facet_double_map;
+  Facet_double_map internal_sdf_map;
+  boost::associative_property_map<Facet_double_map> sdf_property_map(
+    internal_sdf_map);
+
+  sdf_values<ConcurrencyTag>(triangle_mesh, sdf_property_map, cone_angle, number_of_rays, true, ppmap, traits);
+  return segmentation_from_sdf_values<ConcurrencyTag>(triangle_mesh, sdf_property_map, segment_ids, number_of_clusters,
+                                                      smoothing_lambda, output_cluster_ids, ppmap, traits);
+}
+
 #ifndef DOXYGEN_RUNNING
 // we need these overloads for the default of the point property map
 
@@ -484,6 +616,62 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
          (triangle_mesh, segment_ids, cone_angle, number_of_rays, number_of_clusters,
           smoothing_lambda, output_cluster_ids, ppmap, traits);
 }
+
+template <class ConcurrencyTag, class TriangleMesh, class SDFPropertyMap>
+internal::enable_if_concurrency_tag_t<ConcurrencyTag, std::pair<double, double> >
+sdf_values( const TriangleMesh& triangle_mesh,
+            SDFPropertyMap sdf_values_map,
+            double cone_angle = 2.0 / 3.0 * CGAL_PI,
+            std::size_t number_of_rays = 25,
+            bool postprocess = true)
+{
+  typedef typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type PointPropertyMap;
+  PointPropertyMap ppmap = get(boost::vertex_point, const_cast<TriangleMesh&>(triangle_mesh));
+  typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
+  typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
+  GeomTraits traits;
+  return sdf_values<ConcurrencyTag>(triangle_mesh, sdf_values_map, cone_angle, number_of_rays,
+                                    postprocess, ppmap, traits);
+}
+
+template <class ConcurrencyTag, class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap>
+internal::enable_if_concurrency_tag_t<ConcurrencyTag, std::size_t>
+segmentation_from_sdf_values(const TriangleMesh& triangle_mesh,
+                             SDFPropertyMap sdf_values_map,
+                             SegmentPropertyMap segment_ids,
+                             std::size_t number_of_clusters = 5,
+                             double smoothing_lambda = 0.26,
+                             bool output_cluster_ids = false)
+{
+  typedef typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type PointPropertyMap;
+  PointPropertyMap ppmap = get(boost::vertex_point, const_cast<TriangleMesh&>(triangle_mesh));
+  typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
+  typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
+  GeomTraits traits;
+  return segmentation_from_sdf_values<ConcurrencyTag>(triangle_mesh, sdf_values_map, segment_ids,
+                                                      number_of_clusters, smoothing_lambda,
+                                                      output_cluster_ids, ppmap, traits);
+}
+
+template <class ConcurrencyTag, class TriangleMesh, class SegmentPropertyMap>
+internal::enable_if_concurrency_tag_t<ConcurrencyTag, std::size_t>
+segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
+                            SegmentPropertyMap segment_ids,
+                            double cone_angle = 2.0 / 3.0 * CGAL_PI,
+                            std::size_t number_of_rays = 25,
+                            std::size_t number_of_clusters = 5,
+                            double smoothing_lambda = 0.26,
+                            bool output_cluster_ids = false)
+{
+  typedef typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type PointPropertyMap;
+  PointPropertyMap ppmap = get(boost::vertex_point, const_cast<TriangleMesh&>(triangle_mesh));
+  typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
+  typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
+  GeomTraits traits;
+  return segmentation_via_sdf_values<ConcurrencyTag>(triangle_mesh, segment_ids, cone_angle, number_of_rays,
+                                                     number_of_clusters, smoothing_lambda,
+                                                     output_cluster_ids, ppmap, traits);
+}
 #endif
 
 
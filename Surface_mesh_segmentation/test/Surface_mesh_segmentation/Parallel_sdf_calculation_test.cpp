@@ -0,0 +1,79 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Aff_transformation_3.h>
+
+#include <CGAL/mesh_segmentation.h>
+
+#include <iostream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef CGAL::Surface_mesh<Kernel::Point_3> Surface_mesh;
+typedef Surface_mesh::Face_index face_descriptor;
+typedef Surface_mesh::Vertex_index vertex_descriptor;
+
+#ifndef CGAL_LINKED_WITH_TBB
+int main()
+{
+  std::cout << "TBB is not installed. Test is not performed." << std::endl;
+  return 0;
+}
+#else
+
+int main(void)
+{
+  Surface_mesh mesh;
+  if( !CGAL::IO::read_polygon_mesh(CGAL::data_file_path("meshes/cactus.off"), mesh) ) { return 1; }
+
+  // SDF values do not depend on the concurrency tag
+  Surface_mesh::Property_map<face_descriptor, double> sdf_seq =
+    mesh.add_property_map<face_descriptor, double>("f:sdf_seq").first;
+  Surface_mesh::Property_map<face_descriptor, double> sdf_par =
+    mesh.add_property_map<face_descriptor, double>("f:sdf_par").first;
+
+  std::pair<double, double> min_max_seq = CGAL::sdf_values(mesh, sdf_seq);
+  std::pair<double, double> min_max_par = CGAL::sdf_values<CGAL::Parallel_tag>(mesh, sdf_par);
+  if(min_max_seq != min_max_par) { return 1; }
+  for(face_descriptor f : faces(mesh)) {
+    if(get(sdf_seq, f) != get(sdf_par, f)) { return 1; }
+  }
+
+  // neither does the segmentation of a connected mesh
+  Surface_mesh::Property_map<face_descriptor, std::size_t> segments_seq =
+    mesh.add_property_map<face_descriptor, std::size_t>("f:segment_seq").first;
+  Surface_mesh::Property_map<face_descriptor, std::size_t> segments_par =
+    mesh.add_property_map<face_descriptor, std::size_t>("f:segment_par").first;
+  std::size_t nb_segments_seq = CGAL::segmentation_from_sdf_values(mesh, sdf_seq, segments_seq);
+  std::size_t nb_segments_par = CGAL::segmentation_from_sdf_values<CGAL::Parallel_tag>(mesh, sdf_par, segments_par);
+  std::cout << "Number of segments: " << nb_segments_seq << std::endl;
+  if(nb_segments_seq != nb_segments_par) { return 1; }
+  for(face_descriptor f : faces(mesh)) {
+    if(get(segments_seq, f) != get(segments_par, f)) { return 1; }
+  }
+
+  // two translated copies of the mesh: the graph-cut is applied per connected component,
+  // and gives the same clusters on both copies
+  Surface_mesh copy;
+  CGAL::copy_face_graph(mesh, copy);
+  const std::size_t nb_faces = num_faces(mesh);
+  const CGAL::Aff_transformation_3<Kernel> translation(CGAL::TRANSLATION, Kernel::Vector_3(100, 0, 0));
+  for(vertex_descriptor v : vertices(copy)) {
+    copy.point(v) = translation(copy.point(v));
+  }
+  Surface_mesh two_copies = mesh;
+  two_copies.join(copy);
+
+  Surface_mesh::Property_map<face_descriptor, std::size_t> clusters =
+    two_copies.add_property_map<face_descriptor, std::size_t>("f:cluster").first;
+  std::size_t nb_clusters = CGAL::segmentation_via_sdf_values<CGAL::Parallel_tag>(two_copies, clusters,
+                                                                                  2.0 / 3.0 * CGAL_PI, 25, 5, 0.26, true);
+  if(nb_clusters != 5) { return 1; }
+  for(std::size_t i = 0; i < nb_faces; ++i) {
+    face_descriptor f1(static_cast<Surface_mesh::size_type>(i));
+    face_descriptor f2(static_cast<Surface_mesh::size_type>(i + nb_faces));
+    if(get(clusters, f1) >= nb_clusters || get(clusters, f1) != get(clusters, f2)) { return 1; }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+#endif
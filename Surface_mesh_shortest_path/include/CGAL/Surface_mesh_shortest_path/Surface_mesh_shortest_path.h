@@ -25,8 +25,11 @@
 #include <CGAL/Default.h>
 #include <CGAL/enum.h>
 #include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
 
 #include <boost/lexical_cast.hpp>
+#include <boost/range/irange.hpp>
 #include <boost/variant/get.hpp>
 
 #include <algorithm>
@@ -1897,9 +1900,10 @@ private:
     {
       Cone_tree_node* current = currentFaceList[i];
 
+      // face lists are sorted by distance from the source to the root of the cones
       if (closest != nullptr && current->distance_from_source_to_root() >= closestDistance)
       {
-        continue;
+        break;
       }
 
       const Point_2 locationInContext = face_location_with_normalized_coordinates(current, location);
@@ -2000,6 +2004,36 @@ private:
     }
   }
 
+  Shortest_path_result distance_to_source_points(const vertex_descriptor v) const
+  {
+    const Node_distance_pair& result = m_closestToVertices[get(m_vertexIndexMap, v)];
+    const Cone_tree_node* current = result.first;
+
+    if (current)
+    {
+      return std::make_pair(result.second, m_rootNodes[current->tree_id()].second);
+    }
+    else
+    {
+      return std::make_pair(FT(-1), source_points_end());
+    }
+  }
+
+  Shortest_path_result distance_to_source_points(const Face_location& location) const
+  {
+    const std::pair<Node_distance_pair, Barycentric_coordinates>& result = nearest_to_location(location.first, location.second);
+    const Cone_tree_node* current = result.first.first;
+
+    if (current)
+    {
+      return std::make_pair(result.first.second, m_rootNodes[current->tree_id()].second);
+    }
+    else
+    {
+      return std::make_pair(FT(-1), source_points_end());
+    }
+  }
+
   static bool cone_comparator(const Cone_tree_node* lhs, const Cone_tree_node* rhs)
   {
     return lhs->distance_from_source_to_root() < rhs->distance_from_source_to_root();
@@ -2043,6 +2077,7 @@ private:
     return firstAdded;
   }
 
+  template <class Concurrency_tag>
   void construct_sequence_tree_internal()
   {
     reset_algorithm(false);
@@ -2214,11 +2249,14 @@ private:
       add_to_face_list(m_rootNodes[i].first);
     }
 
-    for (std::size_t i = 0; i < m_faceOccupiers.size(); ++i)
-    {
-      std::vector<Cone_tree_node*>& currentFaceList = m_faceOccupiers[i];
-      std::sort(currentFaceList.begin(), currentFaceList.end(), cone_comparator);
-    }
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, m_faceOccupiers.size()),
+      [&](const std::size_t i) -> bool
+      {
+        std::vector<Cone_tree_node*>& currentFaceList = m_faceOccupiers[i];
+        std::sort(currentFaceList.begin(), currentFaceList.end(), cone_comparator);
+        return true;
+      });
 
     if (m_debugOutput)
     {
@@ -2456,12 +2494,18 @@ public:
   \details A call to this method will only trigger a computation only if some
   change to the set of source points occurred since the last time
   the sequence tree was computed.
+
+  \tparam ConcurrencyTag enables sequential versus parallel sorting of the cones
+    crossing each face, once the sequence tree is expanded. Possible values are
+    `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    The default is `Sequential_tag`.
   */
+  template <class ConcurrencyTag = Sequential_tag>
   void build_sequence_tree()
   {
     if (changed_since_last_build())
     {
-      construct_sequence_tree_internal();
+      construct_sequence_tree_internal<ConcurrencyTag>();
     }
   }
 
@@ -2545,17 +2589,7 @@ public:
   {
     build_sequence_tree();
 
-    const Node_distance_pair& result = m_closestToVertices[get(m_vertexIndexMap, v)];
-    const Cone_tree_node* current = result.first;
-
-    if (current)
-    {
-      return std::make_pair(result.second, m_rootNodes[current->tree_id()].second);
-    }
-    else
-    {
-      return std::make_pair(FT(-1), source_points_end());
-    }
+    return distance_to_source_points(v);
   }
 
   /*!
@@ -2573,17 +2607,44 @@ public:
   {
     build_sequence_tree();
 
-    const std::pair<Node_distance_pair, Barycentric_coordinates>& result = nearest_to_location(f, location);
-    const Cone_tree_node* current = result.first.first;
+    return distance_to_source_points(Face_location(f, location));
+  }
 
-    if (current)
-    {
-      return std::make_pair(result.first.second, m_rootNodes[current->tree_id()].second);
-    }
-    else
-    {
-      return std::make_pair(FT(-1), source_points_end());
-    }
+  /*!
+  \brief Computes the shortest surface distances from several vertices or surface locations to any source point
+
+  \details The sequence tree is built first if needed. The queries do not modify it,
+  so that they are evaluated concurrently if `ConcurrencyTag` is `Parallel_tag`.
+
+  \tparam ConcurrencyTag enables sequential versus parallel queries. Possible values are
+    `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    The default is `Sequential_tag`.
+  \tparam InputRange a model of `ConstRange` with value type either `vertex_descriptor` or `Face_location`
+  \tparam OutputIterator a model of `OutputIterator` accepting `Shortest_path_result`
+
+  \param queries the query vertices or surface locations
+  \param output the output iterator, to which the result of each query is written,
+    in the same order as `queries` and as returned by `shortest_distance_to_source_points()`
+  \return the output iterator past the last written result
+  */
+  template <class ConcurrencyTag = Sequential_tag, class InputRange, class OutputIterator>
+  OutputIterator shortest_distances_to_source_points(const InputRange& queries, OutputIterator output)
+  {
+    build_sequence_tree<ConcurrencyTag>();
+
+    typedef typename std::iterator_traits<typename InputRange::const_iterator>::value_type Query;
+    const std::vector<Query> query_vector(std::begin(queries), std::end(queries));
+    std::vector<Shortest_path_result> results(query_vector.size());
+
+    CGAL::for_each<ConcurrencyTag>(
+      boost::irange<std::size_t>(0, query_vector.size()),
+      [&](const std::size_t i) -> bool
+      {
+        results[i] = distance_to_source_points(query_vector[i]);
+        return true;
+      });
+
+    return std::copy(results.begin(), results.end(), output);
   }
 
   /// @}
@@ -0,0 +1,93 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh_shortest_path.h>
+#include <CGAL/Random.h>
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <stdlib.h>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+
+typedef CGAL::Surface_mesh<Kernel::Point_3> Triangle_mesh;
+
+typedef CGAL::Surface_mesh_shortest_path_traits<Kernel, Triangle_mesh> Traits;
+typedef CGAL::Surface_mesh_shortest_path<Traits> Surface_mesh_shortest_path;
+typedef Surface_mesh_shortest_path::Face_location Face_location;
+typedef Surface_mesh_shortest_path::Shortest_path_result Shortest_path_result;
+
+typedef boost::graph_traits<Triangle_mesh>::vertex_descriptor vertex_descriptor;
+typedef boost::graph_traits<Triangle_mesh>::face_descriptor face_descriptor;
+
+// compares the results of the batched queries with the results of the single queries
+template <typename ConcurrencyTag>
+void test(const Triangle_mesh& mesh, CGAL::Random& rand)
+{
+  std::vector<face_descriptor> faces_vector(faces(mesh).begin(), faces(mesh).end());
+
+  Surface_mesh_shortest_path shortest_paths(mesh);
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const face_descriptor f = faces_vector[rand.get_int(0, static_cast<int>(faces_vector.size()))];
+    shortest_paths.add_source_point(f, CGAL::make_array(0.2, 0.3, 0.5));
+  }
+
+  std::vector<vertex_descriptor> vertex_queries(vertices(mesh).begin(), vertices(mesh).end());
+  std::vector<Shortest_path_result> vertex_results;
+  shortest_paths.shortest_distances_to_source_points<ConcurrencyTag>(vertex_queries, std::back_inserter(vertex_results));
+  assert(vertex_results.size() == vertex_queries.size());
+
+  for (std::size_t i = 0; i < vertex_queries.size(); ++i)
+  {
+    const Shortest_path_result expected = shortest_paths.shortest_distance_to_source_points(vertex_queries[i]);
+    assert(vertex_results[i].first == expected.first);
+    assert(vertex_results[i].second == expected.second);
+    assert(vertex_results[i].first >= 0.);
+  }
+
+  std::vector<Face_location> location_queries;
+  for (std::size_t i = 0; i < 1000; ++i)
+  {
+    const face_descriptor f = faces_vector[rand.get_int(0, static_cast<int>(faces_vector.size()))];
+    const double a = rand.get_double(0., 1.);
+    const double b = rand.get_double(0., 1. - a);
+    location_queries.push_back(Face_location(f, CGAL::make_array(a, b, 1. - a - b)));
+  }
+
+  std::vector<Shortest_path_result> location_results;
+  shortest_paths.shortest_distances_to_source_points<ConcurrencyTag>(location_queries, std::back_inserter(location_results));
+  assert(location_results.size() == location_queries.size());
+
+  for (std::size_t i = 0; i < location_queries.size(); ++i)
+  {
+    const Shortest_path_result expected = shortest_paths.shortest_distance_to_source_points(location_queries[i].first,
+                                                                                            location_queries[i].second);
+    assert(location_results[i].first == expected.first);
+    assert(location_results[i].second == expected.second);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  Triangle_mesh mesh;
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  std::ifstream input(filename);
+  input >> mesh;
+  input.close();
+
+  std::cout << "Input mesh: " << num_vertices(mesh) << " nv" << std::endl;
+
+  CGAL::Random rand(8603036);
+
+  test<CGAL::Sequential_tag>(mesh, rand);
+#ifdef CGAL_LINKED_WITH_TBB
+  test<CGAL::Parallel_tag>(mesh, rand);
+#endif
+
+  std::cout << "Done!" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -18,6 +18,8 @@
 #include <CGAL/IO/trace.h>
 #include <CGAL/Timer.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/HalfedgeDS_default.h>
 #include <CGAL/HalfedgeDS_vertex_max_base_with_id.h>
@@ -32,6 +34,7 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/copy.hpp>
 #include <boost/property_map/property_map.hpp>
+#include <boost/range/irange.hpp>
 
 #include <CGAL/boost/iterator/transform_iterator.hpp>
 
@@ -157,6 +160,13 @@ struct Skel_polyhedron_items_3 {
 ///      >
 /// \endcode
 ///
+/// @tparam ConcurrencyTag
+///         enables sequential versus parallel computation of the Voronoi poles,
+///         of the cotangent weights and of the right-hand sides of the linear systems,
+///         and of the geometric tests of the local remeshing.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.<br>
+///         <b>%Default:</b> `Sequential_tag`
+///
 /// @cond CGAL_DOCUMENT_INTERNAL
 /// @tparam Degeneracy_algorithm_tag
 ///         tag for selecting the degeneracy detection algorithm
@@ -164,7 +174,8 @@ struct Skel_polyhedron_items_3 {
 template <class TriangleMesh,
           class Traits_ = Default,
           class VertexPointMap_ = Default,
-          class SolverTraits_ = Default>
+          class SolverTraits_ = Default,
+          class ConcurrencyTag = Sequential_tag>
 class Mean_curvature_flow_skeletonization
 {
 // Public types
@@ -199,6 +210,9 @@ public:
   >::type SolverTraits;
   #endif
 
+  /// The concurrency tag
+  typedef ConcurrencyTag                                                       Concurrency_tag;
+
   /// @cond CGAL_DOCUMENT_INTERNAL
   typedef typename Traits::Point_3                                             Point;
   typedef typename Traits::Vector_3                                             Vector;
@@ -251,7 +265,7 @@ public:
   typedef CGAL::Triangulation_vertex_base_with_info_3
                                             <vertex_descriptor, Exact_kernel>  Vb;
   typedef CGAL::Delaunay_triangulation_cell_base_3<Exact_kernel>               Cb;
-  typedef CGAL::Triangulation_data_structure_3<Vb, Cb>                         Tds;
+  typedef CGAL::Triangulation_data_structure_3<Vb, Cb, Concurrency_tag>        Tds;
   typedef CGAL::Delaunay_triangulation_3<Exact_kernel, Tds>                    Delaunay;
   typedef typename Delaunay::Point                                             Exact_point;
   typedef typename Delaunay::Cell_handle                                       Cell_handle;
@@ -308,8 +322,8 @@ private:
    *  greater than `m_max_id` are created during split,
    *  thus will not be considered in correspondence tracking. */
   int m_max_id;
-  /** Used when assembling the matrix. */
-  std::map<int, int> m_new_id;
+  /** Used when assembling the matrix: maps the id of a vertex to its row. */
+  std::vector<int> m_new_id;
 
   /** The incident angle for a halfedge. */
   std::vector<double> m_halfedge_angle;
@@ -648,6 +662,8 @@ public:
 
     update_vertex_id();
 
+    std::vector<vertex_descriptor> vds(vertices(m_tmesh).begin(), vertices(m_tmesh).end());
+
     compute_edge_weight();
 
   // AF: attention: num_vertices will not decrease for a Surface_mesh
@@ -665,14 +681,18 @@ public:
     {
       nrows = nver * 2;
     }
+    // the vertices attracted by their poles, shared by both sides of the system
+    std::vector<char> is_attracted;
+    compute_attracted_vertices(vds, is_attracted);
+
     // Assemble linear system At * A * X = At * B
     typename SolverTraits::Matrix A(nrows, nver);
-    assemble_LHS(A);
+    assemble_LHS(vds, is_attracted, A);
 
     typename SolverTraits::Vector X(nver), Bx(nrows);
     typename SolverTraits::Vector Y(nver), By(nrows);
     typename SolverTraits::Vector Z(nver), Bz(nrows);
-    assemble_RHS(Bx, By, Bz);
+    assemble_RHS(vds, is_attracted, Bx, By, Bz);
 
     MCFSKEL_DEBUG(std::cerr << "before solve\n";)
 
@@ -685,13 +705,14 @@ public:
     MCFSKEL_DEBUG(std::cerr << "after solve\n";)
 
     // copy to surface mesh
-    for(vertex_descriptor vd : vertices(m_tmesh))
+    CGAL::for_each<Concurrency_tag>(vds, [&](vertex_descriptor vd) -> bool
     {
       int id = static_cast<int>(get(m_vertex_id_pmap, vd));
       int i = m_new_id[id];
       Point p =  m_traits.construct_point_3_object()(X[i], Y[i], Z[i]);
       put(m_tmesh_point_pmap, vd, p);
-    }
+      return true;
+    });
 
     MCFSKEL_DEBUG(std::cerr << "leave contract geometry\n";)
   }
@@ -925,22 +946,48 @@ private:
   /// Compute cotangent weights of all edges.
   void compute_edge_weight()
   {
-    m_edge_weight.clear();
-    m_edge_weight.reserve(num_halfedges(m_tmesh));
-    for(halfedge_descriptor hd : halfedges(m_tmesh))
-      m_edge_weight.push_back(m_weight_calculator(hd));
+    std::vector<halfedge_descriptor> hds(halfedges(m_tmesh).begin(), halfedges(m_tmesh).end());
+    m_edge_weight.resize(hds.size());
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, hds.size()),
+      [&](const std::size_t k) -> bool
+      {
+        m_edge_weight[k] = m_weight_calculator(hds[k]);
+        return true;
+      });
+  }
+
+  /// Find the vertices that are attracted by their pole, that is the non-fixed
+  /// vertices of the original surface whose pole is inside the meso-skeleton.
+  void compute_attracted_vertices(const std::vector<vertex_descriptor>& vds,
+                                  std::vector<char>& is_attracted)
+  {
+    is_attracted.assign(vds.size(), false);
+    if (!m_is_medially_centered)
+      return;
+
+    // the AABB tree of the inside test is built on the first query, in a thread-safe way
+    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
+
+    CGAL::for_each<Concurrency_tag>(vds, [&](vertex_descriptor vd) -> bool
+    {
+      int id = static_cast<int>(get(m_vertex_id_pmap, vd));
+      if (!vd->is_fixed && id < m_max_id)
+        is_attracted[m_new_id[id]] = (test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE);
+      return true;
+    });
   }
 
   /// Assemble the left hand side.
-  void assemble_LHS(typename SolverTraits::Matrix& A)
+  void assemble_LHS(const std::vector<vertex_descriptor>& vds,
+                    const std::vector<char>& is_attracted,
+                    typename SolverTraits::Matrix& A)
   {
     MCFSKEL_DEBUG(std::cerr << "start LHS\n";)
 
-    std::size_t nver = num_vertices(m_tmesh);
-
-    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
+    std::size_t nver = vds.size();
 
-    for(vertex_descriptor vd : vertices(m_tmesh))
+    for(vertex_descriptor vd : vds)
     {
       int id = static_cast<int>(get(m_vertex_id_pmap, vd));
 
@@ -953,20 +1000,14 @@ private:
       else
       {
         A.set_coef(i + nver, i, m_omega_H, true);
-        if (m_is_medially_centered)
+        if (is_attracted[i])
         {
-          if (id < m_max_id)
-          {
-            if (test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE)
-            {
-              A.set_coef(i + nver * 2, i, m_omega_P, true);
-            }
-          }
+          A.set_coef(i + nver * 2, i, m_omega_P, true);
         }
       }
     }
 
-    for(vertex_descriptor vd : vertices(m_tmesh))
+    for(vertex_descriptor vd : vds)
     {
       int id = static_cast<int>(get(m_vertex_id_pmap, vd));
       int i = m_new_id[id];
@@ -993,16 +1034,16 @@ private:
   }
 
   /// Assemble the right hand side.
-  void assemble_RHS(typename SolverTraits::Vector& Bx,
+  void assemble_RHS(const std::vector<vertex_descriptor>& vds,
+                    const std::vector<char>& is_attracted,
+                    typename SolverTraits::Vector& Bx,
                     typename SolverTraits::Vector& By,
                     typename SolverTraits::Vector& Bz)
   {
     MCFSKEL_DEBUG(std::cerr << "start RHS\n";)
 
-    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
-
     // assemble right columns of linear system
-    int nver = static_cast<int>(num_vertices(m_tmesh));
+    int nver = static_cast<int>(vds.size());
     for (int i = 0; i < nver; ++i)
     {
       Bx[i] = 0;
@@ -1010,7 +1051,8 @@ private:
       Bz[i] = 0;
     }
 
-    for(vertex_descriptor vd : vertices(m_tmesh))
+    // each vertex only writes its own rows
+    CGAL::for_each<Concurrency_tag>(vds, [&](vertex_descriptor vd) -> bool
     {
       int id = static_cast<int>(get(m_vertex_id_pmap, vd));
       int i = m_new_id[id];
@@ -1023,15 +1065,9 @@ private:
       else
       {
         oh = m_omega_H;
-        if (m_is_medially_centered)
+        if (is_attracted[i])
         {
-          if (id < m_max_id)
-          {
-            if (test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE)
-            {
-              op = m_omega_P;
-            }
-          }
+          op = m_omega_P;
         }
       }
       Bx[i + nver] = get_x(get(m_tmesh_point_pmap, vd)) * oh;
@@ -1046,7 +1082,8 @@ private:
         By[i + nver * 2] = y * op;
         Bz[i + nver * 2] = z * op;
       }
-    }
+      return true;
+    });
 
     MCFSKEL_DEBUG(std::cerr << "end RHS\n";)
   }
@@ -1054,7 +1091,7 @@ private:
   /// The order of vertex id is the same as the traverse order.
   void update_vertex_id()
   {
-    m_new_id.clear();
+    m_new_id.assign(m_vertex_id_count, -1);
     int cnt = 0;
 
     for(vertex_descriptor vd : vertices(m_tmesh))
@@ -1111,13 +1148,16 @@ private:
     int ne = 2 * static_cast<int>(num_edges(m_tmesh));
     m_halfedge_angle.resize(ne, 0);
 
+    std::vector<halfedge_descriptor> hds;
+    hds.reserve(ne);
     int idx = 0;
     for(halfedge_descriptor hd : halfedges(m_tmesh))
     {
       put(m_hedge_id_pmap, hd, idx++);
+      hds.push_back(hd);
     }
 
-    for(halfedge_descriptor hd : halfedges(m_tmesh))
+    CGAL::for_each<Concurrency_tag>(hds, [&](halfedge_descriptor hd) -> bool
     {
       int e_id = static_cast<int>(get(m_hedge_id_pmap, hd));
 
@@ -1153,7 +1193,8 @@ private:
               acos((dis2_ik + dis2_jk - dis2_ij) / (2.0 * dis_ik * dis_jk));
         }
       }
-    }
+      return true;
+    });
   }
 
   void normalize(Vector& v)
@@ -1261,18 +1302,27 @@ private:
   /// its local neighborhood disk.
   std::size_t detect_degeneracies_in_disk()
   {
+    std::vector<vertex_descriptor> vds(vertices(m_tmesh).begin(), vertices(m_tmesh).end());
+
+    // the tests only read the meso-skeleton, so vertices are fixed once all of them are done
+    std::vector<char> willbefixed(vds.size(), false);
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, vds.size()),
+      [&](const std::size_t k) -> bool
+      {
+        if (!vds[k]->is_fixed)
+          willbefixed[k] = internal::is_vertex_degenerate(m_tmesh, m_tmesh_point_pmap,
+                                                          vds[k], m_min_edge_length, m_traits);
+        return true;
+      });
+
     std::size_t num_fixed = 0;
-    for(vertex_descriptor v : vertices(m_tmesh))
+    for(std::size_t k = 0; k < vds.size(); ++k)
     {
-      if (!v->is_fixed)
+      if (willbefixed[k])
       {
-        bool willbefixed = internal::is_vertex_degenerate(m_tmesh, m_tmesh_point_pmap,
-                                                          v, m_min_edge_length, m_traits);
-        if (willbefixed)
-        {
-          v->is_fixed=true;
-          ++num_fixed;
-        }
+        vds[k]->is_fixed=true;
+        ++num_fixed;
       }
     }
 
@@ -1285,6 +1335,31 @@ private:
   // Voronoi pole
   // --------------------------------------------------------------------------
 
+  /// Insert the points in the Delaunay triangulation.
+  template <class PointRange>
+  void insert_points(Delaunay& T, const PointRange& points, const Sequential_tag&)
+  {
+    T.insert(points.begin(), points.end());
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  template <class PointRange>
+  void insert_points(Delaunay& T, const PointRange& points, const Parallel_tag&)
+  {
+    vertex_iterator vb, ve;
+    boost::tie(vb, ve) = vertices(m_tmesh);
+    Vertex_to_point v_to_p(m_tmesh_point_pmap);
+    Bbox_3 bbox = CGAL::bbox_3(boost::make_transform_iterator(vb, v_to_p),
+                               boost::make_transform_iterator(ve, v_to_p));
+
+    // the lock data structure is only needed during the insertion
+    typename Delaunay::Lock_data_structure lock_ds(bbox, 50);
+    T.set_lock_data_structure(&lock_ds);
+    T.insert(points.begin(), points.end());
+    T.set_lock_data_structure(nullptr);
+  }
+#endif
+
   /// Compute the Voronoi pole for surface vertices. The pole is the furthest
   /// vertex in the Voronoi cell containing the given vertex.
   void compute_voronoi_pole()
@@ -1302,69 +1377,81 @@ private:
       points.push_back(std::make_pair(tp, v));
     }
 
-    Delaunay T(points.begin(), points.end());
+    Delaunay T;
+    insert_points(T, points, Concurrency_tag());
+
+    std::vector<Cell_handle> cells;
+    cells.reserve(T.number_of_finite_cells());
+    for (Finite_cells_iterator cit = T.finite_cells_begin(); cit != T.finite_cells_end(); ++cit)
+      cells.push_back(cit);
 
-    Finite_cells_iterator cit;
-    int cell_id = 0;
-    std::vector<Point> cell_dual;
-    cell_dual.reserve(T.number_of_cells());
-    for (cit = T.finite_cells_begin(); cit != T.finite_cells_end(); ++cit)
+    // each cell has 4 incident vertices
+    for (std::size_t cell_id = 0; cell_id < cells.size(); ++cell_id)
     {
-      Cell_handle cell = cit;
-      Exact_point point = T.dual(cell);
-      cell_dual.push_back(
-        m_traits.construct_point_3_object()(
-          to_double(point.x()),
-          to_double(point.y()),
-          to_double(point.z())
-        )
-      );
-      // each cell has 4 incident vertices
       for (int i = 0; i < 4; ++i)
       {
-        TriVertex_handle vt = cell->vertex(i);
+        TriVertex_handle vt = cells[cell_id]->vertex(i);
         std::size_t id = get(m_vertex_id_pmap, vt->info());
-        point_to_pole[id].push_back(cell_id);
+        point_to_pole[id].push_back(static_cast<int>(cell_id));
       }
-      ++cell_id;
     }
 
-    typedef std::pair<Exact_point, vertex_descriptor> Pair_type;
-    std::vector<Pair_type> duplicated_points;
-    for(const Pair_type& p : points)
-    {
-      std::size_t vid = get(m_vertex_id_pmap, p.second);
-      Point surface_point = get(m_tmesh_point_pmap, p.second);
-
-      double max_neg_t = 1;
-      int max_neg_i = -1;
+    std::vector<Point> cell_dual(cells.size());
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, cells.size()),
+      [&](const std::size_t cell_id) -> bool
+      {
+        Exact_point point = T.dual(cells[cell_id]);
+        cell_dual[cell_id] = m_traits.construct_point_3_object()(
+                               to_double(point.x()),
+                               to_double(point.y()),
+                               to_double(point.z()));
+        return true;
+      });
 
-      for (size_t j = 0; j < point_to_pole[vid].size(); ++j)
+    typedef std::pair<Exact_point, vertex_descriptor> Pair_type;
+    std::vector<char> is_duplicated(points.size(), false);
+    CGAL::for_each<Concurrency_tag>(
+      boost::irange<std::size_t>(0, points.size()),
+      [&](const std::size_t k) -> bool
       {
-        int pole_id = point_to_pole[vid][j];
-        Point cell_point = cell_dual[pole_id];
-        Vector vt = m_traits.construct_vector_3_object()(surface_point, cell_point);
-        Vector n = m_normals[vid];
+        const Pair_type& p = points[k];
+        std::size_t vid = get(m_vertex_id_pmap, p.second);
+        Point surface_point = get(m_tmesh_point_pmap, p.second);
 
-        double t = m_traits.compute_scalar_product_3_object()(vt, n);
+        double max_neg_t = 1;
+        int max_neg_i = -1;
 
-        // choose the one with maximum distance along the normal
-        if (t < 0 && t < max_neg_t)
+        for (size_t j = 0; j < point_to_pole[vid].size(); ++j)
         {
-          max_neg_i = pole_id;
-          max_neg_t = t;
+          int pole_id = point_to_pole[vid][j];
+          Point cell_point = cell_dual[pole_id];
+          Vector vt = m_traits.construct_vector_3_object()(surface_point, cell_point);
+          Vector n = m_normals[vid];
+
+          double t = m_traits.compute_scalar_product_3_object()(vt, n);
+
+          // choose the one with maximum distance along the normal
+          if (t < 0 && t < max_neg_t)
+          {
+            max_neg_i = pole_id;
+            max_neg_t = t;
+          }
         }
-      }
-      // max_neg_i is -1 only when duplicated the point is duplicated
-      // (null edge or non-manifold issue resolved with duplication)
-      if (max_neg_i!=-1)
-        p.second->pole = cell_dual[max_neg_i];
-      else
-        duplicated_points.push_back(p);
-    }
+        // max_neg_i is -1 only when duplicated the point is duplicated
+        // (null edge or non-manifold issue resolved with duplication)
+        if (max_neg_i!=-1)
+          p.second->pole = cell_dual[max_neg_i];
+        else
+          is_duplicated[k] = true;
+        return true;
+      });
 
-    for (const Pair_type& p : duplicated_points)
+    for (std::size_t k = 0; k < points.size(); ++k)
     {
+      if (!is_duplicated[k])
+        continue;
+      const Pair_type& p = points[k];
       typename Delaunay::Locate_type lt;
       int li, lj;
       typename Delaunay::Cell_handle cell = T.locate (p.first, lt, li, lj);
@@ -1380,21 +1467,36 @@ private:
   {
     namespace PMP = CGAL::Polygon_mesh_processing;
 
-    std::unordered_map<face_descriptor, Vector> normals;
-    boost::associative_property_map<
-      std::unordered_map<face_descriptor, Vector> > normals_pmap(normals);
-    PMP::compute_face_normals(m_tmesh, normals_pmap);
+    // the face normals are stored in a vector, so that they can be written and read concurrently
+    std::vector<face_descriptor> fds;
+    fds.reserve(num_faces(m_tmesh));
+    for(face_descriptor f : faces(m_tmesh))
+    {
+      f->id() = fds.size();
+      fds.push_back(f);
+    }
+
+    std::vector<Vector> normals(fds.size());
+    auto normals_pmap = boost::make_iterator_property_map(normals.begin(),
+                                                          get(boost::face_index, m_tmesh));
+    CGAL::for_each<Concurrency_tag>(fds, [&](face_descriptor f) -> bool
+    {
+      put(normals_pmap, f, PMP::compute_face_normal(f, m_tmesh, CGAL::parameters::geom_traits(m_traits)));
+      return true;
+    });
 
     m_normals.resize(num_vertices(m_tmesh));
 
-    for(vertex_descriptor v : vertices(m_tmesh))
+    std::vector<vertex_descriptor> vds(vertices(m_tmesh).begin(), vertices(m_tmesh).end());
+    CGAL::for_each<Concurrency_tag>(vds, [&](vertex_descriptor v) -> bool
     {
       int vid = static_cast<int>(get(m_vertex_id_pmap, v));
       m_normals[vid] = PMP::compute_vertex_normal(v
                           , m_tmesh
                           , CGAL::parameters::geom_traits(m_traits)
                           .face_normal_map(normals_pmap));
-    }
+      return true;
+    });
   }
 
   // --------------------------------------------------------------------------
@@ -1425,16 +1527,28 @@ private:
 template <class TriangleMesh,
           class Traits_,
           class VertexPointMap_,
-          class SolverTraits_>
-std::size_t Mean_curvature_flow_skeletonization<TriangleMesh, Traits_, VertexPointMap_, SolverTraits_>::collapse_short_edges()
+          class SolverTraits_,
+          class ConcurrencyTag>
+std::size_t Mean_curvature_flow_skeletonization<TriangleMesh, Traits_, VertexPointMap_, SolverTraits_, ConcurrencyTag>::collapse_short_edges()
 {
   std::size_t cnt=0, prev_cnt=0;
 
   std::set<edge_descriptor,Less_id> edges_to_collapse, non_topologically_valid_collapses;
 
-  for(edge_descriptor ed : edges(m_tmesh))
-    if ( edge_should_be_collapsed(ed) )
-      edges_to_collapse.insert(ed);
+  // the initial candidates are tested concurrently, the collapses themselves are sequential
+  std::vector<edge_descriptor> eds(edges(m_tmesh).begin(), edges(m_tmesh).end());
+  std::vector<char> should_be_collapsed(eds.size(), false);
+  CGAL::for_each<Concurrency_tag>(
+    boost::irange<std::size_t>(0, eds.size()),
+    [&](const std::size_t k) -> bool
+    {
+      should_be_collapsed[k] = edge_should_be_collapsed(eds[k]);
+      return true;
+    });
+
+  for(std::size_t k = 0; k < eds.size(); ++k)
+    if ( should_be_collapsed[k] )
+      edges_to_collapse.insert(eds[k]);
 
   do{
     prev_cnt=cnt;
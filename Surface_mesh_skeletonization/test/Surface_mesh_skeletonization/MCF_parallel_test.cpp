@@ -0,0 +1,85 @@
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/Polyhedron_items_with_id_3.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Mean_curvature_flow_skeletonization.h>
+#include <CGAL/Timer.h>
+
+#include <fstream>
+#include <set>
+
+typedef CGAL::Simple_cartesian<double>                               Kernel;
+typedef CGAL::Polyhedron_3<Kernel, CGAL::Polyhedron_items_with_id_3> Polyhedron;
+typedef boost::graph_traits<Polyhedron>::vertex_descriptor           vertex_descriptor;
+
+// every input vertex is associated with exactly one skeleton vertex
+template <typename Skeleton>
+bool is_skeleton_valid(const Polyhedron& mesh, const Skeleton& skeleton)
+{
+  if (num_vertices(skeleton) == 0)
+  {
+    std::cerr << "The number of skeletal points is zero!\n";
+    return false;
+  }
+
+  std::set<vertex_descriptor> visited;
+  for(typename boost::graph_traits<Skeleton>::vertex_descriptor v : CGAL::make_range(vertices(skeleton)))
+  {
+    for(vertex_descriptor vd : skeleton[v].vertices)
+      if (!visited.insert(vd).second)
+      {
+        std::cerr << "A vertex was seen twice!\n";
+        return false;
+      }
+  }
+
+  if (visited.size() != num_vertices(mesh))
+  {
+    std::cerr << "A vertex was not seen!\n";
+    return false;
+  }
+  return true;
+}
+
+template <typename ConcurrencyTag>
+bool test(const Polyhedron& mesh)
+{
+  typedef CGAL::Mean_curvature_flow_skeletonization<Polyhedron, CGAL::Default, CGAL::Default,
+                                                    CGAL::Default, ConcurrencyTag> Mean_curvature_skeleton;
+  typedef typename Mean_curvature_skeleton::Skeleton                              Skeleton;
+
+  CGAL::Timer timer;
+  timer.start();
+
+  Skeleton skeleton;
+  Mean_curvature_skeleton mcs(mesh);
+  mcs(skeleton);
+
+  std::cout << "  " << num_vertices(skeleton) << " skeletal points in "
+            << timer.time() << " s\n";
+
+  return is_skeleton_valid(mesh, skeleton);
+}
+
+int main()
+{
+  Polyhedron mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/elephant.off"));
+
+  if ( !input || !(input >> mesh) || mesh.empty() ) {
+    std::cerr << "Cannot open data/elephant.off" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Sequential\n";
+  if (!test<CGAL::Sequential_tag>(mesh))
+    return EXIT_FAILURE;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel\n";
+  if (!test<CGAL::Parallel_tag>(mesh))
+    return EXIT_FAILURE;
+#endif
+
+  std::cout << "Pass parallel test.\n";
+  return EXIT_SUCCESS;
+}
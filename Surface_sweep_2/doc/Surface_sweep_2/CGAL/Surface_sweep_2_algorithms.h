@@ -12,8 +12,17 @@ of the value of the `report_endpoints` flag). The value-type of
 `InputIterator` is a curve type and the value-type of `OutputIterator`
 is a point type. The output points are reported in an increasing
 \f$xy\f$-lexicographical order.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag` (the default), `Parallel_tag`, and
+`Parallel_if_available_tag`. The parallel algorithm partitions the plane into
+vertical slabs, and sweeps the curves of each slab concurrently; a curve that
+overlaps several slabs is swept once for each of them, and each point is
+reported by the slab that contains it. The parallel algorithm is only applied
+to bounded curves, and falls back to the sequential one otherwise.
 */
-template <class InputIterator, class OutputIterator>
+template <class ConcurrencyTag = Sequential_tag,
+          class InputIterator, class OutputIterator>
 OutputIterator compute_intersection_points (InputIterator curves_begin,
                                             InputIterator curves_end,
                                             OutputIterator points,
@@ -31,8 +40,15 @@ must be a model of the `ArrangementTraits_2` concept, such that the
 value-type of `InputIterator` is `Traits::Curve_2`, and the
 value-type of `OutputIterator` is `Traits::Point_2`.
 The output points are reported in an increasing \f$ xy\f$-lexicographical order.
+When `ConcurrencyTag` is `Parallel_tag`, the slabs are swept concurrently,
+each with its own copy of `traits`.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag` (the default), `Parallel_tag`, and
+`Parallel_if_available_tag`. See the overload above.
 */
-template <class InputIterator, class OutputIterator, class Traits>
+template <class ConcurrencyTag = Sequential_tag,
+          class InputIterator, class OutputIterator, class Traits>
 OutputIterator compute_intersection_points (InputIterator curves_begin,
                                             InputIterator curves_end,
                                             OutputIterator points,
@@ -82,8 +98,12 @@ Given a range of curves, check whether there is at least one pair of curves
 that intersect in their interior. The function returns `true` if such
 a pair is found, and `false` if all curves are pairwise disjoint in
 their interior. The value-type of `InputIterator` is a curve type.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag` (the default), `Parallel_tag`, and
+`Parallel_if_available_tag`. See `compute_intersection_points()`.
 */
-template <class InputIterator>
+template <class ConcurrencyTag = Sequential_tag, class InputIterator>
 bool do_curves_intersect (InputIterator curves_begin,
                           InputIterator curves_end);
 
@@ -96,8 +116,15 @@ a pair is found, and `false` if all curves are pairwise disjoint in
 their interior. The `Traits` type must be a model
 of the `ArrangementTraits_2` concept, such that the value-type of
 `InputIterator` is `Traits::Curve_2`.
+When `ConcurrencyTag` is `Parallel_tag`, the slabs are swept concurrently,
+each with its own copy of `traits`.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag` (the default), `Parallel_tag`, and
+`Parallel_if_available_tag`. See `compute_intersection_points()`.
 */
-template <class InputIterator, class Traits>
+template <class ConcurrencyTag = Sequential_tag,
+          class InputIterator, class Traits>
 bool do_curves_intersect (InputIterator curves_begin,
                           InputIterator curves_end,
                           Traits traits = Default_traits());
@@ -70,7 +70,7 @@ private:
 
 public:
   typedef Curve_comparer<Gt2, Event, Subcurve>          Compare_curves;
-  typedef Multiset<Subcurve*, Compare_curves, Allocator>
+  typedef Multiset<Subcurve*, Compare_curves, Allocator, Tag_true>
                                                         Status_line;
   typedef typename Status_line::iterator                Status_line_iterator;
 
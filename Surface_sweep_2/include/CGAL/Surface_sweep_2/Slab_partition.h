@@ -0,0 +1,207 @@
+// Copyright (c) 2026 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_SURFACE_SWEEP_2_SLAB_PARTITION_H
+#define CGAL_SURFACE_SWEEP_2_SLAB_PARTITION_H
+
+#include <CGAL/license/Surface_sweep_2.h>
+
+/*! \file
+ *
+ * Definition of the Slab_partition class-template.
+ */
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <CGAL/assertions.h>
+#include <CGAL/enum.h>
+#include <CGAL/tags.h>
+#include <CGAL/Arr_tags.h>
+#include <CGAL/Arrangement_2/Arr_traits_adaptor_2.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+namespace CGAL {
+namespace Surface_sweep_2 {
+
+/*! \class Slab_partition
+ *
+ * A partition of the plane into vertical slabs, used to run independent
+ * surface sweeps on subsets of the input.
+ * The slabs are separated by the vertical lines through a sequence of
+ * boundary points b_1, ..., b_{k-1} sorted by strictly increasing x; the i-th
+ * slab is the half-open x-range [b_i, b_{i+1}), where b_0 = -oo and b_k = +oo.
+ * Every point belongs to exactly one slab, and an x-monotone curve belongs to
+ * every slab its x-range overlaps. Thus, every event of a sweep over a set of
+ * curves is also an event of the sweep over the curves of the slab that
+ * contains it, with the same set of incident curves.
+ *
+ * The geometry traits must be a model of ArrangementXMonotoneTraits_2 whose
+ * curves are all bounded.
+ */
+template <typename GeometryTraits_2>
+class Slab_partition {
+public:
+  typedef GeometryTraits_2                              Geometry_traits_2;
+
+private:
+  typedef Geometry_traits_2                             Gt2;
+
+public:
+  typedef typename Gt2::Point_2                         Point_2;
+  typedef typename Gt2::X_monotone_curve_2              X_monotone_curve_2;
+
+protected:
+  const Gt2* m_traits;              // The geometry traits.
+  std::vector<Point_2> m_bounds;    // The slab boundaries, sorted by x.
+
+  /*! Compare the x-coordinates of two points. */
+  bool less_x(const Point_2& p, const Point_2& q) const
+  { return (m_traits->compare_x_2_object()(p, q) == SMALLER); }
+
+public:
+  /*! Constructor.
+   * The boundaries are chosen among the left endpoints of the given curves,
+   * such that the slabs contain roughly the same number of curve endpoints.
+   * \param traits The geometry traits.
+   * \param begin An iterator for the first x-monotone curve in the range.
+   * \param end A past-the-end iterator for the range.
+   * \param number_of_slabs The requested number of slabs. The actual number
+   *        of slabs may be smaller, as boundaries are pairwise distinct in x.
+   */
+  template <typename XCurveIterator>
+  Slab_partition(const Gt2* traits,
+                 XCurveIterator begin, XCurveIterator end,
+                 std::size_t number_of_slabs) :
+    m_traits(traits)
+  {
+    const std::size_t n = std::distance(begin, end);
+    if ((number_of_slabs < 2) || (n == 0)) return;
+
+    // Sample the left endpoints of the curves.
+    const std::size_t max_samples = 16 * number_of_slabs;
+    const std::size_t step = (n > max_samples) ? (n / max_samples) : 1;
+    auto min_vertex = m_traits->construct_min_vertex_2_object();
+    std::vector<Point_2> samples;
+    samples.reserve(n / step + 1);
+    std::size_t i = 0;
+    for (XCurveIterator it = begin; it != end; ++it, ++i)
+      if (i % step == 0) samples.push_back(min_vertex(*it));
+
+    std::sort(samples.begin(), samples.end(),
+              [this](const Point_2& p, const Point_2& q)
+              { return less_x(p, q); });
+
+    // Pick evenly spaced quantiles, skipping boundaries that share their
+    // x-coordinate with the previous one.
+    m_bounds.reserve(number_of_slabs - 1);
+    for (std::size_t k = 1; k < number_of_slabs; ++k) {
+      const Point_2& p = samples[(k * samples.size()) / number_of_slabs];
+      if (m_bounds.empty() || less_x(m_bounds.back(), p))
+        m_bounds.push_back(p);
+    }
+  }
+
+  /*! Obtain the number of slabs. */
+  std::size_t number_of_slabs() const { return m_bounds.size() + 1; }
+
+  /*! Obtain the index of the slab that contains a given point. */
+  std::size_t slab(const Point_2& p) const
+  {
+    return std::upper_bound(m_bounds.begin(), m_bounds.end(), p,
+                            [this](const Point_2& q, const Point_2& b)
+                            { return less_x(q, b); }) - m_bounds.begin();
+  }
+
+  /*! Obtain the (inclusive) range of indices of the slabs that an
+   * x-monotone curve overlaps.
+   */
+  std::pair<std::size_t, std::size_t> slabs(const X_monotone_curve_2& xcv) const
+  {
+    return std::make_pair(slab(m_traits->construct_min_vertex_2_object()(xcv)),
+                          slab(m_traits->construct_max_vertex_2_object()(xcv)));
+  }
+
+  /*! Distribute x-monotone curves and isolated points among the slabs.
+   * \param xcvs_begin An iterator for the first x-monotone curve.
+   * \param xcvs_end A past-the-end iterator for the x-monotone curves.
+   * \param pts_begin An iterator for the first isolated point.
+   * \param pts_end A past-the-end iterator for the isolated points.
+   * \param slab_xcvs Output: the x-monotone curves of each slab.
+   * \param slab_pts Output: the isolated points of each slab.
+   */
+  template <typename XCurveIterator, typename PointIterator>
+  void distribute(XCurveIterator xcvs_begin, XCurveIterator xcvs_end,
+                  PointIterator pts_begin, PointIterator pts_end,
+                  std::vector<std::vector<X_monotone_curve_2> >& slab_xcvs,
+                  std::vector<std::vector<Point_2> >& slab_pts) const
+  {
+    slab_xcvs.assign(number_of_slabs(), std::vector<X_monotone_curve_2>());
+    slab_pts.assign(number_of_slabs(), std::vector<Point_2>());
+
+    for (XCurveIterator it = xcvs_begin; it != xcvs_end; ++it) {
+      std::pair<std::size_t, std::size_t> range = slabs(*it);
+      CGAL_assertion(range.first <= range.second);
+      for (std::size_t i = range.first; i <= range.second; ++i)
+        slab_xcvs[i].push_back(*it);
+    }
+
+    for (PointIterator it = pts_begin; it != pts_end; ++it)
+      slab_pts[slab(*it)].push_back(*it);
+  }
+};
+
+namespace internal {
+
+/*! The concurrency tag actually used by the surface-sweep functions: the
+ * slab-parallel sweep is only applicable to bounded curves, so it falls back
+ * to the sequential sweep for traits with non-oblivious boundary sides.
+ */
+template <typename ConcurrencyTag, typename Traits>
+struct Sweep_concurrency_tag {
+  typedef Arr_traits_basic_adaptor_2<Traits>                    Traits_adaptor_2;
+  typedef typename Arr_all_sides_oblivious_category<
+    typename Traits_adaptor_2::Left_side_category,
+    typename Traits_adaptor_2::Bottom_side_category,
+    typename Traits_adaptor_2::Top_side_category,
+    typename Traits_adaptor_2::Right_side_category>::result     Category;
+
+  typedef std::conditional_t<std::is_convertible<ConcurrencyTag,
+                                                 Parallel_tag>::value &&
+                             std::is_same<Category,
+                                          Arr_all_sides_oblivious_tag>::value,
+                             Parallel_tag, Sequential_tag>      type;
+};
+
+/*! Obtain the number of slabs used by a parallel sweep over n x-monotone
+ * curves. Each thread is given several slabs for load balancing, and slabs
+ * are not made too small, as the curves that cross slab boundaries are swept
+ * more than once.
+ */
+inline std::size_t number_of_sweep_slabs(std::size_t n)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  const std::size_t nb_threads = tbb::this_task_arena::max_concurrency();
+#else
+  const std::size_t nb_threads = 1;
+#endif
+  return (std::min)(4 * nb_threads, n / 32 + 1);
+}
+
+} // namespace internal
+} // namespace Surface_sweep_2
+} // namespace CGAL
+
+#endif
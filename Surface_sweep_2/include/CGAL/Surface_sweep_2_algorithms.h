@@ -26,6 +26,16 @@
 #include <CGAL/Surface_sweep_2/Intersection_points_visitor.h>
 #include <CGAL/Surface_sweep_2/Subcurves_visitor.h>
 #include <CGAL/Surface_sweep_2/Do_interior_intersect_visitor.h>
+#include <CGAL/Surface_sweep_2/Slab_partition.h>
+#include <CGAL/Surface_sweep_2/Surface_sweep_2_utils.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <boost/range/irange.hpp>
+
+#include <atomic>
+#include <type_traits>
+#include <vector>
 
 #include <CGAL/Segment_2.h>
 #include <CGAL/Arr_segment_traits_2.h>
@@ -99,6 +109,163 @@ struct Default_arr_traits<CGAL::Arr_linear_object_2<Kernel> >
   typedef CGAL::Arr_linear_traits_2<Kernel>                             Traits;
 };
 
+namespace Surface_sweep_2 {
+namespace internal {
+
+/*! Compute the intersection points induced by x-monotone curves and isolated
+ * points, sweeping the slabs of a vertical partition concurrently.
+ * Each slab reports only the points it contains, so that every point is
+ * reported exactly once and in increasing xy-lexicographical order.
+ */
+template <typename Traits, typename OutputIterator>
+OutputIterator
+compute_intersection_points_in_slabs
+(const std::vector<typename Traits::X_monotone_curve_2>& xcvs,
+ const std::vector<typename Traits::Point_2>& pts,
+ OutputIterator points, bool report_endpoints, Traits& tr,
+ std::size_t number_of_slabs)
+{
+  typedef typename Traits::X_monotone_curve_2                   X_monotone_curve_2;
+  typedef typename Traits::Point_2                              Point_2;
+  typedef std::back_insert_iterator<std::vector<Point_2> >      Slab_output;
+  typedef Intersection_points_visitor<Traits, Slab_output>      Visitor;
+  typedef Surface_sweep_2<Visitor>                              Surface_sweep;
+
+  Slab_partition<Traits> partition(&tr, xcvs.begin(), xcvs.end(),
+                                   number_of_slabs);
+  std::vector<std::vector<X_monotone_curve_2> > slab_xcvs;
+  std::vector<std::vector<Point_2> > slab_pts;
+  partition.distribute(xcvs.begin(), xcvs.end(), pts.begin(), pts.end(),
+                       slab_xcvs, slab_pts);
+
+  std::vector<std::vector<Point_2> > slab_points(partition.number_of_slabs());
+  CGAL::for_each<Parallel_tag>
+    (boost::irange<std::size_t>(0, partition.number_of_slabs()),
+     [&](std::size_t i) -> bool
+     {
+       // Each sweep has its own traits, as some traits (e.g., circle-segment
+       // and conic traits) cache the intersections they compute.
+       Traits slab_tr(tr);
+       std::vector<Point_2> found;
+       Visitor visitor(std::back_inserter(found), report_endpoints);
+       Surface_sweep surface_sweep(&slab_tr, &visitor);
+       surface_sweep.sweep(slab_xcvs[i].begin(), slab_xcvs[i].end(),
+                           slab_pts[i].begin(), slab_pts[i].end());
+
+       // Points that lie outside the slab are reported by their own slab.
+       for (const Point_2& p : found)
+         if (partition.slab(p) == i) slab_points[i].push_back(p);
+       return true;
+     });
+
+  for (const std::vector<Point_2>& slab : slab_points)
+    points = std::copy(slab.begin(), slab.end(), points);
+  return points;
+}
+
+template <typename CurveInputIterator, typename OutputIterator, typename Traits>
+OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
+                                           CurveInputIterator curves_end,
+                                           OutputIterator points,
+                                           bool report_endpoints,
+                                           Traits& tr,
+                                           Sequential_tag)
+{
+  // Define the surface-sweep types:
+  typedef Intersection_points_visitor<Traits, OutputIterator>   Visitor;
+  typedef Surface_sweep_2<Visitor>                              Surface_sweep;
+
+  // Perform the sweep and obtain the intersection points.
+  Visitor visitor(points, report_endpoints);
+  Surface_sweep surface_sweep(&tr, &visitor);
+  visitor.sweep(curves_begin, curves_end);
+
+  return visitor.output_iterator();
+}
+
+template <typename CurveInputIterator, typename OutputIterator, typename Traits>
+OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
+                                           CurveInputIterator curves_end,
+                                           OutputIterator points,
+                                           bool report_endpoints,
+                                           Traits& tr,
+                                           Parallel_tag)
+{
+  std::vector<typename Traits::X_monotone_curve_2> xcvs;
+  std::vector<typename Traits::Point_2> pts;
+  xcvs.reserve(std::distance(curves_begin, curves_end));
+  make_x_monotone(curves_begin, curves_end,
+                  std::back_inserter(xcvs), std::back_inserter(pts), &tr);
+
+  return compute_intersection_points_in_slabs(xcvs, pts, points,
+                                              report_endpoints, tr,
+                                              number_of_sweep_slabs(xcvs.size()));
+}
+
+template <typename CurveInputIterator, typename Traits>
+bool do_curves_intersect(CurveInputIterator curves_begin,
+                         CurveInputIterator curves_end, Traits& tr,
+                         Sequential_tag)
+{
+  // Define the surface-sweep types:
+  typedef Do_interior_intersect_visitor<Traits>                 Visitor;
+  typedef Surface_sweep_2<Visitor>                              Surface_sweep;
+
+  // Perform the sweep and obtain the subcurves.
+  Visitor visitor;
+  Surface_sweep surface_sweep(&tr, &visitor);
+  visitor.sweep(curves_begin, curves_end);
+  return visitor.found_intersection();
+}
+
+/*! Determine whether curves intersect by sweeping the slabs of a vertical
+ * partition concurrently. An intersection found by any slab is an
+ * intersection of two input curves, and every intersection is found by the
+ * slab that contains it.
+ */
+template <typename CurveInputIterator, typename Traits>
+bool do_curves_intersect(CurveInputIterator curves_begin,
+                         CurveInputIterator curves_end, Traits& tr,
+                         Parallel_tag)
+{
+  typedef typename Traits::X_monotone_curve_2                   X_monotone_curve_2;
+  typedef typename Traits::Point_2                              Point_2;
+  typedef Do_interior_intersect_visitor<Traits>                 Visitor;
+  typedef Surface_sweep_2<Visitor>                              Surface_sweep;
+
+  std::vector<X_monotone_curve_2> xcvs;
+  std::vector<Point_2> pts;
+  xcvs.reserve(std::distance(curves_begin, curves_end));
+  make_x_monotone(curves_begin, curves_end,
+                  std::back_inserter(xcvs), std::back_inserter(pts), &tr);
+
+  Slab_partition<Traits> partition(&tr, xcvs.begin(), xcvs.end(),
+                                   number_of_sweep_slabs(xcvs.size()));
+  std::vector<std::vector<X_monotone_curve_2> > slab_xcvs;
+  std::vector<std::vector<Point_2> > slab_pts;
+  partition.distribute(xcvs.begin(), xcvs.end(), pts.begin(), pts.end(),
+                       slab_xcvs, slab_pts);
+
+  std::atomic<bool> found(false);
+  CGAL::for_each<Parallel_tag>
+    (boost::irange<std::size_t>(0, partition.number_of_slabs()),
+     [&](std::size_t i) -> bool
+     {
+       if (found) return false;
+       Traits slab_tr(tr);
+       Visitor visitor;
+       Surface_sweep surface_sweep(&slab_tr, &visitor);
+       surface_sweep.sweep(slab_xcvs[i].begin(), slab_xcvs[i].end(),
+                           slab_pts[i].begin(), slab_pts[i].end());
+       if (visitor.found_intersection()) found = true;
+       return ! found;
+     });
+  return found;
+}
+
+} // namespace internal
+} // namespace Surface_sweep_2
+
 /*! Compute all intersection points induced by a range of input curves.
  * The intersections are calculated using the surface-sweep algorithm.
  * \param begin An input iterator for the first curve in the range.
@@ -110,27 +277,27 @@ struct Default_arr_traits<CGAL::Arr_linear_object_2<Kernel> >
  * \pre The value-type of CurveInputIterator is Traits::Curve_2, and the
  *      value-type of OutputIterator is Traits::Point_2.
  */
-template <typename CurveInputIterator, typename OutputIterator, typename Traits>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename CurveInputIterator, typename OutputIterator, typename Traits>
 OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
                                            CurveInputIterator curves_end,
                                            OutputIterator points,
                                            bool report_endpoints,
                                            Traits &tr)
 {
-  // Define the surface-sweep types:
-  typedef Ss2::Intersection_points_visitor<Traits, OutputIterator>
-                                                                Visitor;
-  typedef Ss2::Surface_sweep_2<Visitor>                         Surface_sweep;
-
-  // Perform the sweep and obtain the intersection points.
-  Visitor visitor(points, report_endpoints);
-  Surface_sweep surface_sweep(&tr, &visitor);
-  visitor.sweep(curves_begin, curves_end);
-
-  return visitor.output_iterator();
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  typedef typename Ss2::internal::Sweep_concurrency_tag<ConcurrencyTag,
+                                                        Traits>::type Tag;
+  return Ss2::internal::compute_intersection_points(curves_begin, curves_end,
+                                                    points, report_endpoints,
+                                                    tr, Tag());
 }
 
-template <typename CurveInputIterator, typename OutputIterator>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename CurveInputIterator, typename OutputIterator>
 OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
                                            CurveInputIterator curves_end,
                                            OutputIterator points,
@@ -140,8 +307,9 @@ OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
 
   typename Default_arr_traits<Curve>::Traits   traits;
 
-  return compute_intersection_points(curves_begin, curves_end, points,
-                                     report_endpoints, traits);
+  return compute_intersection_points<ConcurrencyTag>(curves_begin, curves_end,
+                                                     points, report_endpoints,
+                                                     traits);
 }
 
 /*! Compute all x-monotone subcurves that are disjoint in their interiors
@@ -191,29 +359,31 @@ OutputIterator compute_subcurves(CurveInputIterator curves_begin,
  * \param end A input past-the-end iterator for the range.
  * \return (true) if any pair of curves intersect; (false) otherwise.
  */
-template <typename CurveInputIterator, typename Traits>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename CurveInputIterator, typename Traits>
 bool do_curves_intersect(CurveInputIterator curves_begin,
                          CurveInputIterator curves_end, Traits& tr)
 {
-  // Define the surface-sweep types:
-  typedef Ss2::Do_interior_intersect_visitor<Traits>            Visitor;
-  typedef Ss2::Surface_sweep_2<Visitor>                         Surface_sweep;
-
-  // Perform the sweep and obtain the subcurves.
-  Visitor visitor;
-  Surface_sweep surface_sweep(&tr, &visitor);
-  visitor.sweep(curves_begin, curves_end);
-  return visitor.found_intersection();
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  typedef typename Ss2::internal::Sweep_concurrency_tag<ConcurrencyTag,
+                                                        Traits>::type Tag;
+  return Ss2::internal::do_curves_intersect(curves_begin, curves_end, tr,
+                                            Tag());
 }
 
-template <typename CurveInputIterator>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename CurveInputIterator>
 bool do_curves_intersect(CurveInputIterator curves_begin,
                          CurveInputIterator curves_end)
 {
   typedef typename std::iterator_traits<CurveInputIterator>::value_type  Curve;
 
   typename Default_arr_traits<Curve>::Traits m_traits;
-  return do_curves_intersect(curves_begin, curves_end, m_traits);
+  return do_curves_intersect<ConcurrencyTag>(curves_begin, curves_end,
+                                             m_traits);
 }
 
 } // namespace CGAL
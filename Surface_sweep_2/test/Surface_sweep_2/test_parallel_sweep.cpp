@@ -0,0 +1,181 @@
+// Compare the slab-parallel surface-sweep functions with the sequential ones.
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arr_circle_segment_traits_2.h>
+#include <CGAL/Surface_sweep_2_algorithms.h>
+#include <CGAL/Random.h>
+
+#ifndef CGAL_LINKED_WITH_TBB
+
+int main()
+{
+  std::cout << "TBB is not installed. Test is not performed." << std::endl;
+  return 0;
+}
+
+#else
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel       Kernel;
+typedef Kernel::Point_2                                         Point_2;
+typedef CGAL::Arr_segment_traits_2<Kernel>                      Traits_2;
+typedef Traits_2::Curve_2                                       Segment_2;
+
+// Generate segments with endpoints on a coarse grid, so that there are many
+// degeneracies: shared endpoints, overlaps, vertical segments, and
+// intersections on slab boundaries.
+std::vector<Segment_2> random_segments(std::size_t n, int grid, CGAL::Random& rnd)
+{
+  std::vector<Segment_2> segs;
+  while (segs.size() < n) {
+    Point_2 p(rnd.get_int(0, grid), rnd.get_int(0, grid));
+    Point_2 q(rnd.get_int(0, grid), rnd.get_int(0, grid));
+    if (p != q) segs.push_back(Segment_2(p, q));
+  }
+  return segs;
+}
+
+bool test_intersection_points(const std::vector<Segment_2>& segs,
+                              bool report_endpoints)
+{
+  Traits_2 traits;
+  std::vector<Point_2> seq, par;
+  CGAL::compute_intersection_points(segs.begin(), segs.end(),
+                                    std::back_inserter(seq),
+                                    report_endpoints, traits);
+  CGAL::compute_intersection_points<CGAL::Parallel_tag>
+    (segs.begin(), segs.end(), std::back_inserter(par), report_endpoints, traits);
+  if (seq != par) {
+    std::cerr << "Parallel intersection points differ: " << seq.size()
+              << " vs " << par.size() << std::endl;
+    return false;
+  }
+
+  // Force various numbers of slabs, including more slabs than distinct
+  // x-coordinates.
+  std::vector<Traits_2::X_monotone_curve_2> xcvs;
+  std::vector<Point_2> iso_pts;
+  CGAL::Surface_sweep_2::make_x_monotone(segs.begin(), segs.end(),
+                                         std::back_inserter(xcvs),
+                                         std::back_inserter(iso_pts), &traits);
+  for (std::size_t k : {1, 2, 3, 7, 64, 1000}) {
+    std::vector<Point_2> slabs;
+    CGAL::Surface_sweep_2::internal::compute_intersection_points_in_slabs
+      (xcvs, iso_pts, std::back_inserter(slabs), report_endpoints, traits, k);
+    if (seq != slabs) {
+      std::cerr << "Intersection points differ with " << k << " slabs: "
+                << seq.size() << " vs " << slabs.size() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool test_do_intersect(const std::vector<Segment_2>& segs)
+{
+  bool seq = CGAL::do_curves_intersect(segs.begin(), segs.end());
+  bool par = CGAL::do_curves_intersect<CGAL::Parallel_tag>(segs.begin(),
+                                                            segs.end());
+  if (seq != par) {
+    std::cerr << "Parallel do_curves_intersect differs" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Circle-segment traits cache the intersections they compute: each slab
+// must sweep with its own copy of the traits.
+bool test_circles(CGAL::Random& rnd)
+{
+  typedef CGAL::Arr_circle_segment_traits_2<Kernel>             Circle_traits_2;
+  typedef Circle_traits_2::Curve_2                              Circle_curve_2;
+  typedef Circle_traits_2::Point_2                              Circle_point_2;
+
+  std::vector<Circle_curve_2> circles;
+  for (int i = 0; i < 40; ++i)
+    circles.push_back(Circle_curve_2(Kernel::Circle_2
+                                     (Point_2(rnd.get_int(0, 100), rnd.get_int(0, 100)),
+                                      rnd.get_int(1, 400))));
+
+  Circle_traits_2 traits;
+  std::vector<Circle_point_2> seq, par;
+  CGAL::compute_intersection_points(circles.begin(), circles.end(),
+                                    std::back_inserter(seq), false, traits);
+  CGAL::compute_intersection_points<CGAL::Parallel_tag>
+    (circles.begin(), circles.end(), std::back_inserter(par), false, traits);
+
+  bool ok = (seq.size() == par.size());
+  for (std::size_t i = 0; ok && i < seq.size(); ++i)
+    ok = traits.equal_2_object()(seq[i], par[i]);
+  if (! ok)
+    std::cerr << "Parallel intersection points of circles differ: "
+              << seq.size() << " vs " << par.size() << std::endl;
+
+  bool seq_intersect = CGAL::do_curves_intersect(circles.begin(), circles.end());
+  bool par_intersect = CGAL::do_curves_intersect<CGAL::Parallel_tag>
+    (circles.begin(), circles.end());
+  if (seq_intersect != par_intersect) {
+    std::cerr << "Parallel do_curves_intersect differs on circles" << std::endl;
+    ok = false;
+  }
+  return ok;
+}
+
+// A degenerate circle is an isolated point: lying in the interior of a
+// segment, it intersects it.
+bool test_isolated_point()
+{
+  typedef CGAL::Arr_circle_segment_traits_2<Kernel>             Circle_traits_2;
+  typedef Circle_traits_2::Curve_2                              Circle_curve_2;
+
+  std::vector<Circle_curve_2> curves;
+  for (int i = 0; i < 1000; ++i)
+    curves.push_back(Circle_curve_2(Kernel::Segment_2(Point_2(i, i),
+                                                      Point_2(i + 2000, i))));
+  bool ok = ! CGAL::do_curves_intersect<CGAL::Parallel_tag>(curves.begin(),
+                                                             curves.end());
+
+  curves.push_back(Circle_curve_2(Kernel::Circle_2(Point_2(1500, 500), 0)));
+  bool seq = CGAL::do_curves_intersect(curves.begin(), curves.end());
+  bool par = CGAL::do_curves_intersect<CGAL::Parallel_tag>(curves.begin(),
+                                                            curves.end());
+  ok = ok && seq && par;
+  if (! ok)
+    std::cerr << "do_curves_intersect misses an isolated point" << std::endl;
+  return ok;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  bool ok = true;
+
+  for (int grid : {10, 100, 10000}) {
+    std::vector<Segment_2> segs = random_segments(500, grid, rnd);
+    ok = ok && test_intersection_points(segs, false);
+    ok = ok && test_intersection_points(segs, true);
+    ok = ok && test_do_intersect(segs);
+  }
+
+  // Pairwise interior-disjoint segments that span many slabs.
+  std::vector<Segment_2> disjoint;
+  for (int i = 0; i < 1000; ++i)
+    disjoint.push_back(Segment_2(Point_2(i, i), Point_2(i + 2000, i)));
+  ok = ok && test_do_intersect(disjoint);
+  assert(! CGAL::do_curves_intersect<CGAL::Parallel_tag>(disjoint.begin(),
+                                                          disjoint.end()));
+  ok = ok && test_intersection_points(disjoint, true);
+
+  ok = ok && test_circles(rnd);
+  ok = ok && test_isolated_point();
+
+  if (! ok) return 1;
+  std::cout << "Passed." << std::endl;
+  return 0;
+}
+
+#endif